@@ -1,7 +1,9 @@
 TEMPLATE = subdirs
 SUBDIRS  = \
+    adblock \
     addbookmarkdialog \
     autosaver \
+    cookiejar \
     downloadmanager \
     editlistview \
     edittreeview \
@@ -9,13 +11,22 @@ SUBDIRS  = \
     historymanager \
     languagemanager \
     lineedit \
+    locationcompleter \
+    networkmonitor \
     opensearchengine \
     opensearchmanager \
     opensearchreader \
     opensearchwriter \
+    requestscheduler \
     searchlineedit \
     tabbar \
     tabwidget \
+    trie \
     webactionmapper \
     webpage \
     xbel
+
+# QAbstractNetworkCache is new in Qt 4.5
+!lessThan(QT_MINOR_VERSION, 5) {
+    SUBDIRS += networkcache networkdiskcache
+}
@@ -18,7 +18,17 @@
  */
 
 #include <QtTest/QtTest>
+#include "qtest_arora.h"
+
 #include <cookiejar.h>
+#include <cookiejournal.h>
+#include <networkcookiejar.h>
+#include <publicsuffix.h>
+#include <trie_p.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 class tst_CookieJar : public QObject
 {
@@ -66,6 +76,26 @@ private slots:
     void cookiesChanged();
     void isOnDomainList_data();
     void isOnDomainList();
+    void domainLists_data();
+    void domainLists();
+    void domainListsBenchmark_data();
+    void domainListsBenchmark();
+    void hostCache();
+    void removeExpiredCookies();
+    void insertCookie();
+    void insertCookieBenchmark();
+    void registrableDomain_data();
+    void registrableDomain();
+    void publicSuffixCookies();
+    void suffixLabelsBenchmark();
+    void journal();
+    void snapshot();
+    void snapshotStress();
+    void snapshotOtherThread();
+    void snapshotNotCopied();
+    void packedCookies();
+    void memoryUsage();
+    void packedLookupBenchmark();
 };
 
 // Subclass that exposes the protected functions.
@@ -77,6 +107,43 @@ public:
 
     static bool call_isOnDomainList(QStringList const& list, QString const& domain)
         { return SubCookieJar::isOnDomainList(list, domain); }
+
+    static int call_domainLists(const QStringList &block, const QStringList &allow, const QString &domain)
+    {
+        DomainLists lists;
+        addToDomainLists(lists, block, BlockList);
+        addToDomainLists(lists, allow, AllowList);
+        return domainLists(lists, domain);
+    }
+
+    static DomainLists call_compile(const QStringList &block)
+    {
+        DomainLists lists;
+        addToDomainLists(lists, block, BlockList);
+        return lists;
+    }
+
+    static bool call_isBlocked(const DomainLists &lists, const QString &domain)
+        { return domainLists(lists, domain) & BlockList; }
+};
+
+class SubNetworkCookieJar : public NetworkCookieJar
+{
+public:
+    void call_setAllCookies(const QList<QNetworkCookie> &cookieList)
+        { setAllCookies(cookieList); }
+
+    QList<QNetworkCookie> call_allCookies() const
+        { return allCookies(); }
+
+    int call_removeExpiredCookies()
+        { return removeExpiredCookies(); }
+
+    bool call_insertCookie(const QNetworkCookie &cookie)
+        { return insertCookie(cookie); }
+
+    bool call_deleteCookie(const QNetworkCookie &cookie)
+        { return deleteCookie(cookie); }
 };
 
 // This will be called before the first test function is executed.
@@ -551,6 +618,684 @@ void tst_CookieJar::isOnDomainList()
     QCOMPARE(jar.call_isOnDomainList(list, domain), isOnDomainList);
 }
 
+static QNetworkCookie cookie(const QString &name, const QString &domain, const QString &path = QLatin1String("/"))
+{
+    QNetworkCookie cookie(name.toUtf8(), "value");
+    cookie.setDomain(domain);
+    cookie.setPath(path);
+    return cookie;
+}
+
+// The cookies of a host are cached until the jar changes
+void tst_CookieJar::hostCache()
+{
+    SubNetworkCookieJar jar;
+    QUrl url("http://www.foo.com/bar/index.html");
+    QVERIFY(jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", "www.foo.com"), url));
+    QCOMPARE(jar.cookiesForUrl(url).count(), 1);
+    QCOMPARE(jar.cacheMisses(), 1);
+    QCOMPARE(jar.cookiesForUrl(url).count(), 1);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.foo.com/other")).count(), 1);
+    QCOMPARE(jar.cacheHits(), 2);
+    QCOMPARE(jar.cacheMisses(), 1);
+
+    // Paths are still checked
+    QNetworkCookie barCookie = cookie("b", ".foo.com", "/bar");
+    QNetworkCookie secureCookie = cookie("c", "www.foo.com");
+    secureCookie.setSecure(true);
+    jar.setCookiesFromUrl(QList<QNetworkCookie>() << barCookie << secureCookie, url);
+    QList<QNetworkCookie> cookies = jar.cookiesForUrl(url);
+    QCOMPARE(cookies.count(), 2);
+    QCOMPARE(cookies.first().name(), QByteArray("b"));
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.foo.com/other")).count(), 1);
+    QCOMPARE(jar.cacheMisses(), 2);
+
+    // Secure and insecure are cached apart
+    QCOMPARE(jar.cookiesForUrl(QUrl("https://www.foo.com/bar/")).count(), 3);
+    QCOMPARE(jar.cookiesForUrl(QUrl("https://www.foo.com/")).count(), 2);
+    QCOMPARE(jar.cacheMisses(), 3);
+
+    // Expired cookies are not returned
+    QNetworkCookie expiredCookie = cookie("d", "www.foo.com");
+    expiredCookie.setExpirationDate(QDateTime::currentDateTime().addDays(-1));
+    jar.call_setAllCookies(QList<QNetworkCookie>() << cookie("a", "www.foo.com") << expiredCookie);
+    QCOMPARE(jar.cookiesForUrl(url).count(), 1);
+    QCOMPARE(jar.cacheMisses(), 4);
+
+    jar.call_setAllCookies(QList<QNetworkCookie>());
+    QCOMPARE(jar.cookiesForUrl(url).count(), 0);
+    QCOMPARE(jar.cacheMisses(), 5);
+}
+
+// Lookups skip expired cookies, they are removed in one go
+void tst_CookieJar::removeExpiredCookies()
+{
+    SubNetworkCookieJar jar;
+    QDateTime now = QDateTime::currentDateTime();
+    QList<QNetworkCookie> cookies;
+    for (int i = 0; i < 10; ++i) {
+        QNetworkCookie expired = cookie(QString("expired%1").arg(i), "www.foo.com");
+        expired.setExpirationDate(now.addDays(-i - 1));
+        cookies << expired;
+        QNetworkCookie later = cookie(QString("later%1").arg(i), "www.foo.com");
+        later.setExpirationDate(now.addDays(i + 1));
+        cookies << later;
+    }
+    cookies << cookie("session", "www.foo.com");
+    jar.call_setAllCookies(cookies);
+
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.foo.com/")).count(), 11);
+    QCOMPARE(jar.call_allCookies().count(), 21);
+    QCOMPARE(jar.call_removeExpiredCookies(), 10);
+    QCOMPARE(jar.call_allCookies().count(), 11);
+    QCOMPARE(jar.call_removeExpiredCookies(), 0);
+
+    // Removed without asking once they expire
+    QNetworkCookie soon = cookie("soon", "www.foo.com");
+    soon.setExpirationDate(QDateTime::currentDateTime().addSecs(1));
+    QVERIFY(jar.setCookiesFromUrl(QList<QNetworkCookie>() << soon, QUrl("http://www.foo.com/")));
+    QCOMPARE(jar.call_allCookies().count(), 12);
+    QTRY_COMPARE(jar.call_allCookies().count(), 11);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.foo.com/")).count(), 11);
+}
+
+// Cookies are replaced by domain, path and name
+void tst_CookieJar::insertCookie()
+{
+    SubNetworkCookieJar jar;
+    QNetworkCookie a = cookie("a", "www.foo.com");
+    QVERIFY(jar.call_insertCookie(a));
+    QVERIFY(jar.call_insertCookie(cookie("a", "www.foo.com", "/bar")));
+    QVERIFY(jar.call_insertCookie(cookie("a", ".foo.com")));
+    QCOMPARE(jar.call_allCookies().count(), 3);
+
+    QNetworkCookie newA = a;
+    newA.setValue("new");
+    QVERIFY(jar.call_insertCookie(newA));
+    QCOMPARE(jar.call_allCookies().count(), 3);
+    QList<QNetworkCookie> cookies = jar.cookiesForUrl(QUrl("http://www.foo.com/"));
+    QCOMPARE(cookies.count(), 2);
+    QVERIFY(cookies.contains(newA));
+
+    // An expired cookie only removes the old one
+    QNetworkCookie expired = newA;
+    expired.setExpirationDate(QDateTime::currentDateTime().addDays(-1));
+    QVERIFY(jar.call_insertCookie(expired));
+    QCOMPARE(jar.call_allCookies().count(), 2);
+    QVERIFY(!jar.call_insertCookie(expired));
+
+    QVERIFY(jar.call_deleteCookie(cookie("a", "www.foo.com", "/bar")));
+    QVERIFY(!jar.call_deleteCookie(cookie("a", "www.foo.com", "/bar")));
+    QVERIFY(!jar.call_deleteCookie(cookie("b", ".foo.com")));
+    QCOMPARE(jar.call_allCookies(), QList<QNetworkCookie>() << cookie("a", ".foo.com"));
+}
+
+// Forcing cookies into a full jar like CookieJar does with AcceptAlways
+void tst_CookieJar::insertCookieBenchmark()
+{
+    SubNetworkCookieJar jar;
+    QList<QNetworkCookie> cookies;
+    for (int i = 0; i < 10000; ++i)
+        cookies << cookie(QString("c%1").arg(i % 10), QString("www.site%1.com").arg(i / 10));
+    jar.call_setAllCookies(cookies);
+
+    int i = 0;
+    QBENCHMARK {
+        QNetworkCookie tracker = cookie(QString("t%1").arg(i % 50), QString("tracker%1.com").arg(i % 7));
+        jar.call_insertCookie(tracker);
+        ++i;
+    }
+    QVERIFY(jar.call_allCookies().count() > 10000);
+}
+
+void tst_CookieJar::domainLists_data()
+{
+    isOnDomainList_data();
+}
+
+// The compiled lists match what isOnDomainList() matches
+void tst_CookieJar::domainLists()
+{
+    QFETCH(QStringList, list);
+    QFETCH(QString, domain);
+    QFETCH(bool, isOnDomainList);
+
+    QStringList other;
+    other << "bar.org" << ".baz.net";
+    int lists = SubCookieJar::call_domainLists(list, other, domain);
+    QCOMPARE(bool(lists & 1), isOnDomainList);
+    QCOMPARE(bool(lists & 2), SubCookieJar::call_isOnDomainList(other, domain));
+    lists = SubCookieJar::call_domainLists(other, list, domain);
+    QCOMPARE(bool(lists & 2), isOnDomainList);
+}
+
+void tst_CookieJar::domainListsBenchmark_data()
+{
+    QTest::addColumn<bool>("compiled");
+    QTest::newRow("isOnDomainList") << false;
+    QTest::newRow("compiled") << true;
+}
+
+// A block list of 10k rules checked against the hosts of a page
+void tst_CookieJar::domainListsBenchmark()
+{
+    QFETCH(bool, compiled);
+
+    QStringList rules;
+    for (int i = 0; i < 10000; ++i)
+        rules << QString((i % 2) ? ".ads%1.com" : "tracker%1.net").arg(i);
+    qSort(rules);
+    QStringList hosts;
+    for (int i = 0; i < 100; ++i)
+        hosts << QString("www.site%1.org").arg(i) << QString("static.ads%1.com").arg(i * 97 + 1);
+
+    int blocked = 0;
+    if (compiled) {
+        QHash<QString, int> lists = SubCookieJar::call_compile(rules);
+        QBENCHMARK {
+            foreach (const QString &host, hosts)
+                blocked += SubCookieJar::call_isBlocked(lists, host);
+        }
+    } else {
+        QBENCHMARK {
+            foreach (const QString &host, hosts)
+                blocked += SubCookieJar::call_isOnDomainList(rules, host);
+        }
+    }
+    QVERIFY(blocked > 0);
+}
+
+void tst_CookieJar::registrableDomain_data()
+{
+    QTest::addColumn<QString>("domain");
+    QTest::addColumn<QString>("registrableDomain");
+
+    // From the tests of the Public Suffix List
+    QTest::newRow("com") << "com" << "";
+    QTest::newRow("example.com") << "example.com" << "example.com";
+    QTest::newRow("b.example.com") << "b.example.com" << "example.com";
+    QTest::newRow("a.b.example.com") << "a.b.example.com" << "example.com";
+    QTest::newRow("uk.com") << "uk.com" << "";
+    QTest::newRow("example.uk.com") << "example.uk.com" << "example.uk.com";
+    QTest::newRow("b.example.uk.com") << "b.example.uk.com" << "example.uk.com";
+    QTest::newRow("mm") << "mm" << "";
+    QTest::newRow("c.mm") << "c.mm" << "";
+    QTest::newRow("b.c.mm") << "b.c.mm" << "b.c.mm";
+    QTest::newRow("a.b.c.mm") << "a.b.c.mm" << "b.c.mm";
+    QTest::newRow("jp") << "jp" << "";
+    QTest::newRow("test.jp") << "test.jp" << "test.jp";
+    QTest::newRow("www.test.jp") << "www.test.jp" << "test.jp";
+    QTest::newRow("ac.jp") << "ac.jp" << "";
+    QTest::newRow("test.ac.jp") << "test.ac.jp" << "test.ac.jp";
+    QTest::newRow("kyoto.jp") << "kyoto.jp" << "";
+    QTest::newRow("ide.kyoto.jp") << "ide.kyoto.jp" << "";
+    QTest::newRow("b.ide.kyoto.jp") << "b.ide.kyoto.jp" << "b.ide.kyoto.jp";
+    QTest::newRow("c.kobe.jp") << "c.kobe.jp" << "";
+    QTest::newRow("b.c.kobe.jp") << "b.c.kobe.jp" << "b.c.kobe.jp";
+    QTest::newRow("city.kobe.jp") << "city.kobe.jp" << "city.kobe.jp";
+    QTest::newRow("www.city.kobe.jp") << "www.city.kobe.jp" << "city.kobe.jp";
+    QTest::newRow("ck") << "ck" << "";
+    QTest::newRow("test.ck") << "test.ck" << "";
+    QTest::newRow("b.test.ck") << "b.test.ck" << "b.test.ck";
+    QTest::newRow("www.ck") << "www.ck" << "www.ck";
+    QTest::newRow("www.www.ck") << "www.www.ck" << "www.ck";
+    QTest::newRow("us") << "us" << "";
+    QTest::newRow("test.us") << "test.us" << "test.us";
+    QTest::newRow("ak.us") << "ak.us" << "";
+    QTest::newRow("k12.ak.us") << "k12.ak.us" << "";
+    QTest::newRow("test.k12.ak.us") << "test.k12.ak.us" << "test.k12.ak.us";
+    QTest::newRow("example") << "example" << "";
+    QTest::newRow("example.example") << "example.example" << "example.example";
+    QTest::newRow("b.example.example") << "b.example.example" << "example.example";
+    QTest::newRow("co.uk") << "co.uk" << "";
+    QTest::newRow("www.foo.co.uk") << "www.foo.co.uk" << "foo.co.uk";
+    QTest::newRow("empty") << "" << "";
+}
+
+void tst_CookieJar::registrableDomain()
+{
+    QFETCH(QString, domain);
+    QFETCH(QString, registrableDomain);
+
+    QCOMPARE(PublicSuffix::registrableDomain(domain), registrableDomain);
+    QCOMPARE(PublicSuffix::isPublicSuffix(domain), !domain.isEmpty() && registrableDomain.isEmpty());
+
+    QStringList labels = domain.split(QLatin1Char('.'), QString::SkipEmptyParts);
+    QCOMPARE(PublicSuffix::suffixLabels(labels), PublicSuffix::suffixLabels(domain));
+}
+
+// Cookies can not be set for a public suffix and lookups stop at the registrable domain
+void tst_CookieJar::publicSuffixCookies()
+{
+    SubNetworkCookieJar jar;
+    QUrl url("http://www.foo.co.uk/");
+    QVERIFY(!jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", ".co.uk"), url));
+    QVERIFY(!jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", ".uk"), url));
+    QVERIFY(jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", ".foo.co.uk"), url));
+    QVERIFY(!jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", ".blogspot.com"),
+                                   QUrl("http://foo.blogspot.com/")));
+    QVERIFY(jar.setCookiesFromUrl(QList<QNetworkCookie>() << cookie("a", "localhost"),
+                                  QUrl("http://localhost/")));
+
+    jar.call_insertCookie(cookie("b", "co.uk"));
+    QCOMPARE(jar.cookiesForUrl(url).count(), 1);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://co.uk/")).count(), 1);
+}
+
+void tst_CookieJar::suffixLabelsBenchmark()
+{
+    QStringList hosts;
+    hosts << "www.example.com" << "static.foo.co.uk" << "a.b.c.kobe.jp" << "images.site.blogspot.com"
+          << "cdn.test.k12.ak.us" << "www.city.kobe.jp" << "localhost" << "mail.google.com";
+    QList<QStringList> splitHosts;
+    foreach (const QString &host, hosts)
+        splitHosts.append(host.split(QLatin1Char('.')));
+    int labels = 0;
+    QBENCHMARK {
+        foreach (const QStringList &host, splitHosts)
+            labels += PublicSuffix::suffixLabels(host);
+    }
+    QVERIFY(labels > 0);
+}
+
+static void removeJournal(const QString &directory)
+{
+    QDir dir(directory);
+    foreach (const QString &file, dir.entryList(QStringList(QLatin1String("cookies.*"))))
+        dir.remove(file);
+}
+
+void tst_CookieJar::journal()
+{
+    QString directory = QDir::tempPath() + QLatin1String("/cookiejournaltest");
+    QDir().mkpath(directory);
+    removeJournal(directory);
+
+    QNetworkCookie a = cookie("a", ".foo.com");
+    QNetworkCookie b = cookie("b", ".foo.com");
+    QNetworkCookie c = cookie("c", ".bar.com", "/c");
+
+    CookieJournal journal;
+    journal.setDirectory(directory);
+    QVERIFY(!journal.hasSnapshot());
+    QCOMPARE(journal.load(QList<QNetworkCookie>() << a), QList<QNetworkCookie>() << a);
+
+    // a few changes only append a few records
+    QNetworkCookie a2 = a;
+    a2.setValue("value2");
+    journal.append(CookieJournal::SetRecord, b);
+    journal.append(CookieJournal::SetRecord, a2);
+    journal.append(CookieJournal::DeleteRecord, b);
+    journal.append(CookieJournal::SetRecord, c);
+    QVERIFY(journal.flush());
+    QFileInfo info(directory + QLatin1String("/cookies.journal"));
+    QVERIFY(info.size() > 0);
+    QVERIFY(info.size() < 512);
+    QVERIFY(!journal.needsCompaction());
+
+    CookieJournal other;
+    other.setDirectory(directory);
+    QCOMPARE(other.load(QList<QNetworkCookie>() << a), QList<QNetworkCookie>() << a2 << c);
+
+    // a partially written record is dropped
+    QFile file(info.filePath());
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Append));
+    file.write("garbage");
+    file.close();
+    QCOMPARE(other.load(QList<QNetworkCookie>() << a), QList<QNetworkCookie>() << a2 << c);
+
+    // compaction replaces the journal with a snapshot
+    other.compact(QList<QNetworkCookie>() << a2 << c);
+    other.append(CookieJournal::DeleteRecord, a2);
+    QVERIFY(other.flush());
+    other.waitForCompaction();
+    QVERIFY(other.hasSnapshot());
+    QVERIFY(!QFile::exists(directory + QLatin1String("/cookies.journal.old")));
+    QCOMPARE(journal.load(), QList<QNetworkCookie>() << c);
+
+    // the journal a snapshot replaced isn't replayed over it
+    QString journalFile = directory + QLatin1String("/cookies.journal");
+    journal.append(CookieJournal::SetRecord, a);
+    journal.append(CookieJournal::DeleteRecord, c);
+    QVERIFY(journal.flush());
+    QVERIFY(QFile::copy(journalFile, journalFile + QLatin1String(".copy")));
+    journal.compact(QList<QNetworkCookie>() << a);
+    journal.waitForCompaction();
+    QVERIFY(QFile::rename(journalFile + QLatin1String(".copy"), journalFile));
+    QCOMPARE(journal.load(), QList<QNetworkCookie>() << a);
+
+    // a journal the snapshot replaced is not replayed when a crash left it
+    // behind, the cookies it set might have been cleared since
+    QString oldJournalFile = directory + QLatin1String("/cookies.journal.old");
+    journal.append(CookieJournal::SetRecord, b);
+    QVERIFY(journal.flush());
+    QVERIFY(QFile::copy(journalFile, oldJournalFile + QLatin1String(".copy")));
+    journal.compact(QList<QNetworkCookie>() << a);
+    journal.waitForCompaction();
+    QVERIFY(QFile::rename(oldJournalFile + QLatin1String(".copy"), oldJournalFile));
+    QCOMPARE(journal.load(), QList<QNetworkCookie>() << a);
+    QVERIFY(!QFile::exists(oldJournalFile));
+
+    // journals written after the snapshot still are
+    journal.append(CookieJournal::SetRecord, c);
+    QVERIFY(journal.flush());
+    CookieJournal third;
+    third.setDirectory(directory);
+    QCOMPARE(third.load(), QList<QNetworkCookie>() << a << c);
+
+    removeJournal(directory);
+}
+
+// A snapshot doesn't change once it has been taken
+void tst_CookieJar::snapshot()
+{
+    SubNetworkCookieJar jar;
+    QUrl url("http://www.foo.com/bar/");
+    NetworkCookieJarSnapshot empty = jar.snapshot();
+    QVERIFY(empty.isEmpty());
+
+    jar.call_insertCookie(cookie("a", ".foo.com"));
+    jar.call_insertCookie(cookie("b", "www.foo.com", "/bar"));
+    jar.call_insertCookie(cookie("c", "www.foo.com", "/baz"));
+    NetworkCookieJarSnapshot snapshot = jar.snapshot();
+    QVERIFY(snapshot.generation() > empty.generation());
+    QCOMPARE(snapshot.cookiesForUrl(url), jar.cookiesForUrl(url));
+    QCOMPARE(snapshot.allCookies().count(), 3);
+
+    jar.call_deleteCookie(cookie("a", ".foo.com"));
+    QCOMPARE(snapshot.cookiesForUrl(url).count(), 2);
+    QCOMPARE(jar.cookiesForUrl(url).count(), 1);
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(jar.snapshot().cookiesForUrl(url), jar.cookiesForUrl(url));
+
+    // asking on the thread of the jar publishes pending changes right away
+    jar.call_insertCookie(cookie("d", "www.foo.com"));
+    QCOMPARE(jar.snapshot().allCookies().count(), 3);
+}
+
+// Looks up the cookies of a snapshot until told to stop
+class SnapshotReader : public QThread
+{
+public:
+    SnapshotReader(NetworkCookieJar *jar)
+        : jar(jar), lookups(0), errors(0) {}
+
+    NetworkCookieJar *jar;
+    QAtomicInt stop;
+    int lookups;
+    int errors;
+
+protected:
+    void run()
+    {
+        QUrl url("http://www.foo.com/");
+        int generation = 0;
+        while (stop == 0) {
+            NetworkCookieJarSnapshot snapshot = jar->snapshot();
+            if (snapshot.generation() < generation)
+                ++errors;
+            generation = snapshot.generation();
+
+            // a and b are always changed together
+            QList<QNetworkCookie> cookies = snapshot.cookiesForUrl(url);
+            if (cookies.count() == 2) {
+                if (cookies.at(0).value() != cookies.at(1).value())
+                    ++errors;
+            } else if (!cookies.isEmpty()) {
+                ++errors;
+            }
+            ++lookups;
+        }
+    }
+};
+
+void tst_CookieJar::snapshotStress()
+{
+    SubNetworkCookieJar jar;
+    QList<SnapshotReader*> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.append(new SnapshotReader(&jar));
+        readers.last()->start();
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        QByteArray value = QByteArray::number(i);
+        QNetworkCookie a = cookie("a", ".foo.com");
+        QNetworkCookie b = cookie("b", ".foo.com");
+        a.setValue(value);
+        b.setValue(value);
+        jar.call_insertCookie(a);
+        jar.call_insertCookie(b);
+        jar.call_insertCookie(cookie(QString::number(i), QString("www%1.bar.com").arg(i % 100)));
+        if (i % 3 == 0)
+            jar.call_deleteCookie(cookie(QString::number(i / 2), QString("www%1.bar.com").arg(i / 2 % 100)));
+        if (i % 10 == 0)
+            QCoreApplication::processEvents();
+        else
+            jar.snapshot();
+    }
+
+    foreach (SnapshotReader *reader, readers) {
+        reader->stop = 1;
+        reader->wait();
+        QCOMPARE(reader->errors, 0);
+        QVERIFY(reader->lookups > 0);
+    }
+    qDeleteAll(readers);
+
+    QList<QNetworkCookie> cookies = jar.snapshot().cookiesForUrl(QUrl("http://www.foo.com/"));
+    QCOMPARE(cookies.count(), 2);
+    QCOMPARE(cookies.at(0).value(), QByteArray("1999"));
+}
+
+// Takes one snapshot on its own thread
+class SnapshotTaker : public QThread
+{
+public:
+    SnapshotTaker(NetworkCookieJar *jar)
+        : jar(jar) {}
+
+    NetworkCookieJar *jar;
+    NetworkCookieJarSnapshot snapshot;
+
+protected:
+    void run()
+    {
+        snapshot = jar->snapshot();
+    }
+};
+
+// Once a reader on another thread asks, changes are published from the event loop
+void tst_CookieJar::snapshotOtherThread()
+{
+    SubNetworkCookieJar jar;
+    jar.call_insertCookie(cookie("a", ".foo.com"));
+    QCoreApplication::processEvents();
+
+    SnapshotTaker taker(&jar);
+    taker.start();
+    taker.wait();
+    // nobody asked for the first change yet
+    QVERIFY(taker.snapshot.isEmpty());
+    QCoreApplication::processEvents();
+    taker.start();
+    taker.wait();
+    QCOMPARE(taker.snapshot.allCookies().count(), 1);
+
+    jar.call_insertCookie(cookie("b", ".foo.com"));
+    QCoreApplication::processEvents();
+    taker.start();
+    taker.wait();
+    QCOMPARE(taker.snapshot.allCookies().count(), 2);
+}
+
+// Every field of a cookie survives being packed
+void tst_CookieJar::packedCookies()
+{
+    SubNetworkCookieJar jar;
+    QNetworkCookie a = cookie("a", ".foo.com", "/bar");
+    a.setValue(QByteArray("x\0y", 3));
+    a.setSecure(true);
+    a.setExpirationDate(QDateTime::currentDateTime().addDays(1).addMSecs(123));
+#if QT_VERSION >= 0x040500
+    a.setHttpOnly(true);
+#endif
+    QNetworkCookie b = cookie("", "www.foo.com");
+    QNetworkCookie c = cookie("c", "www.foo.com");
+    c.setValue(QByteArray(1000, 'c'));
+    jar.call_setAllCookies(QList<QNetworkCookie>() << a << b << c);
+
+    QList<QNetworkCookie> cookies = jar.call_allCookies();
+    QCOMPARE(cookies.count(), 3);
+    QVERIFY(cookies.contains(a));
+    QVERIFY(cookies.contains(b));
+    QVERIFY(cookies.contains(c));
+    QCOMPARE(cookies.at(cookies.indexOf(a)).expirationDate(), a.expirationDate());
+    QCOMPARE(cookies.at(cookies.indexOf(a)).isSecure(), true);
+#if QT_VERSION >= 0x040500
+    QCOMPARE(cookies.at(cookies.indexOf(a)).isHttpOnly(), true);
+#endif
+
+    // removed cookies leave room for new ones
+    for (int i = 0; i < 200; ++i) {
+        QNetworkCookie big = cookie(QString::number(i), "www.bar.com");
+        big.setValue(QByteArray(1000, 'a' + i % 26));
+        QVERIFY(jar.call_insertCookie(big));
+        if (i > 0)
+            QVERIFY(jar.call_deleteCookie(cookie(QString::number(i - 1), "www.bar.com")));
+    }
+    cookies = jar.cookiesForUrl(QUrl("http://www.bar.com/"));
+    QCOMPARE(cookies.count(), 1);
+    QCOMPARE(cookies.first().name(), QByteArray("199"));
+    QCOMPARE(cookies.first().value(), QByteArray(1000, 'a' + 199 % 26));
+    QVERIFY(jar.call_allCookies().contains(c));
+}
+
+#if defined(__GLIBC__)
+// Bytes handed out by malloc that have not been freed yet
+static qint64 heapInUse()
+{
+    struct mallinfo info = mallinfo();
+    return qint64(info.uordblks) + info.hblkhd;
+}
+#endif
+
+static QList<QNetworkCookie> memoryUsageCookies()
+{
+    QDateTime expires = QDateTime::currentDateTime().addDays(30);
+    QList<QNetworkCookie> cookies;
+    for (int i = 0; i < 50000; ++i) {
+        QNetworkCookie c = cookie(QString("cookie%1").arg(i % 20),
+                                  QString(".host%1.example%2.com").arg(i / 20).arg(i % 7),
+                                  i % 3 ? QString("/") : QString("/path%1").arg(i % 5));
+        c.setValue(QByteArray::number(i * 7919));
+        if (i % 4)
+            c.setExpirationDate(expires.addSecs(i));
+        cookies.append(c);
+    }
+    return cookies;
+}
+
+/*
+    Measure what the heap holds once the cookies are in the jar and once
+    they are kept as QNetworkCookies in a trie like the jar used to do.
+    The cookies the jar is filled from are gone by the time the heap is
+    measured so nothing is shared with them.
+  */
+void tst_CookieJar::memoryUsage()
+{
+#if defined(__GLIBC__)
+    qint64 start = heapInUse();
+    FlatTrie<QNetworkCookie> *unpacked = new FlatTrie<QNetworkCookie>;
+    int count;
+    {
+        QList<QNetworkCookie> cookies = memoryUsageCookies();
+        count = cookies.count();
+        foreach (const QNetworkCookie &c, cookies)
+            unpacked->insert(c.domain().split(QLatin1Char('.'), QString::SkipEmptyParts), c);
+    }
+    qint64 unpackedBytes = heapInUse() - start;
+    delete unpacked;
+
+    start = heapInUse();
+    SubNetworkCookieJar *jar = new SubNetworkCookieJar;
+    {
+        QList<QNetworkCookie> cookies = memoryUsageCookies();
+        jar->call_setAllCookies(cookies);
+    }
+    qint64 packedBytes = heapInUse() - start;
+    QCOMPARE(jar->call_allCookies().count(), count);
+    qDebug() << "bytes per cookie, unpacked:" << unpackedBytes / count
+             << "packed:" << packedBytes / count
+             << "estimated:" << jar->memoryUsage() / count;
+    delete jar;
+
+    QVERIFY(packedBytes < unpackedBytes);
+#else
+    QSKIP("Measuring the heap needs glibc", SkipAll);
+#endif
+}
+
+/*
+    A published snapshot shares the tree with the jar, which then has to
+    copy it on the next change.  Without anyone asking for a snapshot
+    nothing is published and changes are made in place.
+  */
+void tst_CookieJar::snapshotNotCopied()
+{
+#if defined(__GLIBC__)
+    SubNetworkCookieJar jar;
+    {
+        QList<QNetworkCookie> cookies;
+        for (int i = 0; i < 50000; ++i)
+            cookies.append(cookie(QString("cookie%1").arg(i % 20), QString(".host%1.example.com").arg(i / 20)));
+        jar.call_setAllCookies(cookies);
+    }
+    // one that lets containers that are just full grow first
+    jar.call_insertCookie(cookie("first", ".host0.example.com"));
+    QCoreApplication::processEvents();
+    int jarBytes = jar.memoryUsage();
+
+    qint64 start = heapInUse();
+    jar.call_insertCookie(cookie("new", ".host1.example.com"));
+    QCoreApplication::processEvents();
+    jar.call_insertCookie(cookie("newer", ".host2.example.com"));
+    qint64 inPlace = heapInUse() - start;
+    QVERIFY(inPlace < jarBytes / 10);
+
+    // a snapshot that is held on to keeps what it has
+    NetworkCookieJarSnapshot snapshot = jar.snapshot();
+    start = heapInUse();
+    jar.call_insertCookie(cookie("newest", ".host3.example.com"));
+    qint64 copied = heapInUse() - start;
+    qDebug() << "bytes used by an insert, in place:" << inPlace << "copying:" << copied;
+    QVERIFY(copied > jarBytes / 10);
+    QCOMPARE(snapshot.allCookies().count(), 50003);
+#else
+    QSKIP("Measuring the heap needs glibc", SkipAll);
+#endif
+}
+
+void tst_CookieJar::packedLookupBenchmark()
+{
+    QList<QNetworkCookie> cookies;
+    for (int i = 0; i < 50000; ++i)
+        cookies.append(cookie(QString("cookie%1").arg(i % 20), QString(".host%1.example.com").arg(i / 20)));
+    SubNetworkCookieJar jar;
+    jar.call_setAllCookies(cookies);
+    NetworkCookieJarSnapshot snapshot = jar.snapshot();
+
+    QList<QUrl> urls;
+    for (int i = 0; i < 100; ++i)
+        urls.append(QUrl(QString("http://www.host%1.example.com/").arg(i * 17)));
+    int found = 0;
+    QBENCHMARK {
+        foreach (const QUrl &url, urls)
+            found += snapshot.cookiesForUrl(url).count();
+    }
+    QVERIFY(found > 0);
+}
+
 QTEST_MAIN(tst_CookieJar)
 #include "tst_cookiejar.moc"
 
@@ -18,6 +18,7 @@
  */
 
 #include <QtTest/QtTest>
+#include <QtGui/QtGui>
 #include <history.h>
 #include <historymanager.h>
 
@@ -48,6 +49,12 @@ private slots:
 
     void removeRows_data();
     void removeRows();
+
+    void addRowIncremental();
+    void removeRowsIncremental_data();
+    void removeRowsIncremental();
+    void removeOldestRows();
+    void insertRowsIncremental();
 };
 
 // Subclass that exposes the protected functions.
@@ -330,6 +337,179 @@ void tst_HistoryFilterModel::removeRows()
     QCOMPARE(model.rowCount(), count);
 }
 
+// 40 visits to 10 urls, so most of the rows are hidden duplicates
+static HistoryList makeDuplicateList()
+{
+    HistoryList list;
+    QDateTime now = QDateTime::currentDateTime();
+    for (int i = 0; i < 40; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 10), now.addSecs(-i * 60)));
+    return list;
+}
+
+// A model that was kept up to date has to match one that loads from scratch
+static bool sameAsLoaded(HistoryFilterModel *model)
+{
+    HistoryFilterModel loaded(model->sourceModel());
+    if (model->rowCount() != loaded.rowCount())
+        return false;
+    for (int i = 0; i < loaded.rowCount(); ++i) {
+        QModelIndex idx = model->index(i, 0);
+        QString url = idx.data(HistoryModel::UrlStringRole).toString();
+        if (url != loaded.index(i, 0).data(HistoryModel::UrlStringRole).toString())
+            return false;
+        if (model->mapFromSource(model->mapToSource(idx)) != idx)
+            return false;
+        if (model->historyLocation(url) != loaded.historyLocation(url))
+            return false;
+    }
+    return true;
+}
+
+// New visits move the row of their url to the top without a reset
+void tst_HistoryFilterModel::addRowIncremental()
+{
+    SubHistoryFilterModel model;
+    model.history->setHistory(makeDuplicateList());
+    QCOMPARE(model.rowCount(), 10);
+
+    QSignalSpy resetSpy(&model, SIGNAL(modelReset()));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)));
+    QSignalSpy insertedSpy(&model, SIGNAL(rowsInserted(const QModelIndex &, int, int)));
+
+    model.history->addHistoryEntry("http://5.com/");
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 5);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(model.rowCount(), 10);
+
+    model.history->addHistoryEntry("http://new.com/");
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(insertedSpy.count(), 2);
+    QCOMPARE(model.rowCount(), 11);
+
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(sameAsLoaded(&model));
+}
+
+void tst_HistoryFilterModel::removeRowsIncremental_data()
+{
+    QTest::addColumn<int>("start");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("removed");
+    QTest::addColumn<int>("inserted");
+
+    // the older duplicates of removed rows take their place
+    QTest::newRow("newest") << 0 << 3 << 1 << 3;
+    QTest::newRow("one") << 7 << 1 << 1 << 1;
+    QTest::newRow("middle") << 10 << 5 << 0 << 0;
+    QTest::newRow("oldest") << 35 << 5 << 0 << 0;
+    QTest::newRow("all") << 0 << 40 << 1 << 0;
+}
+
+// Removing rows from the history model goes through the history manager
+void tst_HistoryFilterModel::removeRowsIncremental()
+{
+    QFETCH(int, start);
+    QFETCH(int, count);
+    QFETCH(int, removed);
+    QFETCH(int, inserted);
+
+    HistoryList list = makeDuplicateList();
+    SubHistoryFilterModel model;
+    model.history->setHistory(list);
+    QCOMPARE(model.rowCount(), 10);
+
+    QSignalSpy resetSpy(&model, SIGNAL(modelReset()));
+    QSignalSpy historyResetSpy(model.history, SIGNAL(historyReset()));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)));
+    QSignalSpy insertedSpy(&model, SIGNAL(rowsInserted(const QModelIndex &, int, int)));
+
+    QVERIFY(model.historyModel->removeRows(start, count));
+    QCOMPARE(model.history->history(), list.mid(0, start) + list.mid(start + count));
+    QCOMPARE(model.historyModel->rowCount(), list.count() - count);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(historyResetSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), removed);
+    QCOMPARE(insertedSpy.count(), inserted);
+    QVERIFY(sameAsLoaded(&model));
+
+    QVERIFY(!model.historyModel->removeRows(0, list.count() + 1));
+}
+
+// Expiring a large block of urls that were not visited again doesn't start over
+void tst_HistoryFilterModel::removeOldestRows()
+{
+    HistoryList list;
+    QDateTime now = QDateTime::currentDateTime();
+    for (int i = 0; i < 200; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i), now.addSecs(-i * 60)));
+    SubHistoryFilterModel model;
+    model.history->setHistory(list);
+    QCOMPARE(model.rowCount(), 200);
+
+    QSignalSpy resetSpy(&model, SIGNAL(modelReset()));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)));
+    QSignalSpy insertedSpy(&model, SIGNAL(rowsInserted(const QModelIndex &, int, int)));
+
+    QVERIFY(model.historyModel->removeRows(50, 150));
+    QCOMPARE(model.rowCount(), 50);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(insertedSpy.count(), 0);
+    QVERIFY(sameAsLoaded(&model));
+}
+
+static QList<QStandardItem*> urlItems(const HistoryList &list)
+{
+    QList<QStandardItem*> items;
+    foreach (const HistoryEntry &entry, list) {
+        QStandardItem *item = new QStandardItem(entry.url);
+        item->setData(entry.url, HistoryModel::UrlStringRole);
+        items.append(item);
+    }
+    return items;
+}
+
+// Blocks of older rows at the bottom and newer rows at the top are added without a reset
+void tst_HistoryFilterModel::insertRowsIncremental()
+{
+    HistoryList list = makeDuplicateList();
+    QStandardItemModel source;
+    QStandardItem *root = source.invisibleRootItem();
+    root->insertRows(0, urlItems(list.mid(0, 5)));
+    HistoryFilterModel model(&source);
+    QCOMPARE(model.rowCount(), 5);
+
+    QSignalSpy resetSpy(&model, SIGNAL(modelReset()));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)));
+    QSignalSpy insertedSpy(&model, SIGNAL(rowsInserted(const QModelIndex &, int, int)));
+
+    // only the urls that weren't there yet show up, at the end
+    root->insertRows(source.rowCount(), urlItems(list.mid(5)));
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 5);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 9);
+    QVERIFY(sameAsLoaded(&model));
+
+    // newer rows hide the older rows of their url
+    HistoryList newer;
+    newer.append(HistoryEntry("http://new.com/", QDateTime()));
+    newer.append(HistoryEntry("http://3.com/", QDateTime()));
+    root->insertRows(0, urlItems(newer));
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 3);
+    QCOMPARE(insertedSpy.count(), 3);
+    QCOMPARE(model.rowCount(), 11);
+    QCOMPARE(model.index(0, 0).data(HistoryModel::UrlStringRole).toString(), QString("http://new.com/"));
+    QCOMPARE(model.index(1, 0).data(HistoryModel::UrlStringRole).toString(), QString("http://3.com/"));
+
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(sameAsLoaded(&model));
+}
+
 QTEST_MAIN(tst_HistoryFilterModel)
 #include "tst_historyfiltermodel.moc"
 
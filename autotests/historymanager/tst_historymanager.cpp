@@ -21,8 +21,11 @@
 #include "qtest_arora.h"
 
 #include <historymanager.h>
+#include <historysearchindex.h>
+#include <historystore.h>
 #include <history.h>
 #include <modeltest.h>
+#include <qdesktopservices.h>
 
 class tst_HistoryManager : public QObject
 {
@@ -41,6 +44,12 @@ private slots:
     void addHistoryEntry();
     void updateHistoryEntry_data();
     void updateHistoryEntry();
+    void removeHistoryEntry();
+    void removeHistoryEntries();
+    void removeHistoryEntriesFromDisk();
+    void rankTree();
+    void urlIndex_data();
+    void urlIndex();
     void daysToExpire_data();
     void daysToExpire();
     void clear_data();
@@ -49,6 +58,16 @@ private slots:
     void setHistory();
     void saveload_data();
     void saveload();
+    void store();
+    void loadInBackground();
+    void loadInBackgroundEdits();
+    void historyTreeModel();
+    void urlEntries();
+    void urlEntriesRemoved();
+    void searchIndex();
+    void historyProxyModel();
+    void filterLatency_data();
+    void filterLatency();
 
     // TODO move to their own tests
     void big();
@@ -64,7 +83,7 @@ private:
 class SubHistory : public HistoryManager
 {
 public:
-    SubHistory() : HistoryManager()
+    SubHistory(LoadMode mode = LoadNow) : HistoryManager(0, mode)
     {
         QWidget w;
         setParent(&w);
@@ -81,6 +100,16 @@ public:
         { HistoryManager::addHistoryEntry(item); }
 };
 
+// The linear search updateHistoryEntry() did before the history was indexed by url
+static int scanNewestPosition(const QList<HistoryEntry> &history, const QUrl &url)
+{
+    for (int i = 0; i < history.count(); ++i) {
+        if (url == history.at(i).url)
+            return i;
+    }
+    return -1;
+}
+
 // This will be called before the first test function is executed.
 // It is only called once.
 void tst_HistoryManager::initTestCase()
@@ -231,6 +260,232 @@ void tst_HistoryManager::updateHistoryEntry()
         QVERIFY(history.history() != list);
 }
 
+// public void removeHistoryEntry(QUrl const& url, QString const& title)
+void tst_HistoryManager::removeHistoryEntry()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryEntry foo1("http://foo.com", now.addSecs(-30), "Foo 1");
+    HistoryEntry bar("http://bar.com", now.addSecs(-20), "Bar");
+    HistoryEntry foo2("http://foo.com", now.addSecs(-10), "Foo 2");
+
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(HistoryList() << foo2 << bar << foo1);
+
+    // the newest entry of a url gets the title
+    history.updateHistoryEntry(QUrl("http://foo.com"), "Foo 3");
+    foo2.title = "Foo 3";
+    QCOMPARE(history.history(), HistoryList() << foo2 << bar << foo1);
+
+    // a title picks out an older entry
+    history.removeHistoryEntry(QUrl("http://foo.com"), "Foo 1");
+    QCOMPARE(history.history(), HistoryList() << foo2 << bar);
+    history.removeHistoryEntry(QUrl("http://foo.com"), "Foo 1");
+    QCOMPARE(history.history(), HistoryList() << foo2 << bar);
+
+    HistoryEntry baz("http://baz.com", now, "Baz");
+    history.addHistoryEntry(baz);
+    history.removeHistoryEntry(QUrl("http://foo.com"));
+    QCOMPARE(history.history(), HistoryList() << baz << bar);
+
+    history.updateHistoryEntry(QUrl("http://bar.com"), "Bar 2");
+    bar.title = "Bar 2";
+    QCOMPARE(history.history(), HistoryList() << baz << bar);
+
+    history.updateHistoryEntry(QUrl("http://foo.com"), "Foo 4");
+    QCOMPARE(history.history(), HistoryList() << baz << bar);
+
+    history.removeHistoryEntry(QUrl("http://baz.com"));
+    history.removeHistoryEntry(QUrl("http://bar.com"));
+    QVERIFY(history.history().isEmpty());
+}
+
+// Ranges are removed in one go and stay removed after loading again
+void tst_HistoryManager::removeHistoryEntries()
+{
+    QSettings settings;
+    settings.remove(QLatin1String("history/expiredBefore"));
+
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryList list;
+    for (int i = 0; i < 100; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 10), now.addSecs(-i * 60)));
+    {
+        SubHistory history;
+        history.setHistory(list);
+    }
+
+    HistoryList expected;
+    {
+        SubHistory history;
+        history.setDaysToExpire(-1);
+        QCOMPARE(history.history(), list);
+        ModelTest test(history.historyFilterModel());
+        QCOMPARE(history.historyFilterModel()->rowCount(), 10);
+        QSignalSpy spy(&history, SIGNAL(entriesAboutToBeRemoved(int, int)));
+
+        // a block in the middle only removes hidden duplicates
+        history.removeHistoryEntries(now.addSecs(-50 * 60), now.addSecs(-20 * 60));
+        QCOMPARE(spy.count(), 1);
+        QCOMPARE(spy.at(0).at(0).toInt(), 21);
+        QCOMPARE(spy.at(0).at(1).toInt(), 30);
+        QCOMPARE(history.history().count(), 70);
+        QCOMPARE(history.historyModel()->rowCount(), 70);
+        QCOMPARE(history.historyFilterModel()->rowCount(), 10);
+
+        // the newest ten minutes
+        history.removeHistoryEntries(now.addSecs(-10 * 60));
+        QCOMPARE(spy.count(), 2);
+        QCOMPARE(history.history().count(), 59);
+        QCOMPARE(history.historyFilterModel()->rowCount(), 10);
+
+        // everything before an hour and a half ago, like expiring does
+        history.removeHistoryEntries(QDateTime(), now.addSecs(-90 * 60));
+        QCOMPARE(spy.count(), 3);
+        QCOMPARE(history.historyModel()->rowCount(), 50);
+
+        for (int i = 0; i < list.count(); ++i) {
+            if ((i > 10 && i <= 20) || (i > 50 && i <= 90))
+                expected.append(list.at(i));
+        }
+        QCOMPARE(history.history(), expected);
+        QCOMPARE(history.urlEntry("http://1.com/").visitCount, 5);
+
+        // a visit after a range removal is kept
+        HistoryEntry newer("http://new.com/", now.addSecs(1));
+        history.addHistoryEntry(newer);
+        expected.prepend(newer);
+    }
+
+    SubHistory history;
+    QCOMPARE(history.history(), expected);
+    history.clear();
+    settings.remove(QLatin1String("history/expiredBefore"));
+}
+
+// Removing a range takes the visits out of the files too, not just out of sight
+void tst_HistoryManager::removeHistoryEntriesFromDisk()
+{
+    QSettings settings;
+    settings.remove(QLatin1String("history/expiredBefore"));
+
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryEntry secret("http://secret.com/", now.addSecs(-60));
+    HistoryEntry kept("http://kept.com/", now.addSecs(-3600));
+    {
+        SubHistory history;
+        history.setHistory(HistoryList() << secret << kept);
+    }
+    {
+        SubHistory history;
+        history.removeHistoryEntries(now.addSecs(-10 * 60));
+        QCOMPARE(history.history(), HistoryList() << kept);
+    }
+
+    // the url the way QDataStream writes it, without the length
+    QByteArray written;
+    QDataStream stream(&written, QIODevice::WriteOnly);
+    stream << secret.url;
+    written.remove(0, 4);
+    QDir directory(QDesktopServices::storageLocation(QDesktopServices::DataLocation)
+                   + QLatin1String("/historystore"));
+    foreach (const QString &fileName, directory.entryList(QDir::Files)) {
+        QFile file(directory.filePath(fileName));
+        QVERIFY(file.open(QFile::ReadOnly));
+        QVERIFY2(!file.readAll().contains(written), qPrintable(fileName));
+    }
+
+    SubHistory history;
+    QCOMPARE(history.history(), HistoryList() << kept);
+    history.clear();
+}
+
+// Check the tree against a plain list of values while appending and adding
+void tst_HistoryManager::rankTree()
+{
+    HistoryRankTree tree;
+    QList<int> values;
+    for (int i = 0; i < 500; ++i) {
+        if (values.isEmpty() || qrand() % 3 == 0) {
+            int value = qrand() % 3;
+            tree.append(value);
+            values.append(value);
+        } else {
+            int index = qrand() % values.count();
+            int delta = (values.at(index) > 0 && qrand() % 2) ? -1 : 1;
+            tree.add(index + 1, delta);
+            values[index] += delta;
+        }
+    }
+
+    QCOMPARE(tree.size(), values.count());
+    int sum = 0;
+    for (int i = 0; i < values.count(); ++i) {
+        QCOMPARE(tree.value(i + 1), values.at(i));
+        sum += values.at(i);
+        QCOMPARE(tree.prefix(i + 1), sum);
+        if (values.at(i) > 0)
+            QCOMPARE(tree.find(sum), i + 1);
+    }
+    QCOMPARE(tree.total(), sum);
+
+    tree.clear();
+    QCOMPARE(tree.size(), 0);
+    QCOMPARE(tree.total(), 0);
+    tree.append(2);
+    QCOMPARE(tree.find(1), 1);
+    QCOMPARE(tree.find(2), 1);
+}
+
+void tst_HistoryManager::urlIndex_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("scan");
+
+    QTest::newRow("100k-index") << 100000 << false;
+    QTest::newRow("100k-scan") << 100000 << true;
+    QTest::newRow("1M-index") << 1000000 << false;
+    QTest::newRow("1M-scan") << 1000000 << true;
+}
+
+/*
+    Compare updating the title of the oldest entry through the url index
+    with finding it using the linear search that updateHistoryEntry() used
+    to do, which doesn't even include setting the title.
+  */
+void tst_HistoryManager::urlIndex()
+{
+    QFETCH(int, count);
+    QFETCH(bool, scan);
+
+    HistoryList list;
+    QDateTime dateTime = QDateTime::currentDateTime();
+    for (int i = 0; i < count; ++i) {
+        list.append(HistoryEntry(QString("http://host-%1.com/").arg(i), dateTime));
+        dateTime = dateTime.addMSecs(-1);
+    }
+    QUrl url(list.last().url);
+
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(list, true);
+
+    if (scan) {
+        HistoryList entries = history.history();
+        int position = -1;
+        QBENCHMARK {
+            position = scanNewestPosition(entries, url);
+        }
+        QCOMPARE(position, count - 1);
+    } else {
+        QBENCHMARK {
+            history.updateHistoryEntry(url, QLatin1String("title"));
+        }
+        QCOMPARE(history.history().last().title, QString("title"));
+    }
+    history.clear();
+}
+
 void tst_HistoryManager::daysToExpire_data()
 {
     QTest::addColumn<HistoryList>("list");
@@ -395,6 +650,535 @@ void tst_HistoryManager::saveload()
     }
 }
 
+void tst_HistoryManager::store()
+{
+    QString directory = QDir::tempPath() + QLatin1String("/historystoretest");
+    HistoryStore store;
+    store.setDirectory(directory);
+    store.clear();
+
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryEntry foo("http://foo.com", now.addSecs(-20), "Foo");
+    HistoryEntry bar("http://bar.com", now.addSecs(-10), "Bar");
+    HistoryEntry baz("http://baz.com", now, "Baz");
+    QVERIFY(store.append(HistoryList() << foo << bar));
+    QVERIFY(store.append(HistoryStore::TitleRecord, HistoryEntry(foo.url, foo.dateTime, "Foo2")));
+    QVERIFY(store.append(HistoryList() << baz));
+    QVERIFY(store.append(HistoryStore::RemovalRecord, bar));
+    foo.title = "Foo2";
+
+    HistoryStore other;
+    other.setDirectory(directory);
+    QCOMPARE(other.load(QDateTime()), HistoryList() << baz << foo);
+    QCOMPARE(other.load(now.addSecs(-5)), HistoryList() << baz);
+
+    // a partially written record is dropped
+    QFile file(directory + QLatin1String("/segment-1.log"));
+    QVERIFY(file.open(QFile::WriteOnly | QFile::Append));
+    file.write("garbage");
+    file.close();
+    QCOMPARE(other.load(QDateTime()), HistoryList() << baz << foo);
+
+    // compaction replaces every segment
+    QVERIFY(other.compact(HistoryList() << baz << foo));
+    QDir dir(directory);
+    QCOMPARE(dir.entryList(QStringList(QLatin1String("segment-*.log"))).count(), 1);
+    QCOMPARE(other.load(QDateTime()), HistoryList() << baz << foo);
+
+    other.clear();
+    QVERIFY(other.isEmpty());
+}
+
+// A tree model that was kept up to date has to match one that loads from scratch
+static bool sameAsLoaded(HistoryTreeModel *model)
+{
+    HistoryTreeModel fresh(model->sourceModel());
+    if (model->rowCount() != fresh.rowCount())
+        return false;
+    for (int i = 0; i < model->rowCount(); ++i) {
+        QModelIndex date = model->index(i, 0);
+        QModelIndex freshDate = fresh.index(i, 0);
+        if (date.data(HistoryModel::DateRole) != freshDate.data(HistoryModel::DateRole))
+            return false;
+        if (model->rowCount(date) != fresh.rowCount(freshDate))
+            return false;
+        for (int j = 0; j < model->rowCount(date); ++j) {
+            if (model->index(j, 1, date).data().toString()
+                != fresh.index(j, 1, freshDate).data().toString())
+                return false;
+        }
+    }
+    return true;
+}
+
+void tst_HistoryManager::loadInBackground()
+{
+    QSettings settings;
+    settings.remove(QLatin1String("history/expiredBefore"));
+
+    HistoryList list;
+    QDateTime dateTime = QDateTime::currentDateTime();
+    for (int i = 0; i < 3000; ++i) {
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 1000), dateTime, QString("title %1").arg(i)));
+        dateTime = dateTime.addSecs(-60);
+    }
+    {
+        SubHistory history;
+        history.setHistory(list);
+    }
+
+    SubHistory history(HistoryManager::LoadInBackground);
+    QSignalSpy spy(&history, SIGNAL(entriesLoaded(int, int)));
+    QSignalSpy urlResetSpy(&history, SIGNAL(urlEntriesReset()));
+    HistoryFilterModel *filterModel = history.historyFilterModel();
+    ModelTest test(filterModel);
+    QSignalSpy filterResetSpy(filterModel, SIGNAL(modelReset()));
+    QCOMPARE(filterModel->rowCount(), 0);
+    HistoryTreeModel *treeModel = history.historyTreeModel();
+    ModelTest treeTest(treeModel);
+    QSignalSpy treeResetSpy(treeModel, SIGNAL(modelReset()));
+    QCOMPARE(treeModel->rowCount(), 0);
+    QTRY_VERIFY(!history.isLoading());
+
+    // the newest entries come first and the rest in larger batches,
+    // each one is added after the last without starting over
+    QVERIFY(spy.count() > 1);
+    int offset = 0;
+    for (int i = 0; i < spy.count(); ++i) {
+        QCOMPARE(spy.at(i).at(0).toInt(), offset);
+        offset += spy.at(i).at(1).toInt();
+    }
+    QCOMPARE(offset, list.count());
+    QCOMPARE(urlResetSpy.count(), 0);
+    QCOMPARE(filterResetSpy.count(), 0);
+    QCOMPARE(treeResetSpy.count(), 0);
+    QVERIFY(sameAsLoaded(treeModel));
+
+    QCOMPARE(history.history(), list);
+    QCOMPARE(history.historyModel()->rowCount(), list.count());
+    QCOMPARE(history.historyUrlModel()->rowCount(), 1000);
+    QCOMPARE(filterModel->rowCount(), 1000);
+    for (int i = 0; i < filterModel->rowCount(); ++i) {
+        QModelIndex idx = filterModel->index(i, 0);
+        QCOMPARE(idx.data(HistoryModel::UrlStringRole).toString(), list.at(i).url);
+        QCOMPARE(filterModel->mapToSource(idx).row(), i);
+    }
+
+    // WebKit is answered from what has been read without waiting
+    SubHistory other(HistoryManager::LoadInBackground);
+    other.historyContains(list.last().url);
+    QVERIFY(other.isLoading());
+    QTRY_VERIFY(other.historyContains(list.last().url));
+    QVERIFY(!other.historyContains(QLatin1String("http://never.visited/")));
+    QTRY_VERIFY(!other.isLoading());
+    QVERIFY(other.historyContains(list.last().url));
+    QCOMPARE(other.history(), list);
+}
+
+// Changes to entries that are not loaded yet are made once they are
+void tst_HistoryManager::loadInBackgroundEdits()
+{
+    QSettings settings;
+    settings.remove(QLatin1String("history/expiredBefore"));
+
+    HistoryList list;
+    QDateTime now = QDateTime::currentDateTime();
+    for (int i = 0; i < 100; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 10), now.addSecs(-i * 60), QString("title %1").arg(i)));
+    {
+        SubHistory history;
+        history.setHistory(list);
+    }
+
+    HistoryList expected = list;
+    expected[0].title = "new title";
+    for (int i = 99; i >= 90; --i)
+        expected.removeAt(i);
+    expected.removeAt(55);
+    expected.removeAt(3);
+    {
+        SubHistory history(HistoryManager::LoadInBackground);
+        QVERIFY(history.isLoading());
+        QVERIFY(history.history().isEmpty());
+        history.updateHistoryEntry(QUrl(list.at(0).url), "new title");
+        history.removeHistoryEntry(list.at(55));
+        history.removeHistoryEntry(QUrl(list.at(3).url));
+        history.removeHistoryEntries(list.at(99).dateTime, list.at(89).dateTime);
+        QTRY_VERIFY(!history.isLoading());
+        QCOMPARE(history.history(), expected);
+        QCOMPARE(history.urlEntry(list.at(0).url).title, QString("new title"));
+    }
+
+    // and they are saved
+    SubHistory history;
+    QCOMPARE(history.history(), expected);
+}
+
+// The dates of the tree model follow the history without being rebuilt
+void tst_HistoryManager::historyTreeModel()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryList list;
+    for (int i = 0; i < 20; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i), now.addSecs(-i * 6 * 60 * 60)));
+
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(list);
+    HistoryTreeModel *model = history.historyTreeModel();
+    ModelTest test(model);
+    int dates = model->rowCount();
+    QVERIFY(dates > 1);
+
+    history.addHistoryEntry(HistoryEntry("http://new.com/", now.addSecs(1)));
+    history.removeHistoryEntry(QUrl("http://7.com/"));
+    history.removeHistoryEntry(QUrl("http://19.com/"));
+    history.addHistoryEntry(HistoryEntry("http://3.com/", now.addSecs(2)));
+    // removing a date's pages removes the date
+    QModelIndex last = model->index(model->rowCount() - 1, 0);
+    QVERIFY(model->removeRows(0, model->rowCount(last), last));
+    QVERIFY(sameAsLoaded(model));
+
+    // a date that was removed comes back in its place
+    dates = model->rowCount();
+    QVERIFY(model->removeRows(0, 1));
+    QCOMPARE(model->rowCount(), dates - 1);
+    history.addHistoryEntry(HistoryEntry("http://again.com/", now.addSecs(3)));
+    QCOMPARE(model->rowCount(), dates);
+    QCOMPARE(model->index(0, 0).data(HistoryModel::DateRole).toDate(), now.addSecs(3).date());
+    QVERIFY(sameAsLoaded(model));
+
+    // a range over several dates takes the ends of the dates it starts and stops in
+    QSignalSpy resetSpy(model, SIGNAL(modelReset()));
+    history.removeHistoryEntries(list.at(12).dateTime, list.at(5).dateTime);
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(sameAsLoaded(model));
+
+    QVERIFY(model->removeRows(0, model->rowCount()));
+    QCOMPARE(model->rowCount(), 0);
+    QVERIFY(history.history().isEmpty());
+}
+
+// The per url table follows visits, removals and title updates
+void tst_HistoryManager::urlEntries()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryEntry foo1("http://foo.com", now.addSecs(-30), "Foo 1");
+    HistoryEntry bar("http://bar.com", now.addSecs(-20), "Bar");
+    HistoryEntry foo2("http://foo.com", now.addSecs(-10), "Foo 2");
+
+    {
+        SubHistory history;
+        history.setHistory(HistoryList() << foo2 << bar << foo1);
+        HistoryUrlModel *model = history.historyUrlModel();
+        ModelTest test(model);
+        QCOMPARE(history.urlEntryCount(), 2);
+        QCOMPARE(model->rowCount(), 2);
+
+        HistoryUrlEntry foo = history.urlEntry("http://foo.com");
+        QCOMPARE(foo.visitCount, 2);
+        QCOMPARE(foo.typedCount, 0);
+        QCOMPARE(foo.firstVisit, foo1.dateTime);
+        QCOMPARE(foo.lastVisit, foo2.dateTime);
+        QCOMPARE(foo.title, QString("Foo 2"));
+        // rows are in the order the urls were first visited
+        QCOMPARE(history.urlEntryAt(0).url, foo1.url);
+        QCOMPARE(history.urlEntryAt(1).url, bar.url);
+
+        history.setTypedUrl(QUrl("http://baz.com"));
+        HistoryManager *manager = &history;
+        manager->addHistoryEntry(QString("http://baz.com"));
+        manager->addHistoryEntry(QString("http://baz.com"));
+        QCOMPARE(model->rowCount(), 3);
+        QCOMPARE(model->index(2, 1).data().toString(), QString("http://baz.com"));
+        QCOMPARE(model->index(2, 0).data(HistoryUrlModel::VisitCountRole).toInt(), 2);
+        QCOMPARE(model->index(2, 0).data(HistoryUrlModel::TypedCountRole).toInt(), 1);
+
+        history.updateHistoryEntry(QUrl("http://baz.com"), "Baz");
+        QCOMPARE(history.urlEntry("http://baz.com").title, QString("Baz"));
+
+        // removing the newest visit brings back the one before it
+        history.removeHistoryEntry(QUrl("http://foo.com"), "Foo 2");
+        foo = history.urlEntry("http://foo.com");
+        QCOMPARE(foo.visitCount, 1);
+        QCOMPARE(foo.firstVisit, foo1.dateTime);
+        QCOMPARE(foo.lastVisit, foo1.dateTime);
+        QCOMPARE(foo.title, QString("Foo 1"));
+
+        history.removeHistoryEntry(QUrl("http://bar.com"));
+        QCOMPARE(model->rowCount(), 2);
+        QCOMPARE(history.urlEntry("http://bar.com").visitCount, 0);
+        QCOMPARE(history.urlEntryAt(1).url, QString("http://baz.com"));
+    }
+
+    // typed counts are kept when the history is loaded again
+    SubHistory history;
+    QCOMPARE(history.urlEntryCount(), 2);
+    QCOMPARE(history.urlEntry("http://baz.com").visitCount, 2);
+    QCOMPARE(history.urlEntry("http://baz.com").typedCount, 1);
+    QCOMPARE(history.urlEntry("http://foo.com").visitCount, 1);
+
+    SubHistory background(HistoryManager::LoadInBackground);
+    background.waitForLoaded();
+    QCOMPARE(background.urlEntry("http://baz.com").typedCount, 1);
+
+    history.clear();
+    QCOMPARE(history.urlEntryCount(), 0);
+    QCOMPARE(history.historyUrlModel()->rowCount(), 0);
+}
+
+// Compare the url table with one worked out from the visits
+static bool urlTableMatches(HistoryManager *history)
+{
+    QHash<QString, HistoryUrlEntry> entries;
+    foreach (const HistoryEntry &item, history->history()) {
+        HistoryUrlEntry &entry = entries[item.url];
+        if (!entry.visitCount) {
+            entry.lastVisit = item.dateTime;
+            entry.firstVisit = item.dateTime;
+        }
+        ++entry.visitCount;
+        entry.firstVisit = qMin(entry.firstVisit, item.dateTime);
+        entry.lastVisit = qMax(entry.lastVisit, item.dateTime);
+    }
+    if (history->urlEntryCount() != entries.count())
+        return false;
+    for (int i = 0; i < history->urlEntryCount(); ++i) {
+        HistoryUrlEntry entry = history->urlEntryAt(i);
+        HistoryUrlEntry expected = entries.value(entry.url);
+        if (entry.visitCount != expected.visitCount
+            || entry.firstVisit != expected.firstVisit
+            || entry.lastVisit != expected.lastVisit)
+            return false;
+    }
+    return true;
+}
+
+// Removing blocks of visits updates or removes single urls, no resets
+void tst_HistoryManager::urlEntriesRemoved()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    HistoryList list;
+    for (int i = 0; i < 100; ++i)
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 10), now.addSecs(-i * 60)));
+
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(list);
+    HistoryUrlModel *model = history.historyUrlModel();
+    ModelTest test(model);
+    QCOMPARE(model->rowCount(), 10);
+
+    QSignalSpy resetSpy(&history, SIGNAL(urlEntriesReset()));
+    QSignalSpy updatedSpy(&history, SIGNAL(urlEntryUpdated(int)));
+    QSignalSpy removedSpy(&history, SIGNAL(urlEntryAboutToBeRemoved(int)));
+
+    // one update per url, not per visit
+    history.removeHistoryEntries(now.addSecs(-50 * 60), now.addSecs(-20 * 60));
+    QCOMPARE(updatedSpy.count(), 10);
+    QVERIFY(urlTableMatches(&history));
+
+    // the newest and the oldest visits give new dates
+    history.removeHistoryEntries(now.addSecs(-5 * 60));
+    QVERIFY(urlTableMatches(&history));
+    history.removeHistoryEntries(QDateTime(), now.addSecs(-85 * 60));
+    QVERIFY(urlTableMatches(&history));
+    QCOMPARE(removedSpy.count(), 0);
+
+    history.historyModel()->removeRows(0, history.history().count());
+    QCOMPARE(removedSpy.count(), 10);
+    QCOMPARE(model->rowCount(), 0);
+    QCOMPARE(resetSpy.count(), 0);
+    history.clear();
+}
+
+void tst_HistoryManager::searchIndex()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(HistoryList()
+                       << HistoryEntry("http://foo.com/a", now, "Apple Pie")
+                       << HistoryEntry("http://bar.com/", now.addSecs(-1), "Banana")
+                       << HistoryEntry("http://baz.org/apple", now.addSecs(-2), "Cherry"));
+
+    HistorySearchIndex index(&history);
+    QVERIFY(index.matches("http://bar.com/"));
+    QCOMPARE(index.matchCount(), 3);
+
+    // titles and urls, ignoring case
+    index.setQuery("APP");
+    QCOMPARE(index.matchCount(), 2);
+    QVERIFY(index.matches("http://foo.com/a"));
+    QVERIFY(!index.matches("http://bar.com/"));
+    QVERIFY(index.matches("http://baz.org/apple"));
+
+    // a longer query narrows the previous matches
+    index.setQuery("apple");
+    QCOMPARE(index.matchCount(), 2);
+    index.setQuery("apple p");
+    QCOMPARE(index.matchCount(), 1);
+    QVERIFY(index.matches("http://foo.com/a"));
+
+    // queries shorter than a trigram
+    index.setQuery("ba");
+    QCOMPARE(index.matchCount(), 2);
+    QVERIFY(index.matches("http://bar.com/"));
+    QVERIFY(index.matches("http://baz.org/apple"));
+
+    // changes to the history show up in the current matches
+    index.setQuery("zoo");
+    QCOMPARE(index.matchCount(), 0);
+    history.updateHistoryEntry(QUrl("http://bar.com/"), "Zoo");
+    QVERIFY(index.matches("http://bar.com/"));
+    history.addHistoryEntry(HistoryEntry("http://zoo.net/", now.addSecs(1)));
+    QVERIFY(index.matches("http://zoo.net/"));
+    QCOMPARE(index.matchCount(), 2);
+    history.removeHistoryEntry(QUrl("http://bar.com/"));
+    QVERIFY(!index.matches("http://bar.com/"));
+    QCOMPARE(index.matchCount(), 1);
+
+    history.clear();
+    QCOMPARE(index.matchCount(), 0);
+    index.setQuery(QString());
+    QVERIFY(index.matches("http://foo.com/a"));
+}
+
+// A history with count visits to a tenth as many pages
+static HistoryList searchHistory(int count)
+{
+    static const char *words[] = { "arora", "browser", "qt", "webkit", "history",
+                                   "bookmark", "download", "privacy", "network", "cookie" };
+    HistoryList list;
+    QDateTime dateTime = QDateTime::currentDateTime();
+    for (int i = 0; i < count; ++i) {
+        int page = (i * 7919) % (count / 10 + 1);
+        QString title = QString("%1 %2 page %3").arg(words[page % 10]).arg(words[(page / 10) % 10]).arg(page);
+        list.append(HistoryEntry(QString("http://%1.example.com/%2").arg(words[(page / 3) % 10]).arg(page),
+                                 dateTime, title));
+        dateTime = dateTime.addSecs(-60);
+    }
+    return list;
+}
+
+// The proxy shows the same pages as a TreeProxyModel matching every row
+static bool sameAsReference(HistoryProxyModel *proxy, TreeProxyModel *reference)
+{
+    if (proxy->rowCount() != reference->rowCount())
+        return false;
+    for (int i = 0; i < proxy->rowCount(); ++i) {
+        QModelIndex date = proxy->index(i, 0);
+        QModelIndex referenceDate = reference->index(i, 0);
+        if (proxy->rowCount(date) != reference->rowCount(referenceDate))
+            return false;
+        for (int j = 0; j < proxy->rowCount(date); ++j) {
+            if (proxy->index(j, 1, date).data().toString()
+                != reference->index(j, 1, referenceDate).data().toString())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The index filters the same pages as matching the text of every row
+void tst_HistoryManager::historyProxyModel()
+{
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    HistoryList list = searchHistory(2000);
+    history.setHistory(list);
+
+    HistoryProxyModel proxy(&history);
+    proxy.setSourceModel(history.historyTreeModel());
+    ModelTest test(&proxy);
+    TreeProxyModel reference;
+    reference.setFilterKeyColumn(-1);
+    reference.setSourceModel(history.historyTreeModel());
+
+    QStringList queries;
+    queries << "a" << "ar" << "aro" << "arora" << "arora b" << "PAGE 1" << "page 12" << "e" << "xyz" << "";
+    foreach (const QString &query, queries) {
+        proxy.setSearchText(query);
+        reference.setFilterFixedString(query);
+        QVERIFY(sameAsReference(&proxy, &reference));
+    }
+
+    // the history changing while a query is set
+    proxy.setSearchText("arora");
+    reference.setFilterFixedString("arora");
+    QDateTime now = QDateTime::currentDateTime();
+    history.addHistoryEntry(HistoryEntry("http://arora.example.com/kept", now, "Kept"));
+    history.addHistoryEntry(HistoryEntry("http://arora.example.com/new", now.addSecs(1), "New"));
+    history.addHistoryEntry(HistoryEntry("http://other.example.com/new", now.addSecs(2), "Other"));
+    history.addHistoryEntry(HistoryEntry(list.at(500).url, now.addSecs(3), list.at(500).title));
+    QVERIFY(sameAsReference(&proxy, &reference));
+    history.removeHistoryEntry(QUrl("http://arora.example.com/new"));
+    history.removeHistoryEntries(list.at(400).dateTime, list.at(100).dateTime);
+    QVERIFY(sameAsReference(&proxy, &reference));
+    QModelIndex date = proxy.index(0, 0);
+    QVERIFY(proxy.rowCount(date) > 0);
+    int pages = proxy.rowCount(date);
+    QVERIFY(proxy.removeRows(0, 1, date));
+    QCOMPARE(proxy.rowCount(date), pages - 1);
+    QVERIFY(sameAsReference(&proxy, &reference));
+
+    // the title that is shown is the one of the newest visit, even
+    // when the url has a title from an older one
+    history.addHistoryEntry(HistoryEntry("http://title.com/", now.addSecs(4), "Hidden"));
+    history.addHistoryEntry(HistoryEntry("http://title.com/", now.addSecs(5)));
+    QCOMPARE(history.urlEntry("http://title.com/").title, QString("Hidden"));
+    proxy.setSearchText("hidden");
+    reference.setFilterFixedString("hidden");
+    QCOMPARE(proxy.rowCount(proxy.index(0, 0)), 0);
+    QVERIFY(sameAsReference(&proxy, &reference));
+    proxy.setSearchText("title.com");
+    reference.setFilterFixedString("title.com");
+    QCOMPARE(proxy.rowCount(proxy.index(0, 0)), 1);
+    QVERIFY(sameAsReference(&proxy, &reference));
+}
+
+void tst_HistoryManager::filterLatency_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("index");
+
+    QTest::newRow("10k-index") << 10000 << true;
+    QTest::newRow("10k-regexp") << 10000 << false;
+    QTest::newRow("100k-index") << 100000 << true;
+    QTest::newRow("100k-regexp") << 100000 << false;
+}
+
+/*
+    Typing into the history dialog search box, each iteration is one
+    keystroke so the result is the latency of filtering for one key.
+  */
+void tst_HistoryManager::filterLatency()
+{
+    QFETCH(int, count);
+    QFETCH(bool, index);
+
+    SubHistory history;
+    history.setDaysToExpire(-1);
+    history.setHistory(searchHistory(count), true);
+
+    HistoryProxyModel proxy(&history);
+    proxy.setSourceModel(history.historyTreeModel());
+    TreeProxyModel reference;
+    reference.setFilterKeyColumn(-1);
+    reference.setSourceModel(history.historyTreeModel());
+
+    QString text = QLatin1String("browser privacy page");
+    int length = 0;
+    QBENCHMARK {
+        length = length % text.length() + 1;
+        if (index)
+            proxy.setSearchText(text.left(length));
+        else
+            reference.setFilterFixedString(text.left(length));
+    }
+    history.clear();
+}
+
 void tst_HistoryManager::big()
 {
     SubHistory history;
@@ -414,12 +1198,6 @@ void tst_HistoryManager::big()
     qDebug() << "model rowCount" << model.rowCount();
     QCOMPARE(model.rowCount(), bigHistory.count());
 
-    qDebug() << "making completion model";
-    HistoryCompletionModel completionModel;
-    completionModel.setSourceModel(&model);
-    ModelTest test2(&completionModel);
-    QCOMPARE(completionModel.rowCount(), bigHistory.count() * 2);
-
     qDebug() << "making history dialog model";
     HistoryTreeModel dialogModel(&model);
     ModelTest test3(&dialogModel);
@@ -0,0 +1,353 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#include <QtTest/QtTest>
+#include "qtest_arora.h"
+
+#include <historymanager.h>
+#include <locationcompleter.h>
+
+class tst_LocationCompleter : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private slots:
+    void key_data();
+    void key();
+    void complete_data();
+    void complete();
+    void shortPrefix();
+    void setVisits();
+    void bookmarks();
+    void setTitle();
+    void olderVisit();
+    void removeNewestVisit();
+    void loadInBackground();
+    void benchmark_data();
+    void benchmark();
+};
+
+class SubHistory : public HistoryManager
+{
+public:
+    SubHistory(LoadMode mode = LoadNow) : HistoryManager(0, mode)
+    {
+        QWidget w;
+        setParent(&w);
+        if (QWebHistoryInterface::defaultInterface() == this)
+            QWebHistoryInterface::setDefaultInterface(0);
+        setParent(0);
+    }
+};
+
+// This will be called before the first test function is executed.
+// It is only called once.
+void tst_LocationCompleter::initTestCase()
+{
+    QCoreApplication::setApplicationName("locationcompletertest");
+}
+
+// This will be called after the last test function is executed.
+// It is only called once.
+void tst_LocationCompleter::cleanupTestCase()
+{
+}
+
+// This will be called before each test function is executed.
+void tst_LocationCompleter::init()
+{
+}
+
+// This will be called after every test function.
+void tst_LocationCompleter::cleanup()
+{
+}
+
+void tst_LocationCompleter::key_data()
+{
+    QTest::addColumn<QString>("url");
+    QTest::addColumn<QString>("key");
+
+    QTest::newRow("null") << QString() << QString();
+    QTest::newRow("plain") << "foo.com" << "foo.com";
+    QTest::newRow("scheme") << "http://foo.com/" << "foo.com/";
+    QTest::newRow("www") << "https://www.foo.com/bar" << "foo.com/bar";
+    QTest::newRow("case") << "HTTP://WWW.Foo.com/Bar" << "foo.com/bar";
+    QTest::newRow("www-only") << "www.foo.com" << "foo.com";
+}
+
+// public static QString key(QString const &url)
+void tst_LocationCompleter::key()
+{
+    QFETCH(QString, url);
+    QFETCH(QString, key);
+    QCOMPARE(LocationCompletionIndex::key(url), key);
+}
+
+void tst_LocationCompleter::complete_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<QStringList>("results");
+
+    QTest::newRow("null") << QString() << QStringList();
+    QTest::newRow("none") << "nothing" << QStringList();
+    QTest::newRow("prefix") << "ar"
+        << (QStringList() << "http://www.arora-browser.org/" << "http://arora.googlecode.com/");
+    QTest::newRow("scheme") << "http://www.ar"
+        << (QStringList() << "http://www.arora-browser.org/" << "http://arora.googlecode.com/");
+    // prefix matches come before better scored urls that only contain the text
+    QTest::newRow("contains") << "goo"
+        << (QStringList() << "http://www.google.com/" << "http://arora.googlecode.com/");
+    QTest::newRow("title") << "project"
+        << (QStringList() << "http://arora.googlecode.com/");
+    QTest::newRow("words") << "code project"
+        << (QStringList() << "http://arora.googlecode.com/");
+    QTest::newRow("words-none") << "code browser" << QStringList();
+}
+
+// public QStringList complete(QString const &text, int maximum, int budget) const
+void tst_LocationCompleter::complete()
+{
+    QFETCH(QString, text);
+    QFETCH(QStringList, results);
+
+    QDateTime now = QDateTime::currentDateTime();
+    LocationCompletionIndex index;
+    // visited often but a long time ago
+    index.setVisits("http://arora.googlecode.com/", "Arora project", 5, now.addDays(-100));
+    index.setVisits("http://www.arora-browser.org/", "Arora", 2, now.addSecs(-60));
+    index.setVisits("http://www.google.com/", "Google", 1, now);
+    QCOMPARE(index.count(), 3);
+
+    QCOMPARE(index.complete(text, 10, 1000), results);
+}
+
+// The best urls for a short prefix are found however many urls start with it
+void tst_LocationCompleter::shortPrefix()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    LocationCompletionIndex index;
+    for (int i = 0; i < 5000; ++i)
+        index.setVisits(QString("http://a%1.com/").arg(i), QString(), 1, now.addDays(-100));
+    index.setVisits("http://azzz.com/", QString(), 50, now);
+    index.setVisits("http://ayyy.com/", QString(), 40, now);
+
+    QCOMPARE(index.complete("a", 2, 0), QStringList() << "http://azzz.com/" << "http://ayyy.com/");
+    QCOMPARE(index.complete("ay", 2, 0).value(0), QString("http://ayyy.com/"));
+
+    // a change in score moves the url in its bucket
+    index.setVisits("http://ayyy.com/", QString(), 60, now);
+    QCOMPARE(index.complete("a", 2, 0), QStringList() << "http://ayyy.com/" << "http://azzz.com/");
+    index.setVisits("http://ayyy.com/", QString(), 0, QDateTime());
+    QCOMPARE(index.complete("a", 1, 0), QStringList() << "http://azzz.com/");
+    QCOMPARE(index.complete("ay", 1, 0), QStringList());
+}
+
+void tst_LocationCompleter::setVisits()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    LocationCompletionIndex index;
+    index.setVisits("http://foo.com/", "Foo", 2, now);
+    index.setVisits("http://foobar.com/", "Foo bar", 1, now);
+    QCOMPARE(index.complete("foo", 10, 1000),
+             QStringList() << "http://foo.com/" << "http://foobar.com/");
+
+    // the last visit counts as much as the number of visits
+    index.setVisits("http://foo.com/", "Foo", 2, now.addDays(-100));
+    QCOMPARE(index.complete("foo", 10, 1000),
+             QStringList() << "http://foobar.com/" << "http://foo.com/");
+
+    index.setVisits("http://foobar.com/", "Foo bar", 0, QDateTime());
+    QCOMPARE(index.count(), 1);
+    QCOMPARE(index.complete("foo", 10, 1000), QStringList() << "http://foo.com/");
+    QCOMPARE(index.complete("bar", 10, 1000), QStringList());
+
+    index.setVisits("http://foo.com/", "Foo", 0, QDateTime());
+    QCOMPARE(index.count(), 0);
+    QCOMPARE(index.complete("foo", 10, 1000), QStringList());
+
+    // removed urls can come back
+    index.setVisits("http://foobar.com/", QString(), 1, now);
+    QCOMPARE(index.complete("bar", 10, 1000), QStringList() << "http://foobar.com/");
+
+    // enough removals make the index drop them for good
+    for (int i = 0; i < 3000; ++i)
+        index.setVisits(QString("http://host%1.com/").arg(i), QString(), 1, now);
+    for (int i = 0; i < 3000; ++i)
+        index.setVisits(QString("http://host%1.com/").arg(i), QString(), 0, QDateTime());
+    QCOMPARE(index.count(), 1);
+    QCOMPARE(index.complete("host", 10, 1000), QStringList());
+    QCOMPARE(index.complete("h", 10, 1000), QStringList());
+    QCOMPARE(index.complete("bar", 10, 1000), QStringList() << "http://foobar.com/");
+}
+
+void tst_LocationCompleter::bookmarks()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    LocationCompletionIndex index;
+    index.setVisits("http://foo.com/a", "Foo a", 1, now);
+    index.addBookmark("http://foo.com/b", "Foo b");
+    QCOMPARE(index.complete("foo", 10, 1000),
+             QStringList() << "http://foo.com/b" << "http://foo.com/a");
+    QCOMPARE(index.title("http://foo.com/b"), QString("Foo b"));
+
+    index.removeBookmark("http://foo.com/b");
+    QCOMPARE(index.complete("foo", 10, 1000), QStringList() << "http://foo.com/a");
+}
+
+void tst_LocationCompleter::setTitle()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    LocationCompletionIndex index;
+    index.setVisits("http://foo.com/", QString(), 1, now);
+    QCOMPARE(index.complete("welcome", 10, 1000), QStringList());
+    index.setVisits("http://foo.com/", "Welcome to Foo", 1, now);
+    QCOMPARE(index.title("http://foo.com/"), QString("Welcome to Foo"));
+    QCOMPARE(index.complete("welcome", 10, 1000), QStringList() << "http://foo.com/");
+    // a visit without a title keeps the one there is
+    index.setVisits("http://foo.com/", QString(), 2, now);
+    QCOMPARE(index.title("http://foo.com/"), QString("Welcome to Foo"));
+    index.setVisits("http://bar.com/", "Welcome to Bar", 0, QDateTime());
+    QCOMPARE(index.count(), 1);
+}
+
+// Visits that are older than the newest one do not change the title
+void tst_LocationCompleter::olderVisit()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    QList<HistoryEntry> list;
+    list.append(HistoryEntry("http://foo.com/", now, "New Foo"));
+    list.append(HistoryEntry("http://bar.com/", now.addSecs(-60)));
+    list.append(HistoryEntry("http://foo.com/", now.addDays(-1), "Old Foo"));
+    list.append(HistoryEntry("http://bar.com/", now.addDays(-1), "Old Bar"));
+    SubHistory history;
+    history.setHistory(list);
+
+    LocationCompletionModel model(&history, 0);
+    model.setQuery("foo");
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.index(0, 0).data(Qt::ToolTipRole).toString(), QString("New Foo"));
+    model.setQuery("bar");
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.index(0, 0).data(Qt::ToolTipRole).toString(), QString("Old Bar"));
+
+    history.setHistory(QList<HistoryEntry>());
+}
+
+// Removing the newest visit of a url makes the one before it the last visit
+void tst_LocationCompleter::removeNewestVisit()
+{
+    QDateTime now = QDateTime::currentDateTime();
+    QList<HistoryEntry> list;
+    list.append(HistoryEntry("http://foo.com/", now));
+    list.append(HistoryEntry("http://foobar.com/", now.addSecs(-60)));
+    list.append(HistoryEntry("http://foobar.com/", now.addSecs(-120)));
+    for (int i = 0; i < 3; ++i)
+        list.append(HistoryEntry("http://foo.com/", now.addDays(-200 - i)));
+    SubHistory history;
+    history.setHistory(list);
+
+    LocationCompletionModel model(&history, 0);
+    model.setQuery("foo");
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.index(0, 0).data().toString(), QString("http://foo.com/"));
+
+    history.removeHistoryEntries(0, 1);
+    model.setQuery("foo");
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.index(0, 0).data().toString(), QString("http://foobar.com/"));
+    QCOMPARE(model.index(1, 0).data().toString(), QString("http://foo.com/"));
+
+    history.setHistory(QList<HistoryEntry>());
+}
+
+// Completion does not wait for the history to load, the results
+// are refreshed as the rest of it comes in
+void tst_LocationCompleter::loadInBackground()
+{
+    QList<HistoryEntry> list;
+    QDateTime dateTime = QDateTime::currentDateTime();
+    for (int i = 0; i < 3000; ++i) {
+        list.append(HistoryEntry(QString("http://%1.com/").arg(i % 1000), dateTime, QString("title %1").arg(i)));
+        dateTime = dateTime.addSecs(-60);
+    }
+    {
+        SubHistory history;
+        history.setHistory(list);
+    }
+
+    SubHistory history(HistoryManager::LoadInBackground);
+    LocationCompletionModel model(&history, 0);
+    QSignalSpy resetSpy(&model, SIGNAL(modelReset()));
+    model.setQuery("999.com");
+    QCOMPARE(resetSpy.count(), 1);
+    QTRY_VERIFY(!history.isLoading());
+    QTRY_COMPARE(model.rowCount(), 1);
+    QModelIndex idx = model.index(0, 0);
+    QCOMPARE(idx.data().toString(), QString("http://999.com/"));
+    QCOMPARE(idx.data(Qt::ToolTipRole).toString(), QString("title 999"));
+
+    history.setHistory(QList<HistoryEntry>());
+}
+
+void tst_LocationCompleter::benchmark_data()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("one letter") << "h";
+    QTest::newRow("prefix") << "host-1234";
+    QTest::newRow("contains") << "page-99";
+    QTest::newRow("title") << "title 4242";
+    QTest::newRow("none") << "nothing";
+}
+
+/*
+    A million visits spread over 200000 urls.
+  */
+void tst_LocationCompleter::benchmark()
+{
+    QFETCH(QString, text);
+
+    static LocationCompletionIndex index;
+    if (index.count() == 0) {
+        QDateTime dateTime = QDateTime::currentDateTime();
+        for (int url = 0; url < 200000; ++url) {
+            index.setVisits(QString("http://host-%1.com/page-%2").arg(url / 10).arg(url),
+                            QString("title %1").arg(url), 5, dateTime);
+            dateTime = dateTime.addSecs(-50);
+        }
+    }
+    QCOMPARE(index.count(), 200000);
+
+    QStringList results;
+    QBENCHMARK {
+        results = index.complete(text, 20, 50);
+    }
+    QVERIFY(results.count() <= 20);
+}
+
+QTEST_MAIN(tst_LocationCompleter)
+#include "tst_locationcompleter.moc"
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <QtTest/QtTest>
+#include <QtNetwork/QtNetwork>
+
+#include <networkcache.h>
+
+// Counts how often the disk is asked for something
+class CountingDiskCache : public QNetworkDiskCache
+{
+public:
+    CountingDiskCache() : dataCalls(0) {}
+
+    QIODevice *data(const QUrl &url)
+    {
+        ++dataCalls;
+        return QNetworkDiskCache::data(url);
+    }
+
+    int dataCalls;
+};
+
+class tst_NetworkCache : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void memoryHit();
+    void promote();
+    void leastRecentlyUsed();
+    void largeResponse();
+    void updateMetaData();
+    void remove();
+    void removeWhileInserting();
+    void clear();
+
+private:
+    NetworkCache *createCache(int maximumMemorySize);
+    void store(QAbstractNetworkCache *cache, const QUrl &url, const QByteArray &data);
+    QByteArray read(QAbstractNetworkCache *cache, const QUrl &url);
+
+    QString m_directory;
+    NetworkCache *m_cache;
+    CountingDiskCache *m_diskCache;
+};
+
+void tst_NetworkCache::init()
+{
+    m_directory = QDir::tempPath() + QLatin1String("/networkcachetest");
+    m_cache = createCache(64 * 1024);
+    m_cache->clear();
+}
+
+void tst_NetworkCache::cleanup()
+{
+    m_cache->clear();
+    delete m_cache;
+}
+
+NetworkCache *tst_NetworkCache::createCache(int maximumMemorySize)
+{
+    NetworkCache *cache = new NetworkCache;
+    m_diskCache = new CountingDiskCache;
+    m_diskCache->setCacheDirectory(m_directory);
+    cache->setDiskCache(m_diskCache);
+    cache->setMaximumMemorySize(maximumMemorySize);
+    return cache;
+}
+
+void tst_NetworkCache::store(QAbstractNetworkCache *cache, const QUrl &url, const QByteArray &data)
+{
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+    QNetworkCacheMetaData::RawHeaderList headers;
+    headers.append(qMakePair(QByteArray("Content-Type"), QByteArray("text/plain")));
+    metaData.setRawHeaders(headers);
+
+    QIODevice *device = cache->prepare(metaData);
+    QVERIFY(device);
+    device->write(data);
+    cache->insert(device);
+}
+
+QByteArray tst_NetworkCache::read(QAbstractNetworkCache *cache, const QUrl &url)
+{
+    if (!cache->metaData(url).isValid())
+        return QByteArray();
+    QIODevice *device = cache->data(url);
+    if (!device)
+        return QByteArray();
+    QByteArray data = device->readAll();
+    delete device;
+    return data;
+}
+
+void tst_NetworkCache::memoryHit()
+{
+    QUrl url(QLatin1String("http://example.com/style.css"));
+    store(m_cache, url, "body { }");
+    QCOMPARE(m_cache->memoryCount(), 1);
+
+    QCOMPARE(read(m_cache, url), QByteArray("body { }"));
+    QCOMPARE(read(m_cache, url), QByteArray("body { }"));
+    QCOMPARE(m_diskCache->dataCalls, 0);
+    QCOMPARE(m_cache->memoryHits(), 2);
+    QCOMPARE(m_cache->diskHits(), 0);
+    QCOMPARE(m_cache->memoryBytesServed(), qint64(16));
+
+    // It was written through to disk as well
+    QCOMPARE(read(m_diskCache, url), QByteArray("body { }"));
+
+    QCOMPARE(read(m_cache, QUrl(QLatin1String("http://example.com/missing"))), QByteArray());
+    QCOMPARE(m_cache->misses(), 1);
+
+    m_cache->resetStatistics();
+    QCOMPARE(m_cache->memoryHits(), 0);
+    QCOMPARE(m_cache->misses(), 0);
+}
+
+void tst_NetworkCache::promote()
+{
+    QUrl url(QLatin1String("http://example.com/script.js"));
+    store(m_cache, url, "alert(1);");
+    delete m_cache;
+
+    // A new cache only has the response on disk
+    m_cache = createCache(64 * 1024);
+    QCOMPARE(m_cache->memoryCount(), 0);
+    QCOMPARE(read(m_cache, url), QByteArray("alert(1);"));
+    QCOMPARE(m_cache->diskHits(), 1);
+    QCOMPARE(m_cache->memoryCount(), 1);
+
+    QCOMPARE(read(m_cache, url), QByteArray("alert(1);"));
+    QCOMPARE(m_diskCache->dataCalls, 1);
+    QCOMPARE(m_cache->memoryHits(), 1);
+    QCOMPARE(m_cache->diskBytesServed(), qint64(9));
+}
+
+void tst_NetworkCache::leastRecentlyUsed()
+{
+    delete m_cache;
+    // Room for nine responses
+    m_cache = createCache(4000);
+    QByteArray data(400, 'x');
+
+    QList<QUrl> urls;
+    for (int i = 0; i < 12; ++i)
+        urls.append(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i)));
+
+    for (int i = 0; i < 9; ++i)
+        store(m_cache, urls.at(i), data);
+    QCOMPARE(m_cache->memoryCount(), 9);
+    // Touch the first one so it is the most recently used
+    QCOMPARE(read(m_cache, urls.at(0)), data);
+    for (int i = 9; i < 12; ++i)
+        store(m_cache, urls.at(i), data);
+
+    QVERIFY(m_cache->memorySize() <= m_cache->maximumMemorySize());
+    QVERIFY(m_cache->memoryCount() < 12);
+
+    m_diskCache->dataCalls = 0;
+    QCOMPARE(read(m_cache, urls.at(0)), data);
+    QCOMPARE(read(m_cache, urls.at(11)), data);
+    QCOMPARE(m_diskCache->dataCalls, 0);
+
+    // The oldest ones were dropped from memory but are still on disk
+    QCOMPARE(read(m_cache, urls.at(1)), data);
+    QCOMPARE(m_diskCache->dataCalls, 1);
+}
+
+void tst_NetworkCache::largeResponse()
+{
+    QUrl url(QLatin1String("http://example.com/movie"));
+    QByteArray data(m_cache->maximumMemorySize(), 'x');
+    store(m_cache, url, data);
+    QCOMPARE(m_cache->memoryCount(), 0);
+
+    QCOMPARE(read(m_cache, url), data);
+    QCOMPARE(read(m_cache, url), data);
+    QCOMPARE(m_cache->memoryCount(), 0);
+    QCOMPARE(m_diskCache->dataCalls, 2);
+}
+
+void tst_NetworkCache::updateMetaData()
+{
+    QUrl url(QLatin1String("http://example.com/image.png"));
+    store(m_cache, url, "png");
+
+    QNetworkCacheMetaData metaData = m_cache->metaData(url);
+    QDateTime expires = QDateTime::currentDateTime().addDays(1);
+    expires.setTime(QTime(expires.time().hour(), expires.time().minute(), expires.time().second()));
+    metaData.setExpirationDate(expires);
+    m_cache->updateMetaData(metaData);
+
+    QCOMPARE(m_cache->metaData(url).expirationDate(), expires);
+    QCOMPARE(m_diskCache->metaData(url).expirationDate(), expires);
+}
+
+void tst_NetworkCache::remove()
+{
+    QUrl url(QLatin1String("http://example.com/removed"));
+    store(m_cache, url, "data");
+    QVERIFY(m_cache->remove(url));
+    QCOMPARE(m_cache->memoryCount(), 0);
+    QVERIFY(!m_cache->metaData(url).isValid());
+    QVERIFY(!m_diskCache->metaData(url).isValid());
+    QVERIFY(!m_cache->remove(url));
+}
+
+void tst_NetworkCache::removeWhileInserting()
+{
+    QUrl url(QLatin1String("http://example.com/aborted"));
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+    QIODevice *device = m_cache->prepare(metaData);
+    QVERIFY(device);
+    device->write("partial");
+
+    // This is how QNetworkAccessManager throws away an aborted response
+    m_cache->remove(url);
+    QCOMPARE(m_cache->memoryCount(), 0);
+    QVERIFY(!m_cache->metaData(url).isValid());
+}
+
+void tst_NetworkCache::clear()
+{
+    store(m_cache, QUrl(QLatin1String("http://example.com/1")), "1");
+    store(m_cache, QUrl(QLatin1String("http://example.com/2")), "2");
+    QVERIFY(m_cache->cacheSize() > 0);
+    m_cache->clear();
+    QCOMPARE(m_cache->memoryCount(), 0);
+    QCOMPARE(m_cache->memorySize(), 0);
+    QCOMPARE(m_cache->cacheSize(), qint64(0));
+}
+
+QTEST_MAIN(tst_NetworkCache)
+#include "tst_networkcache.moc"
@@ -0,0 +1,416 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <QtTest/QtTest>
+#include <QtNetwork/QtNetwork>
+
+#include "qtry.h"
+
+#include <networkdiskcache.h>
+
+class tst_NetworkDiskCache : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void insert();
+    void reopen();
+    void replace();
+    void remove();
+    void removeWhileInserting();
+    void updateMetaData();
+    void growIndex();
+    void evict();
+    void oversize();
+    void compactGarbage();
+    void insertWhileCompacting();
+    void brokenIndex();
+    void brokenShard();
+    void clear();
+    void readOnly();
+    void readOnlyBrokenIndex();
+
+private:
+    bool store(const QUrl &url, const QByteArray &data);
+    QByteArray read(const QUrl &url);
+
+    QString m_directory;
+    NetworkDiskCache *m_cache;
+};
+
+void tst_NetworkDiskCache::init()
+{
+    m_directory = QDir::tempPath() + QLatin1String("/networkdiskcachetest");
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+    m_cache->clear();
+}
+
+void tst_NetworkDiskCache::cleanup()
+{
+    m_cache->clear();
+    delete m_cache;
+}
+
+bool tst_NetworkDiskCache::store(const QUrl &url, const QByteArray &data)
+{
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+    QNetworkCacheMetaData::RawHeaderList headers;
+    headers.append(qMakePair(QByteArray("Content-Type"), QByteArray("text/plain")));
+    metaData.setRawHeaders(headers);
+
+    QIODevice *device = m_cache->prepare(metaData);
+    if (!device)
+        return false;
+    device->write(data);
+    m_cache->insert(device);
+    return true;
+}
+
+QByteArray tst_NetworkDiskCache::read(const QUrl &url)
+{
+    QIODevice *device = m_cache->data(url);
+    if (!device)
+        return QByteArray();
+    QByteArray data = device->readAll();
+    delete device;
+    return data;
+}
+
+void tst_NetworkDiskCache::insert()
+{
+    QUrl url(QLatin1String("http://example.com/style.css"));
+    QVERIFY(!m_cache->metaData(url).isValid());
+    QVERIFY(store(url, "body { }"));
+
+    QNetworkCacheMetaData metaData = m_cache->metaData(url);
+    QVERIFY(metaData.isValid());
+    QCOMPARE(metaData.url(), url);
+    QCOMPARE(metaData.rawHeaders().count(), 1);
+    QCOMPARE(read(url), QByteArray("body { }"));
+    QCOMPARE(m_cache->entryCount(), 1);
+    QVERIFY(m_cache->cacheSize() > 8);
+    QCOMPARE(m_cache->urls(), QList<QUrl>() << url);
+
+    // Everything goes into the index and a few shards
+    QDir dir(m_directory);
+    QCOMPARE(dir.entryList(QDir::Files), QStringList()
+             << QLatin1String("index") << QString(QLatin1String("shard-%1.data")).arg(NetworkDiskCache::hash(url) % 4));
+}
+
+void tst_NetworkDiskCache::reopen()
+{
+    QList<QUrl> urls;
+    for (int i = 0; i < 20; ++i) {
+        urls.append(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i)));
+        QVERIFY(store(urls.last(), QByteArray::number(i)));
+    }
+    delete m_cache;
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+    QCOMPARE(m_cache->entryCount(), 20);
+    for (int i = 0; i < 20; ++i)
+        QCOMPARE(read(urls.at(i)), QByteArray::number(i));
+}
+
+void tst_NetworkDiskCache::replace()
+{
+    QUrl url(QLatin1String("http://example.com/"));
+    QVERIFY(store(url, "first"));
+    QVERIFY(store(url, "second"));
+    QCOMPARE(read(url), QByteArray("second"));
+    QCOMPARE(m_cache->entryCount(), 1);
+}
+
+void tst_NetworkDiskCache::remove()
+{
+    QUrl url(QLatin1String("http://example.com/removed"));
+    QVERIFY(store(url, "data"));
+    QVERIFY(m_cache->remove(url));
+    QVERIFY(!m_cache->metaData(url).isValid());
+    QVERIFY(!m_cache->data(url));
+    QVERIFY(!m_cache->remove(url));
+    QCOMPARE(m_cache->entryCount(), 0);
+}
+
+void tst_NetworkDiskCache::removeWhileInserting()
+{
+    QUrl url(QLatin1String("http://example.com/aborted"));
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+    QIODevice *device = m_cache->prepare(metaData);
+    QVERIFY(device);
+    device->write("partial");
+    m_cache->remove(url);
+    QVERIFY(!m_cache->metaData(url).isValid());
+}
+
+void tst_NetworkDiskCache::updateMetaData()
+{
+    QUrl url(QLatin1String("http://example.com/image.png"));
+    QVERIFY(store(url, "png"));
+
+    QNetworkCacheMetaData metaData = m_cache->metaData(url);
+    QDateTime expires = QDateTime::currentDateTime().addDays(1);
+    expires.setTime(QTime(expires.time().hour(), expires.time().minute(), expires.time().second()));
+    metaData.setExpirationDate(expires);
+    m_cache->updateMetaData(metaData);
+
+    QCOMPARE(m_cache->metaData(url).expirationDate(), expires);
+    QCOMPARE(read(url), QByteArray("png"));
+}
+
+void tst_NetworkDiskCache::growIndex()
+{
+    // More entries than fit in the first index
+    for (int i = 0; i < 5000; ++i)
+        QVERIFY(store(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i)), QByteArray::number(i)));
+    QCOMPARE(m_cache->entryCount(), 5000);
+    for (int i = 0; i < 5000; i += 97)
+        QCOMPARE(read(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i))), QByteArray::number(i));
+}
+
+void tst_NetworkDiskCache::evict()
+{
+    m_cache->setMaximumCacheSize(64 * 1024);
+    QByteArray data(1000, 'x');
+    QUrl first(QLatin1String("http://example.com/first"));
+    QVERIFY(store(first, data));
+    int i = 0;
+    while (!m_cache->isCompacting() && i < 1000) {
+        QVERIFY(store(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i++)), data));
+        // Reading an entry keeps it around
+        QCOMPARE(read(first), data);
+    }
+    QVERIFY(m_cache->isCompacting());
+    m_cache->waitForCompaction();
+    QVERIFY(!m_cache->isCompacting());
+
+    QVERIFY(m_cache->cacheSize() <= m_cache->maximumCacheSize());
+    QVERIFY(m_cache->entryCount() < i);
+    QCOMPARE(read(first), data);
+    QVERIFY(!m_cache->metaData(QUrl(QLatin1String("http://example.com/0"))).isValid());
+    QCOMPARE(read(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i - 1))), data);
+}
+
+// Responses bigger than an eighth of the cache are left out
+void tst_NetworkDiskCache::oversize()
+{
+    m_cache->setMaximumCacheSize(80 * 1024);
+    QUrl url(QLatin1String("http://example.com/big"));
+    QVERIFY(store(url, QByteArray(10 * 1024, 'x')));
+    QCOMPARE(read(url).size(), 10 * 1024);
+
+    // Known up front
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+    QNetworkCacheMetaData::RawHeaderList headers;
+    headers.append(qMakePair(QByteArray("Content-Length"), QByteArray("10241")));
+    metaData.setRawHeaders(headers);
+    QVERIFY(!m_cache->prepare(metaData));
+
+    // Only found out while it is written
+    QUrl bigger(QLatin1String("http://example.com/bigger"));
+    metaData.setUrl(bigger);
+    metaData.setRawHeaders(QNetworkCacheMetaData::RawHeaderList());
+    QIODevice *device = m_cache->prepare(metaData);
+    QVERIFY(device);
+    QByteArray chunk(1000, 'y');
+    for (int i = 0; i < 11; ++i)
+        QCOMPARE(device->write(chunk), qint64(chunk.size()));
+    QCOMPARE(device->size(), qint64(11000));
+    m_cache->insert(device);
+    QVERIFY(!m_cache->metaData(bigger).isValid());
+    QCOMPARE(m_cache->entryCount(), 1);
+}
+
+void tst_NetworkDiskCache::compactGarbage()
+{
+    m_cache->setMaximumCacheSize(64 * 1024);
+    QUrl url(QLatin1String("http://example.com/"));
+    QByteArray data(1000, 'x');
+    // Replacing an entry only leaves garbage behind
+    for (int i = 0; i < 100 && !m_cache->isCompacting(); ++i)
+        QVERIFY(store(url, data + QByteArray::number(i)));
+    QVERIFY(m_cache->isCompacting());
+    QTRY_VERIFY(!m_cache->isCompacting());
+
+    QCOMPARE(m_cache->entryCount(), 1);
+    QVERIFY(m_cache->cacheSize() < 2000);
+    QVERIFY(read(url).startsWith(data));
+}
+
+void tst_NetworkDiskCache::insertWhileCompacting()
+{
+    m_cache->setMaximumCacheSize(64 * 1024);
+    QByteArray data(1000, 'x');
+    int i = 0;
+    while (!m_cache->isCompacting())
+        QVERIFY(store(QUrl(QString(QLatin1String("http://example.com/%1")).arg(i++)), data));
+
+    // Added to the shards the compactor is working on
+    QList<QUrl> added;
+    for (int j = 0; j < 8; ++j) {
+        added.append(QUrl(QString(QLatin1String("http://example.com/added/%1")).arg(j)));
+        QVERIFY(store(added.last(), QByteArray::number(j)));
+    }
+    m_cache->waitForCompaction();
+
+    for (int j = 0; j < added.count(); ++j)
+        QCOMPARE(read(added.at(j)), QByteArray::number(j));
+    delete m_cache;
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+    for (int j = 0; j < added.count(); ++j)
+        QCOMPARE(read(added.at(j)), QByteArray::number(j));
+}
+
+void tst_NetworkDiskCache::brokenIndex()
+{
+    QUrl url(QLatin1String("http://example.com/"));
+    QVERIFY(store(url, "data"));
+    delete m_cache;
+
+    QFile index(m_directory + QLatin1String("/index"));
+    QVERIFY(index.open(QFile::WriteOnly | QFile::Append));
+    index.write("garbage");
+    index.close();
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+    QCOMPARE(m_cache->entryCount(), 0);
+    QVERIFY(!m_cache->metaData(url).isValid());
+    QVERIFY(store(url, "data"));
+    QCOMPARE(read(url), QByteArray("data"));
+}
+
+void tst_NetworkDiskCache::brokenShard()
+{
+    QUrl url(QLatin1String("http://example.com/"));
+    QVERIFY(store(url, "data"));
+    delete m_cache;
+
+    // The index points past the end of the shard now
+    QString shard = m_directory + QString(QLatin1String("/shard-%1.data")).arg(NetworkDiskCache::hash(url) % 4);
+    QFile::remove(shard);
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+    QCOMPARE(m_cache->entryCount(), 0);
+    QVERIFY(!m_cache->data(url));
+}
+
+void tst_NetworkDiskCache::clear()
+{
+    QVERIFY(store(QUrl(QLatin1String("http://example.com/1")), "1"));
+    QVERIFY(store(QUrl(QLatin1String("http://example.com/2")), "2"));
+    m_cache->clear();
+    QCOMPARE(m_cache->entryCount(), 0);
+    QCOMPARE(m_cache->cacheSize(), qint64(0));
+    QVERIFY(store(QUrl(QLatin1String("http://example.com/1")), "1"));
+    QCOMPARE(m_cache->entryCount(), 1);
+}
+
+static QHash<QString, QByteArray> directoryContents(const QString &path)
+{
+    QHash<QString, QByteArray> contents;
+    QDir dir(path);
+    foreach (const QString &fileName, dir.entryList(QDir::Files)) {
+        QFile file(dir.filePath(fileName));
+        if (file.open(QFile::ReadOnly))
+            contents.insert(fileName, file.readAll());
+    }
+    return contents;
+}
+
+// Looking at the cache changes none of its files
+void tst_NetworkDiskCache::readOnly()
+{
+    QUrl url(QLatin1String("http://example.com/"));
+    QVERIFY(store(url, "data"));
+    QVERIFY(store(QUrl(QLatin1String("http://example.com/old")), "old"));
+    QVERIFY(m_cache->remove(QUrl(QLatin1String("http://example.com/old"))));
+    delete m_cache;
+    QHash<QString, QByteArray> contents = directoryContents(m_directory);
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setReadOnly(true);
+    m_cache->setCacheDirectory(m_directory);
+    QVERIFY(m_cache->isReadOnly());
+    QCOMPARE(m_cache->entryCount(), 1);
+    QCOMPARE(m_cache->urls(), QList<QUrl>() << url);
+    QVERIFY(m_cache->metaData(url).isValid());
+    QCOMPARE(read(url), QByteArray("data"));
+    QVERIFY(!store(QUrl(QLatin1String("http://example.com/new")), "new"));
+    QVERIFY(!m_cache->remove(url));
+    m_cache->setMaximumCacheSize(1);
+    QVERIFY(!m_cache->isCompacting());
+    m_cache->clear();
+    QCOMPARE(m_cache->entryCount(), 1);
+    delete m_cache;
+    QVERIFY(directoryContents(m_directory) == contents);
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+}
+
+// An index that doesn't fit the shards is left for the browser to deal with
+void tst_NetworkDiskCache::readOnlyBrokenIndex()
+{
+    QUrl url(QLatin1String("http://example.com/"));
+    QVERIFY(store(url, "data"));
+    delete m_cache;
+
+    QFile index(m_directory + QLatin1String("/index"));
+    QVERIFY(index.open(QFile::WriteOnly | QFile::Append));
+    index.write("garbage");
+    index.close();
+    QHash<QString, QByteArray> contents = directoryContents(m_directory);
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setReadOnly(true);
+    m_cache->setCacheDirectory(m_directory);
+    QCOMPARE(m_cache->entryCount(), 0);
+    QVERIFY(!m_cache->metaData(url).isValid());
+    delete m_cache;
+    QVERIFY(directoryContents(m_directory) == contents);
+
+    // A directory that isn't there isn't created
+    m_cache = new NetworkDiskCache;
+    m_cache->setReadOnly(true);
+    m_cache->setCacheDirectory(m_directory + QLatin1String("/missing"));
+    QCOMPARE(m_cache->entryCount(), 0);
+    QVERIFY(!QFile::exists(m_directory + QLatin1String("/missing")));
+    delete m_cache;
+
+    m_cache = new NetworkDiskCache;
+    m_cache->setCacheDirectory(m_directory);
+}
+
+QTEST_MAIN(tst_NetworkDiskCache)
+#include "tst_networkdiskcache.moc"
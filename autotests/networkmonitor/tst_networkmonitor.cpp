@@ -0,0 +1,688 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <QtTest/QtTest>
+#include <QtGui/QtGui>
+#include <QtNetwork/QtNetwork>
+
+#include <harreader.h>
+#include <harwriter.h>
+#include <networkmonitor.h>
+#include "qtest_arora.h"
+
+class FakeReply : public QNetworkReply
+{
+    Q_OBJECT
+
+public:
+    FakeReply(const QUrl &url, QObject *parent = 0)
+        : QNetworkReply(parent)
+    {
+        setOperation(QNetworkAccessManager::GetOperation);
+        setRequest(QNetworkRequest(url));
+        setUrl(url);
+        open(QIODevice::ReadOnly);
+    }
+
+    void finish()
+    {
+        setAttribute(QNetworkRequest::HttpStatusCodeAttribute, 200);
+        setAttribute(QNetworkRequest::HttpReasonPhraseAttribute, QByteArray("OK"));
+        setRawHeader("Content-Type", "text/html");
+        setRawHeader("Content-Length", "10");
+        emit metaDataChanged();
+        emit readyRead();
+        emit downloadProgress(10, 10);
+        emit finished();
+    }
+
+    void setFromCache(bool fromCache)
+    {
+        setAttribute(QNetworkRequest::SourceIsFromCacheAttribute, fromCache);
+    }
+
+    void abort() {}
+
+protected:
+    qint64 readData(char *, qint64) { return -1; }
+};
+
+class tst_NetworkMonitor : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void headers();
+    void addRequest();
+    void wrapAround();
+    void finishAfterWrap();
+    void removeRows();
+    void removeAll();
+    void replyDestroyed();
+    void setMaximumRequests();
+    void timings();
+    void hostStatistics();
+    void hostStatisticsWrapAround();
+    void timelineScale();
+    void timelinePaint();
+    void filter();
+    void filterBenchmark();
+    void harRoundTrip();
+    void harImport();
+    void harSurrogates_data();
+    void harSurrogates();
+    void harInvalid_data();
+    void harInvalid();
+
+private:
+    void add(const QString &url, QNetworkReply *reply = 0);
+    void add(const QString &url, qint64 created, qint64 metaDataChanged, qint64 finished);
+    QString urlAt(int row) const;
+    bool sameAsRecounted() const;
+
+    RequestModel *m_model;
+};
+
+void tst_NetworkMonitor::init()
+{
+    m_model = new RequestModel;
+    m_model->setMaximumRequests(64);
+}
+
+void tst_NetworkMonitor::cleanup()
+{
+    delete m_model;
+}
+
+void tst_NetworkMonitor::add(const QString &url, QNetworkReply *reply)
+{
+    Request request;
+    request.url = QUrl(url).toEncoded();
+    request.reply = reply;
+    request.created = RequestModel::currentTime();
+    request.requestHeaders.append("Accept", "*/*");
+    m_model->addRequest(request);
+}
+
+void tst_NetworkMonitor::add(const QString &url, qint64 created, qint64 metaDataChanged, qint64 finished)
+{
+    Request request;
+    request.url = QUrl(url).toEncoded();
+    request.created = created;
+    request.metaDataChanged = metaDataChanged;
+    request.firstByte = metaDataChanged;
+    request.finished = finished;
+    m_model->addRequest(request);
+}
+
+QString tst_NetworkMonitor::urlAt(int row) const
+{
+    return m_model->index(row, RequestModel::AddressColumn).data().toString();
+}
+
+// The host statistics match the ones counted from all of the requests
+bool tst_NetworkMonitor::sameAsRecounted() const
+{
+    QMap<QString, HostStatistics> hosts;
+    for (int i = 0; i < m_model->rowCount(); ++i) {
+        const Request &request = m_model->requestAt(i);
+        QString name = QUrl::fromEncoded(request.url).host().toLower();
+        HostStatistics &host = hosts[name];
+        host.host = name;
+        ++host.requests;
+        if (request.fromCache)
+            ++host.fromCache;
+        host.bytesReceived += request.bytesReceived;
+        if (request.metaDataChanged != -1) {
+            host.waitTime += request.metaDataChanged - request.created;
+            ++host.waited;
+        }
+        if (request.finished != -1) {
+            host.totalTime += request.finished - request.created;
+            ++host.finished;
+        }
+    }
+
+    QList<HostStatistics> expected = hosts.values();
+    QList<HostStatistics> statistics = m_model->hostStatistics();
+    if (statistics.count() != expected.count())
+        return false;
+    for (int i = 0; i < expected.count(); ++i) {
+        const HostStatistics &a = statistics.at(i);
+        const HostStatistics &b = expected.at(i);
+        if (a.host != b.host || a.requests != b.requests || a.finished != b.finished
+            || a.fromCache != b.fromCache || a.bytesReceived != b.bytesReceived
+            || a.waitTime != b.waitTime || a.waited != b.waited || a.totalTime != b.totalTime) {
+            qWarning() << "mismatch for" << b.host;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+void tst_NetworkMonitor::headers()
+{
+    RequestHeaders headers;
+    QVERIFY(headers.isEmpty());
+    headers.append("Content-Type", "text/html");
+    headers.append("X-Empty", QByteArray());
+    headers.append("Set-Cookie", "a=b");
+    QVERIFY(!headers.isEmpty());
+
+    RequestHeaders::HeaderList list = headers.toList();
+    QCOMPARE(list.count(), 3);
+    QCOMPARE(list.at(0).first, QByteArray("Content-Type"));
+    QCOMPARE(list.at(0).second, QByteArray("text/html"));
+    QCOMPARE(list.at(1).first, QByteArray("X-Empty"));
+    QCOMPARE(list.at(1).second, QByteArray());
+    QCOMPARE(list.at(2).second, QByteArray("a=b"));
+    QCOMPARE(headers.value("content-type"), QByteArray("text/html"));
+    QCOMPARE(headers.value("Missing"), QByteArray());
+
+    // The name is shared with other header lists
+    RequestHeaders other;
+    other.append("Content-Type", "image/png");
+    QCOMPARE(other.toList().at(0).first, QByteArray("Content-Type"));
+    QCOMPARE(headers.value("Content-Type"), QByteArray("text/html"));
+
+    headers.clear();
+    QVERIFY(headers.isEmpty());
+}
+
+void tst_NetworkMonitor::addRequest()
+{
+    QSignalSpy spy(m_model, SIGNAL(rowsInserted(const QModelIndex &, int, int)));
+    add("http://example.com/");
+    QCOMPARE(m_model->rowCount(), 1);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(urlAt(0), QString("http://example.com/"));
+    QCOMPARE(m_model->index(0, RequestModel::MethodColumn).data().toString(), QString("GET"));
+    QCOMPARE(m_model->requestAt(0).requestHeaders.value("Accept"), QByteArray("*/*"));
+}
+
+void tst_NetworkMonitor::wrapAround()
+{
+    for (int i = 0; i < 64; ++i)
+        add(QString("http://example.com/%1").arg(i));
+    QCOMPARE(m_model->rowCount(), 64);
+
+    // The oldest make room in a batch, 64 / 32 at a time
+    QSignalSpy spy(m_model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)));
+    add(QLatin1String("http://example.com/64"));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_model->rowCount(), 63);
+    QCOMPARE(urlAt(0), QString("http://example.com/2"));
+    QCOMPARE(urlAt(62), QString("http://example.com/64"));
+
+    for (int i = 65; i < 200; ++i)
+        add(QString("http://example.com/%1").arg(i));
+    QVERIFY(m_model->rowCount() <= 64);
+    int rows = m_model->rowCount();
+    for (int i = 0; i < rows; ++i)
+        QCOMPARE(urlAt(i), QString("http://example.com/%1").arg(200 - rows + i));
+}
+
+void tst_NetworkMonitor::finishAfterWrap()
+{
+    FakeReply reply(QUrl("http://example.com/running"));
+    add(QLatin1String("http://example.com/running"), &reply);
+    for (int i = 0; i < 40; ++i)
+        add(QString("http://example.com/%1").arg(i));
+    FakeReply late(QUrl("http://example.com/late"));
+    add(QLatin1String("http://example.com/late"), &late);
+    for (int i = 40; i < 100; ++i)
+        add(QString("http://example.com/%1").arg(i));
+
+    // The first request was dropped from the log, its reply is forgotten
+    QCOMPARE(m_model->rowForReply(&reply), -1);
+    reply.finish();
+
+    int row = m_model->rowForReply(&late);
+    QVERIFY(row != -1);
+    QCOMPARE(urlAt(row), QString("http://example.com/late"));
+    late.finish();
+    QCOMPARE(m_model->rowForReply(&late), -1);
+    QCOMPARE(m_model->index(row, RequestModel::ResponseColumn).data().toString(), QString("200 OK"));
+    QCOMPARE(m_model->index(row, RequestModel::ContentTypeColumn).data().toString(), QString("text/html"));
+    QCOMPARE(m_model->requestAt(row).replyHeaders.value("Content-Type"), QByteArray("text/html"));
+}
+
+void tst_NetworkMonitor::removeRows()
+{
+    FakeReply reply(QUrl("http://example.com/running"));
+    for (int i = 0; i < 10; ++i)
+        add(QString("http://example.com/%1").arg(i));
+    add(QLatin1String("http://example.com/running"), &reply);
+    add(QLatin1String("http://example.com/last"));
+
+    QVERIFY(m_model->removeRows(3, 4, QModelIndex()));
+    QCOMPARE(m_model->rowCount(), 8);
+    QCOMPARE(urlAt(2), QString("http://example.com/2"));
+    QCOMPARE(urlAt(3), QString("http://example.com/7"));
+    QCOMPARE(urlAt(7), QString("http://example.com/last"));
+
+    int row = m_model->rowForReply(&reply);
+    QCOMPARE(row, 6);
+    reply.finish();
+    QCOMPARE(m_model->index(6, RequestModel::ResponseColumn).data().toString(), QString("200 OK"));
+
+    QVERIFY(!m_model->removeRows(6, 5, QModelIndex()));
+    add(QLatin1String("http://example.com/new"));
+    QCOMPARE(urlAt(8), QString("http://example.com/new"));
+}
+
+void tst_NetworkMonitor::removeAll()
+{
+    FakeReply reply(QUrl("http://example.com/running"));
+    add(QLatin1String("http://example.com/running"), &reply);
+    add(QLatin1String("http://example.com/"));
+    QVERIFY(m_model->removeRows(0, m_model->rowCount(), QModelIndex()));
+    QCOMPARE(m_model->rowCount(), 0);
+    QCOMPARE(m_model->rowForReply(&reply), -1);
+    reply.finish();
+
+    add(QLatin1String("http://example.com/again"));
+    QCOMPARE(m_model->rowCount(), 1);
+    QCOMPARE(urlAt(0), QString("http://example.com/again"));
+}
+
+void tst_NetworkMonitor::replyDestroyed()
+{
+    FakeReply *reply = new FakeReply(QUrl("http://example.com/"));
+    add(QLatin1String("http://example.com/"), reply);
+    QCOMPARE(m_model->rowForReply(reply), 0);
+    delete reply;
+    QCOMPARE(m_model->rowForReply(reply), -1);
+    QVERIFY(!m_model->requestAt(0).reply);
+}
+
+void tst_NetworkMonitor::setMaximumRequests()
+{
+    FakeReply reply(QUrl("http://example.com/running"));
+    for (int i = 0; i < 70; ++i)
+        add(QString("http://example.com/%1").arg(i));
+    add(QLatin1String("http://example.com/running"), &reply);
+
+    m_model->setMaximumRequests(10);
+    QCOMPARE(m_model->maximumRequests(), 10);
+    QCOMPARE(m_model->rowCount(), 10);
+    QCOMPARE(urlAt(0), QString("http://example.com/61"));
+    QCOMPARE(m_model->rowForReply(&reply), 9);
+
+    m_model->setMaximumRequests(20);
+    for (int i = 0; i < 5; ++i)
+        add(QString("http://example.com/more%1").arg(i));
+    QCOMPARE(m_model->rowCount(), 15);
+    QCOMPARE(m_model->rowForReply(&reply), 9);
+    reply.finish();
+    QCOMPARE(m_model->index(9, RequestModel::ResponseColumn).data().toString(), QString("200 OK"));
+}
+
+void tst_NetworkMonitor::timings()
+{
+    FakeReply reply(QUrl("http://example.com/"));
+    add(QLatin1String("http://example.com/"), &reply);
+    QCOMPARE(m_model->requestAt(0).finished, qint64(-1));
+    reply.finish();
+
+    const Request &request = m_model->requestAt(0);
+    QVERIFY(request.created >= 0);
+    QVERIFY(request.metaDataChanged >= request.created);
+    QVERIFY(request.firstByte >= request.metaDataChanged);
+    QVERIFY(request.finished >= request.firstByte);
+    QCOMPARE(request.bytesReceived, qint64(10));
+
+    QList<HostStatistics> hosts = m_model->hostStatistics();
+    QCOMPARE(hosts.count(), 1);
+    QCOMPARE(hosts.at(0).host, QString("example.com"));
+    QCOMPARE(hosts.at(0).requests, 1);
+    QCOMPARE(hosts.at(0).finished, 1);
+    QCOMPARE(hosts.at(0).bytesReceived, qint64(10));
+    QCOMPARE(hosts.at(0).waited, 1);
+    QCOMPARE(hosts.at(0).waitTime, request.metaDataChanged - request.created);
+    QCOMPARE(hosts.at(0).totalTime, request.finished - request.created);
+
+    QModelIndex timeline = m_model->index(0, RequestModel::TimelineColumn);
+    QCOMPARE(timeline.data(RequestModel::CreatedRole).toLongLong(), request.created);
+    QCOMPARE(timeline.data(RequestModel::MetaDataChangedRole).toLongLong(), request.metaDataChanged);
+    QCOMPARE(timeline.data(RequestModel::FirstByteRole).toLongLong(), request.firstByte);
+    QCOMPARE(timeline.data(RequestModel::FinishedRole).toLongLong(), request.finished);
+    QCOMPARE(timeline.data().toString(), QString("%1 ms").arg(request.finished - request.created));
+}
+
+void tst_NetworkMonitor::hostStatistics()
+{
+    FakeReply cached(QUrl("http://a.com/cached"));
+    cached.setFromCache(true);
+    add(QLatin1String("http://a.com/cached"), &cached);
+    FakeReply running(QUrl("http://A.com:8080/running"));
+    add(QLatin1String("http://A.com:8080/running"), &running);
+    add(QLatin1String("http://user@b.org/"), 100, 150, 400);
+    add(QLatin1String("http://b.org/other"), 200, 220, 300);
+    QVERIFY(sameAsRecounted());
+
+    cached.finish();
+    QVERIFY(sameAsRecounted());
+    QList<HostStatistics> hosts = m_model->hostStatistics();
+    QCOMPARE(hosts.count(), 2);
+    QCOMPARE(hosts.at(0).host, QString("a.com"));
+    QCOMPARE(hosts.at(0).requests, 2);
+    QCOMPARE(hosts.at(0).finished, 1);
+    QCOMPARE(hosts.at(0).fromCache, 1);
+    QCOMPARE(hosts.at(0).bytesReceived, qint64(10));
+    QCOMPARE(hosts.at(1).host, QString("b.org"));
+    QCOMPARE(hosts.at(1).requests, 2);
+    QCOMPARE(hosts.at(1).waited, 2);
+    QCOMPARE(hosts.at(1).waitTime, qint64(50 + 20));
+    QCOMPARE(hosts.at(1).finished, 2);
+    QCOMPARE(hosts.at(1).totalTime, qint64(300 + 100));
+
+    running.finish();
+    QVERIFY(sameAsRecounted());
+    QCOMPARE(m_model->hostStatistics().at(0).finished, 2);
+    QCOMPARE(m_model->hostStatistics().at(0).bytesReceived, qint64(20));
+
+    // Removed requests are taken out, hosts without requests go away
+    QVERIFY(m_model->removeRows(2, 1, QModelIndex()));
+    QVERIFY(sameAsRecounted());
+    QCOMPARE(m_model->hostStatistics().at(1).requests, 1);
+    QCOMPARE(m_model->hostStatistics().at(1).totalTime, qint64(100));
+    QVERIFY(m_model->removeRows(0, 2, QModelIndex()));
+    QVERIFY(sameAsRecounted());
+    QCOMPARE(m_model->hostStatistics().count(), 1);
+    QCOMPARE(m_model->hostStatistics().at(0).host, QString("b.org"));
+    QVERIFY(m_model->removeRows(0, 1, QModelIndex()));
+    QVERIFY(m_model->hostStatistics().isEmpty());
+}
+
+// The statistics follow the requests as the oldest make room for new ones
+void tst_NetworkMonitor::hostStatisticsWrapAround()
+{
+    for (int i = 0; i < 200; ++i) {
+        add(QString("http://host%1.com/%2").arg(i % 7).arg(i), i, i + 1, i + 1 + i % 5);
+        if (i % 50 == 0)
+            QVERIFY(sameAsRecounted());
+    }
+    QVERIFY(sameAsRecounted());
+    m_model->setMaximumRequests(10);
+    QVERIFY(sameAsRecounted());
+    QVERIFY(m_model->removeRows(3, 4, QModelIndex()));
+    QVERIFY(sameAsRecounted());
+}
+
+void tst_NetworkMonitor::timelineScale()
+{
+    QSignalSpy spy(m_model, SIGNAL(timelineChanged()));
+    QCOMPARE(m_model->timelineStart(), qint64(-1));
+    QCOMPARE(m_model->timelineEnd(), qint64(-1));
+
+    // Finished requests, as imported, cover their whole time
+    add(QLatin1String("http://example.com/a"), 1000, 1100, 1500);
+    QCOMPARE(m_model->timelineStart(), qint64(1000));
+    QCOMPARE(m_model->timelineEnd(), qint64(1500));
+    QCOMPARE(spy.count(), 1);
+
+    // Within the scale
+    add(QLatin1String("http://example.com/b"), 1200, 1250, 1300);
+    QCOMPARE(spy.count(), 1);
+
+    // An earlier start changes the scale as well
+    add(QLatin1String("http://example.com/c"), 500, -1, -1);
+    QCOMPARE(m_model->timelineStart(), qint64(500));
+    QCOMPARE(m_model->timelineEnd(), qint64(1500));
+    QCOMPARE(spy.count(), 2);
+
+    FakeReply reply(QUrl("http://example.com/running"));
+    add(QLatin1String("http://example.com/running"), &reply);
+    qint64 created = m_model->requestAt(3).created;
+    QCOMPARE(m_model->timelineEnd(), qMax(qint64(1500), created));
+    reply.finish();
+    QCOMPARE(m_model->timelineEnd(), qMax(qint64(1500), m_model->requestAt(3).finished));
+
+    QVERIFY(m_model->removeRows(0, m_model->rowCount(), QModelIndex()));
+    QCOMPARE(m_model->timelineStart(), qint64(-1));
+    QCOMPARE(m_model->timelineEnd(), qint64(-1));
+}
+
+// The bars are drawn on the scale of the whole timeline
+void tst_NetworkMonitor::timelinePaint()
+{
+    add(QLatin1String("http://example.com/a"), 1000, 1500, 2000);
+    add(QLatin1String("http://example.com/b"), 1500, 1500, 1750);
+
+    RequestTimelineDelegate delegate(m_model);
+    QStyleOptionViewItemV4 option;
+    // 100 pixels wide inside the margins
+    option.rect = QRect(0, 0, 104, 20);
+    option.palette.setColor(QPalette::Highlight, Qt::red);
+    QRgb red = QColor(Qt::red).rgb();
+
+    QImage first(104, 20, QImage::Format_RGB32);
+    first.fill(QColor(Qt::white).rgb());
+    {
+        QPainter painter(&first);
+        delegate.paint(&painter, option, m_model->index(0, RequestModel::TimelineColumn));
+    }
+    // Waiting for the first half, then receiving until the end
+    QVERIFY(first.pixel(10, 10) != red);
+    QVERIFY(first.pixel(10, 10) != QColor(Qt::white).rgb());
+    QCOMPARE(first.pixel(60, 10), red);
+    QCOMPARE(first.pixel(100, 10), red);
+
+    QImage second(104, 20, QImage::Format_RGB32);
+    second.fill(QColor(Qt::white).rgb());
+    {
+        QPainter painter(&second);
+        delegate.paint(&painter, option, m_model->index(1, RequestModel::TimelineColumn));
+    }
+    // From the middle to three quarters
+    QVERIFY(second.pixel(30, 10) != red);
+    QCOMPARE(second.pixel(65, 10), red);
+    QVERIFY(second.pixel(90, 10) != red);
+}
+
+void tst_NetworkMonitor::filter()
+{
+    add(QLatin1String("http://Example.com/a"));
+    add(QLatin1String("http://other.org/b"));
+    add(QLatin1String("http://www.example.com/c"));
+
+    RequestFilterModel proxy(m_model);
+    QCOMPARE(proxy.rowCount(), 3);
+    proxy.setFilter(QLatin1String("EXAMPLE"));
+    QCOMPARE(proxy.rowCount(), 2);
+    proxy.setFilter(QLatin1String("get"));
+    QCOMPARE(proxy.rowCount(), 3);
+    proxy.setFilter(QLatin1String("nothing"));
+    QCOMPARE(proxy.rowCount(), 0);
+
+    // New requests are filtered as they come in
+    add(QLatin1String("http://nothing.net/"));
+    QCOMPARE(proxy.rowCount(), 1);
+    proxy.setFilter(QString());
+    QCOMPARE(proxy.rowCount(), 4);
+}
+
+void tst_NetworkMonitor::filterBenchmark()
+{
+    m_model->setMaximumRequests(100000);
+    for (int i = 0; i < 100000; ++i)
+        add(QString("http://host%1.example.com/path/to/resource%2.png?query=%3").arg(i % 300).arg(i).arg(i * 7));
+    QCOMPARE(m_model->rowCount(), 100000);
+
+    RequestFilterModel proxy(m_model);
+    int i = 0;
+    QBENCHMARK {
+        proxy.setFilter(QString("resource%1").arg(i++ % 10));
+        QVERIFY(proxy.rowCount() > 0);
+    }
+}
+
+void tst_NetworkMonitor::harRoundTrip()
+{
+    FakeReply reply(QUrl("http://example.com/page?a=1&b=two"));
+    add(QLatin1String("http://example.com/page?a=1&b=two"), &reply);
+    reply.finish();
+    add(QLatin1String("http://example.com/running"));
+
+    QBuffer buffer;
+    buffer.open(QIODevice::ReadWrite);
+    HarWriter writer;
+    QVERIFY(writer.write(&buffer, m_model));
+    QVERIFY(buffer.data().startsWith("{\"log\":{\"version\":\"1.2\""));
+
+    RequestModel imported;
+    buffer.seek(0);
+    HarReader reader;
+    QVERIFY(reader.read(&buffer, &imported));
+    QCOMPARE(reader.errorString(), QString());
+    QCOMPARE(reader.entries(), 2);
+    QCOMPARE(imported.rowCount(), 2);
+
+    const Request &original = m_model->requestAt(0);
+    const Request &request = imported.requestAt(0);
+    QCOMPARE(request.op, original.op);
+    QCOMPARE(request.url, original.url);
+    QCOMPARE(request.status, 200);
+    QCOMPARE(request.reason, QString("OK"));
+    QCOMPARE(request.contentType, QString("text/html"));
+    QCOMPARE(request.bytesReceived, qint64(10));
+    QCOMPARE(request.length, qint64(10));
+    QCOMPARE(request.requestHeaders.value("Accept"), QByteArray("*/*"));
+    QCOMPARE(request.replyHeaders.value("Content-Type"), QByteArray("text/html"));
+    QCOMPARE(request.finished - request.created, original.finished - original.created);
+    QCOMPARE(imported.index(0, RequestModel::ResponseColumn).data().toString(), QString("200 OK"));
+    QCOMPARE(imported.requestAt(1).url, QByteArray("http://example.com/running"));
+}
+
+void tst_NetworkMonitor::harImport()
+{
+    QByteArray har =
+        "\xef\xbb\xbf{\"log\": {\n"
+        "  \"version\": \"1.2\", \"creator\": {\"name\": \"Other\", \"version\": \"1\"},\n"
+        "  \"pages\": [{\"id\": \"page_1\", \"title\": \"T\\u00e9st \\\"quoted\\\"\"}],\n"
+        "  \"entries\": [\n"
+        "   {\"startedDateTime\": \"2009-06-01T12:00:00.100+02:00\", \"time\": 250.4,\n"
+        "    \"request\": {\"method\": \"POST\", \"url\": \"http://example.com/form\",\n"
+        "                \"headers\": [{\"name\": \"X-Test\", \"value\": \"a\\tb\"}]},\n"
+        "    \"response\": {\"status\": 404, \"statusText\": \"Not Found\", \"headers\": [],\n"
+        "                 \"content\": {\"size\": 512, \"mimeType\": \"text/plain\"}, \"bodySize\": -1},\n"
+        "    \"timings\": {\"blocked\": -1, \"send\": 10, \"wait\": 90.2, \"receive\": 150},\n"
+        "    \"_unknown\": [1, 2.5e3, true, null]},\n"
+        "   {\"startedDateTime\": \"2009-06-01T10:00:01Z\", \"time\": 0,\n"
+        "    \"request\": {\"method\": \"GET\", \"url\": \"http://example.com/later\"},\n"
+        "    \"response\": {\"status\": 200, \"statusText\": \"OK\"}, \"timings\": {}}\n"
+        "  ]\n"
+        "}}\n";
+    QBuffer buffer(&har);
+    buffer.open(QIODevice::ReadOnly);
+
+    HarReader reader;
+    QVERIFY(reader.read(&buffer, m_model));
+    QCOMPARE(reader.entries(), 2);
+    QCOMPARE(m_model->rowCount(), 2);
+
+    const Request &first = m_model->requestAt(0);
+    QCOMPARE(first.op, QNetworkAccessManager::PostOperation);
+    QCOMPARE(first.url, QByteArray("http://example.com/form"));
+    QCOMPARE(first.requestHeaders.value("X-Test"), QByteArray("a\tb"));
+    QCOMPARE(first.status, 404);
+    QCOMPARE(first.reason, QString("Not Found"));
+    QCOMPARE(first.contentType, QString("text/plain"));
+    QCOMPARE(first.bytesReceived, qint64(512));
+    QCOMPARE(first.finished - first.created, qint64(250));
+    QCOMPARE(first.metaDataChanged - first.created, qint64(100));
+
+    // 12:00:00.100+02:00 is 10:00:00.100 UTC
+    const Request &second = m_model->requestAt(1);
+    QCOMPARE(second.created - first.created, qint64(900));
+    QCOMPARE(second.finished, second.created);
+}
+
+void tst_NetworkMonitor::harSurrogates_data()
+{
+    QTest::addColumn<QByteArray>("escaped");
+    QTest::addColumn<QString>("reason");
+
+    QChar pair[2] = { QChar(0xd83d), QChar(0xde00) };
+    QString emoji(pair, 2);
+    QString replacement(QChar(QChar::ReplacementCharacter));
+    QTest::newRow("pair") << QByteArray("a\\ud83d\\ude00b") << QString("a" + emoji + "b");
+    QTest::newRow("high at the end") << QByteArray("a\\ud83d") << QString("a" + replacement);
+    QTest::newRow("high then text") << QByteArray("\\ud83dab") << QString(replacement + "ab");
+    QTest::newRow("high then escape") << QByteArray("\\ud83d\\n") << QString(replacement + "\n");
+    QTest::newRow("two highs") << QByteArray("\\ud83d\\ud83d\\ude00") << QString(replacement + emoji);
+    QTest::newRow("high then other") << QByteArray("\\ud83d\\u0041") << QString(replacement + "A");
+    QTest::newRow("lone low") << QByteArray("\\ude00a") << QString(replacement + "a");
+}
+
+// Surrogates that are not paired become U+FFFD without eating what follows
+void tst_NetworkMonitor::harSurrogates()
+{
+    QFETCH(QByteArray, escaped);
+    QFETCH(QString, reason);
+
+    QByteArray har =
+        "{\"log\": {\"version\": \"1.2\", \"entries\": [\n"
+        "   {\"startedDateTime\": \"2009-06-01T10:00:01Z\", \"time\": 0,\n"
+        "    \"request\": {\"method\": \"GET\", \"url\": \"http://example.com/\"},\n"
+        "    \"response\": {\"status\": 200, \"statusText\": \"" + escaped + "\"}, \"timings\": {}}\n"
+        "  ]\n"
+        "}}\n";
+    QBuffer buffer(&har);
+    buffer.open(QIODevice::ReadOnly);
+
+    HarReader reader;
+    QVERIFY(reader.read(&buffer, m_model));
+    QCOMPARE(m_model->rowCount(), 1);
+    QCOMPARE(m_model->requestAt(0).reason, reason);
+}
+
+void tst_NetworkMonitor::harInvalid_data()
+{
+    QTest::addColumn<QByteArray>("har");
+    QTest::addColumn<int>("entries");
+    QTest::newRow("empty") << QByteArray() << 0;
+    QTest::newRow("not an object") << QByteArray("[]") << 0;
+    QTest::newRow("truncated") << QByteArray("{\"log\":{\"entries\":[{\"time\":1},{\"time\":") << 1;
+    QTest::newRow("unterminated string") << QByteArray("{\"log\":{\"version\":\"1.2") << 0;
+    QTest::newRow("bad literal") << QByteArray("{\"log\":{\"entries\":[{\"x\":nope}]}}") << 0;
+}
+
+void tst_NetworkMonitor::harInvalid()
+{
+    QFETCH(QByteArray, har);
+    QFETCH(int, entries);
+    QBuffer buffer(&har);
+    buffer.open(QIODevice::ReadOnly);
+
+    HarReader reader;
+    QVERIFY(!reader.read(&buffer, m_model));
+    QVERIFY(!reader.errorString().isEmpty());
+    QCOMPARE(reader.entries(), entries);
+    QCOMPARE(m_model->rowCount(), entries);
+}
+
+QTEST_MAIN(tst_NetworkMonitor)
+#include "tst_networkmonitor.moc"
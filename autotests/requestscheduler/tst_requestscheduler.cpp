@@ -0,0 +1,358 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <qtest.h>
+#include <qtcpserver.h>
+#include <qtcpsocket.h>
+
+#include "qtry.h"
+
+#include <requestscheduler.h>
+
+/*
+    Stands in for a web server, answers every request with its path
+    and remembers the order the requests arrived in.
+  */
+class HttpServer : public QTcpServer
+{
+    Q_OBJECT
+
+public:
+    HttpServer(QObject *parent = 0);
+
+    QStringList requests;
+
+private slots:
+    void acceptConnections();
+    void readRequests();
+    void connectionClosed();
+
+private:
+    QHash<QTcpSocket*, QByteArray> m_buffers;
+};
+
+HttpServer::HttpServer(QObject *parent)
+    : QTcpServer(parent)
+{
+    connect(this, SIGNAL(newConnection()),
+            this, SLOT(acceptConnections()));
+    listen(QHostAddress::LocalHost);
+}
+
+void HttpServer::acceptConnections()
+{
+    while (hasPendingConnections()) {
+        QTcpSocket *socket = nextPendingConnection();
+        connect(socket, SIGNAL(readyRead()),
+                this, SLOT(readRequests()));
+        connect(socket, SIGNAL(disconnected()),
+                this, SLOT(connectionClosed()));
+    }
+}
+
+void HttpServer::readRequests()
+{
+    QTcpSocket *socket = qobject_cast<QTcpSocket*>(sender());
+    QByteArray &buffer = m_buffers[socket];
+    buffer += socket->readAll();
+
+    int end;
+    while ((end = buffer.indexOf("\r\n\r\n")) != -1) {
+        QByteArray requestLine = buffer.left(buffer.indexOf("\r\n"));
+        buffer.remove(0, end + 4);
+        QByteArray path = requestLine.split(' ').value(1);
+        requests.append(QString::fromLatin1(path));
+        socket->write("HTTP/1.1 200 OK\r\n"
+                      "Content-Type: text/plain\r\n"
+                      "Content-Length: " + QByteArray::number(path.length()) + "\r\n"
+                      "\r\n" + path);
+    }
+}
+
+void HttpServer::connectionClosed()
+{
+    QTcpSocket *socket = qobject_cast<QTcpSocket*>(sender());
+    m_buffers.remove(socket);
+    socket->deleteLater();
+}
+
+// A manager that passes its requests through a scheduler
+class TestManager : public QNetworkAccessManager
+{
+public:
+    TestManager() : scheduler(new RequestScheduler(this)) {}
+
+    RequestScheduler *scheduler;
+
+protected:
+    QNetworkReply *createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData)
+    {
+        if (RequestScheduler::canSchedule(op, request))
+            return scheduler->schedule(op, request);
+        return QNetworkAccessManager::createRequest(op, request, outgoingData);
+    }
+};
+
+class tst_RequestScheduler : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void priority_data();
+    void priority();
+    void hostLimit();
+    void priorityOrder();
+    void reprioritize();
+    void abortQueued();
+    void replyContents();
+    void detach();
+
+protected slots:
+    void replyFinished();
+
+private:
+    QNetworkReply *get(const QString &path, QObject *page = 0, bool mainFrame = false);
+
+    HttpServer *m_server;
+    TestManager *m_manager;
+    QStringList m_finished;
+};
+
+void tst_RequestScheduler::init()
+{
+    m_server = new HttpServer;
+    QVERIFY(m_server->isListening());
+    m_manager = new TestManager;
+    m_finished.clear();
+}
+
+void tst_RequestScheduler::cleanup()
+{
+    delete m_manager;
+    delete m_server;
+}
+
+void tst_RequestScheduler::replyFinished()
+{
+    QNetworkReply *reply = qobject_cast<QNetworkReply*>(sender());
+    m_finished.append(reply->url().path());
+}
+
+QNetworkReply *tst_RequestScheduler::get(const QString &path, QObject *page, bool mainFrame)
+{
+    QUrl url(QString(QLatin1String("http://127.0.0.1:%1%2")).arg(m_server->serverPort()).arg(path));
+    QNetworkRequest request(url);
+    if (page)
+        request.setAttribute(RequestScheduler::PageAttribute, qVariantFromValue(page));
+    if (mainFrame)
+        request.setAttribute(RequestScheduler::MainFrameAttribute, true);
+    QNetworkReply *reply = m_manager->get(request);
+    connect(reply, SIGNAL(finished()), this, SLOT(replyFinished()));
+    return reply;
+}
+
+Q_DECLARE_METATYPE(RequestScheduler::Priority)
+void tst_RequestScheduler::priority_data()
+{
+    QTest::addColumn<QString>("path");
+    QTest::addColumn<int>("page");
+    QTest::addColumn<int>("frame");
+    QTest::addColumn<int>("explicitPriority");
+    QTest::addColumn<RequestScheduler::Priority>("priority");
+
+    // page: 0 none, 1 the current page, 2 another page
+    // frame: 0 a subresource, 1 the main frame, 2 a sub frame
+    QTest::newRow("no page") << "/" << 0 << 0 << -1 << RequestScheduler::CurrentPagePriority;
+    QTest::newRow("main frame") << "/" << 1 << 1 << -1 << RequestScheduler::CurrentMainFramePriority;
+    QTest::newRow("sub frame") << "/frame" << 1 << 2 << -1 << RequestScheduler::CurrentMainFramePriority;
+    QTest::newRow("subresource") << "/style.css" << 1 << 0 << -1 << RequestScheduler::CurrentPagePriority;
+    QTest::newRow("background main frame") << "/" << 2 << 1 << -1 << RequestScheduler::BackgroundPagePriority;
+    QTest::newRow("background") << "/style.css" << 2 << 0 << -1 << RequestScheduler::BackgroundPagePriority;
+    QTest::newRow("favicon") << "/favicon.ico" << 1 << 0 << -1 << RequestScheduler::SpeculativePriority;
+    QTest::newRow("explicit") << "/" << 0 << 0 << int(RequestScheduler::SpeculativePriority)
+                              << RequestScheduler::SpeculativePriority;
+    QTest::newRow("explicit wins") << "/" << 2 << 0 << int(RequestScheduler::CurrentMainFramePriority)
+                                   << RequestScheduler::CurrentMainFramePriority;
+}
+
+void tst_RequestScheduler::priority()
+{
+    QFETCH(QString, path);
+    QFETCH(int, page);
+    QFETCH(int, frame);
+    QFETCH(int, explicitPriority);
+    QFETCH(RequestScheduler::Priority, priority);
+
+    QObject currentPage;
+    QObject otherPage;
+    m_manager->scheduler->setCurrentPage(&currentPage);
+
+    QNetworkRequest request(QUrl(QLatin1String("http://example.com") + path));
+    if (page)
+        request.setAttribute(RequestScheduler::PageAttribute,
+                             qVariantFromValue(page == 1 ? &currentPage : &otherPage));
+    if (frame == 1)
+        request.setAttribute(RequestScheduler::MainFrameAttribute, true);
+    if (frame == 2)
+        request.setAttribute(RequestScheduler::SubFrameAttribute, true);
+    if (explicitPriority != -1)
+        request.setAttribute(RequestScheduler::PriorityAttribute, explicitPriority);
+    QCOMPARE(m_manager->scheduler->priority(request), priority);
+}
+
+void tst_RequestScheduler::hostLimit()
+{
+    m_manager->scheduler->setMaximumRequestsPerHost(2);
+    for (int i = 0; i < 5; ++i)
+        get(QString(QLatin1String("/%1")).arg(i));
+    QCOMPARE(m_manager->scheduler->runningRequests(), 2);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 3);
+
+    QTRY_COMPARE(m_finished.count(), 5);
+    QCOMPARE(m_manager->scheduler->runningRequests(), 0);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 0);
+    QCOMPARE(m_server->requests.count(), 5);
+}
+
+void tst_RequestScheduler::priorityOrder()
+{
+    QObject currentPage;
+    QObject otherPage;
+    m_manager->scheduler->setCurrentPage(&currentPage);
+    m_manager->scheduler->setMaximumRequestsPerHost(1);
+
+    // Keeps the host busy while the others are queued
+    get(QLatin1String("/first"), &otherPage);
+    get(QLatin1String("/favicon.ico"), &currentPage);
+    get(QLatin1String("/background"), &otherPage);
+    get(QLatin1String("/subresource"), &currentPage);
+    get(QLatin1String("/nopage"));
+    get(QLatin1String("/main"), &currentPage, true);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 5);
+
+    QTRY_COMPARE(m_finished.count(), 6);
+    QStringList expected;
+    expected << QLatin1String("/first")
+             << QLatin1String("/main")
+             << QLatin1String("/subresource")
+             << QLatin1String("/nopage")
+             << QLatin1String("/background")
+             << QLatin1String("/favicon.ico");
+    QCOMPARE(m_finished, expected);
+    QCOMPARE(m_server->requests, expected);
+}
+
+void tst_RequestScheduler::reprioritize()
+{
+    QObject firstPage;
+    QObject secondPage;
+    m_manager->scheduler->setCurrentPage(&firstPage);
+    m_manager->scheduler->setMaximumRequestsPerHost(1);
+
+    get(QLatin1String("/first"), &firstPage);
+    get(QLatin1String("/first/1"), &firstPage);
+    get(QLatin1String("/first/2"), &firstPage);
+    get(QLatin1String("/second/1"), &secondPage);
+    get(QLatin1String("/second/2"), &secondPage);
+
+    // Switching tabs lets the requests of the new tab overtake
+    m_manager->scheduler->setCurrentPage(&secondPage);
+
+    QTRY_COMPARE(m_finished.count(), 5);
+    QStringList expected;
+    expected << QLatin1String("/first")
+             << QLatin1String("/second/1")
+             << QLatin1String("/second/2")
+             << QLatin1String("/first/1")
+             << QLatin1String("/first/2");
+    QCOMPARE(m_finished, expected);
+}
+
+void tst_RequestScheduler::abortQueued()
+{
+    m_manager->scheduler->setMaximumRequestsPerHost(1);
+    get(QLatin1String("/first"));
+    QNetworkReply *queued = get(QLatin1String("/aborted"));
+    get(QLatin1String("/last"));
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 2);
+
+    queued->abort();
+    QCOMPARE(queued->error(), QNetworkReply::OperationCanceledError);
+    QCOMPARE(m_finished, QStringList() << QLatin1String("/aborted"));
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 1);
+
+    // Deleting a queued reply takes it out of the queue as well
+    QNetworkReply *deleted = get(QLatin1String("/deleted"));
+    delete deleted;
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 1);
+
+    QTRY_COMPARE(m_finished.count(), 3);
+    QCOMPARE(m_server->requests, QStringList() << QLatin1String("/first") << QLatin1String("/last"));
+}
+
+void tst_RequestScheduler::replyContents()
+{
+    m_manager->scheduler->setMaximumRequestsPerHost(1);
+    QNetworkReply *first = get(QLatin1String("/first"));
+    QNetworkReply *queued = get(QLatin1String("/queued"));
+    QVERIFY(qobject_cast<ScheduledNetworkReply*>(queued));
+    QSignalSpy metaDataSpy(queued, SIGNAL(metaDataChanged()));
+    QSignalSpy readyReadSpy(queued, SIGNAL(readyRead()));
+
+    QTRY_COMPARE(m_finished.count(), 2);
+    QCOMPARE(first->readAll(), QByteArray("/first"));
+    QVERIFY(metaDataSpy.count() > 0);
+    QVERIFY(readyReadSpy.count() > 0);
+    QCOMPARE(queued->error(), QNetworkReply::NoError);
+    QCOMPARE(queued->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), 200);
+    QCOMPARE(queued->header(QNetworkRequest::ContentTypeHeader).toString(), QString(QLatin1String("text/plain")));
+    QCOMPARE(queued->readAll(), QByteArray("/queued"));
+}
+
+void tst_RequestScheduler::detach()
+{
+    m_manager->scheduler->setMaximumRequestsPerHost(1);
+    QNetworkReply *download = get(QLatin1String("/download"));
+    QNetworkReply *queuedDownload = get(QLatin1String("/queued/download"));
+    get(QLatin1String("/page"));
+    QCOMPARE(m_manager->scheduler->runningRequests(), 1);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 2);
+
+    // A waiting download starts without taking any room
+    m_manager->scheduler->detach(queuedDownload);
+    QCOMPARE(m_manager->scheduler->runningRequests(), 1);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 1);
+
+    // A running download gives its room to the next request
+    m_manager->scheduler->detach(download);
+    QCOMPARE(m_manager->scheduler->runningRequests(), 1);
+    QCOMPARE(m_manager->scheduler->queuedRequests(), 0);
+
+    QTRY_COMPARE(m_finished.count(), 3);
+    QCOMPARE(m_manager->scheduler->runningRequests(), 0);
+    QCOMPARE(m_server->requests.count(), 3);
+    QCOMPARE(queuedDownload->readAll(), QByteArray("/queued/download"));
+}
+
+QTEST_MAIN(tst_RequestScheduler)
+#include "tst_requestscheduler.moc"
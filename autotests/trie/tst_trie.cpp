@@ -0,0 +1,197 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <QtTest/QtTest>
+#include "qtest_arora.h"
+
+#include <trie_p.h>
+
+class tst_Trie : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void flatTrie();
+    void flatTrieStream();
+    void lookup_data();
+    void lookup();
+    void insert_data();
+    void insert();
+};
+
+// Reversed host names in the order a cookie jar sees them
+static QList<QStringList> hostKeys(int count)
+{
+    static const char *tlds[] = { "com", "org", "net", "co.uk", "de", "fr" };
+    static const char *names[] = { "www", "static", "images", "login", "api", "m" };
+    QList<QStringList> keys;
+    for (int i = 0; i < count; ++i) {
+        QString host = QString("%1.site%2.%3")
+                       .arg(names[i % 6])
+                       .arg((i * 7919) % (count / 3 + 1))
+                       .arg(tlds[(i / 6) % 6]);
+        keys.append(host.split(QLatin1Char('.')));
+    }
+    return keys;
+}
+
+// FlatTrie gives the same answers as Trie
+void tst_Trie::flatTrie()
+{
+    Trie<int> trie;
+    FlatTrie<int> flat;
+    QVERIFY(flat.isEmpty());
+
+    QList<QStringList> keys = hostKeys(3000);
+    for (int i = 0; i < keys.count(); ++i) {
+        trie.insert(keys.at(i), i % 7);
+        flat.insert(keys.at(i), i % 7);
+    }
+    QCOMPARE(flat.all(), trie.all());
+
+    // Remove half, including values that are not there
+    for (int i = 0; i < keys.count(); i += 2) {
+        QCOMPARE(flat.remove(keys.at(i), i % 7), trie.remove(keys.at(i), i % 7));
+        QCOMPARE(flat.remove(keys.at(i), 8), trie.remove(keys.at(i), 8));
+    }
+    QCOMPARE(flat.all(), trie.all());
+
+    QList<QStringList> lookups = keys;
+    lookups << QStringList() << (QStringList() << "com") << (QStringList() << "nothere" << "com");
+    foreach (const QStringList &key, lookups) {
+        QCOMPARE(flat.find(key), trie.find(key));
+        QCOMPARE(flat.contains(key), trie.contains(key));
+    }
+
+    // Removed branches can be added again
+    for (int i = 0; i < keys.count(); i += 2)
+        flat.insert(keys.at(i), i);
+    QVERIFY(flat.all().count() > trie.all().count());
+    foreach (const QStringList &key, keys) {
+        foreach (int value, flat.find(key))
+            QVERIFY(flat.remove(key, value));
+    }
+    QVERIFY(flat.isEmpty());
+    QCOMPARE(flat.all(), QList<int>());
+
+    flat.insert(keys.first(), 1);
+    flat.clear();
+    QVERIFY(flat.isEmpty());
+    QVERIFY(!flat.contains(keys.first()));
+}
+
+// Both tries read what the other one wrote
+void tst_Trie::flatTrieStream()
+{
+    Trie<QString> trie;
+    FlatTrie<QString> flat;
+    QList<QStringList> keys = hostKeys(500);
+    for (int i = 0; i < keys.count(); ++i) {
+        trie.insert(keys.at(i), QString::number(i));
+        flat.insert(keys.at(i), QString::number(i));
+    }
+
+    QByteArray trieData;
+    {
+        QDataStream stream(&trieData, QIODevice::WriteOnly);
+        stream << trie;
+    }
+    QByteArray flatData;
+    {
+        QDataStream stream(&flatData, QIODevice::WriteOnly);
+        stream << flat;
+    }
+    QCOMPARE(flatData, trieData);
+
+    FlatTrie<QString> flatCopy;
+    QDataStream flatStream(trieData);
+    flatStream >> flatCopy;
+    QCOMPARE(flatCopy.all(), trie.all());
+    QCOMPARE(flatCopy.find(keys.at(42)), trie.find(keys.at(42)));
+
+    Trie<QString> trieCopy;
+    QDataStream trieStream(flatData);
+    trieStream >> trieCopy;
+    QCOMPARE(trieCopy.all(), trie.all());
+}
+
+void tst_Trie::lookup_data()
+{
+    QTest::addColumn<bool>("flat");
+    QTest::addColumn<int>("count");
+    QTest::newRow("trie-1k") << false << 1000;
+    QTest::newRow("flat-1k") << true << 1000;
+    QTest::newRow("trie-50k") << false << 50000;
+    QTest::newRow("flat-50k") << true << 50000;
+}
+
+// Every domain suffix of a host like NetworkCookieJar::cookiesForUrl()
+void tst_Trie::lookup()
+{
+    QFETCH(bool, flat);
+    QFETCH(int, count);
+
+    QList<QStringList> keys = hostKeys(count);
+    Trie<int> trie;
+    FlatTrie<int> flatTrie;
+    for (int i = 0; i < keys.count(); ++i) {
+        if (flat)
+            flatTrie.insert(keys.at(i), i);
+        else
+            trie.insert(keys.at(i), i);
+    }
+
+    int found = 0;
+    QBENCHMARK {
+        for (int i = 0; i < keys.count(); i += 7) {
+            QStringList key = keys.at(i);
+            while (!key.isEmpty()) {
+                found += flat ? flatTrie.find(key).count() : trie.find(key).count();
+                key.removeFirst();
+            }
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+void tst_Trie::insert_data()
+{
+    lookup_data();
+}
+
+void tst_Trie::insert()
+{
+    QFETCH(bool, flat);
+    QFETCH(int, count);
+
+    QList<QStringList> keys = hostKeys(count);
+    QBENCHMARK {
+        Trie<int> trie;
+        FlatTrie<int> flatTrie;
+        for (int i = 0; i < keys.count(); ++i) {
+            if (flat)
+                flatTrie.insert(keys.at(i), i);
+            else
+                trie.insert(keys.at(i), i);
+        }
+    }
+}
+
+QTEST_MAIN(tst_Trie)
+#include "tst_trie.moc"
@@ -59,13 +59,6 @@ int main(int argc, char **argv)
     historyMenuModelView->setModel(menuModel);
     tabWidget.addTab(historyMenuModelView, "HistoryMenuModel");
 
-    QTableView *historyCompletionModelView = new QTableView(&tabWidget);
-    historyCompletionModelView->horizontalHeader()->setStretchLastSection(true);
-    HistoryCompletionModel *completionModel = new HistoryCompletionModel(&tabWidget);
-    completionModel->setSourceModel(history.historyFilterModel());
-    historyCompletionModelView->setModel(completionModel);
-    tabWidget.addTab(historyCompletionModelView, "HistoryCompletionModel");
-
     HistoryDialog dialog;
     tabWidget.addTab(dialog.tree, "DialogModel");
 
@@ -0,0 +1,14 @@
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+HEADERS += \
+  adblockblockednetworkreply.h \
+  adblockmanager.h \
+  adblockmatcher.h \
+  adblockrule.h
+
+SOURCES += \
+  adblockblockednetworkreply.cpp \
+  adblockmanager.cpp \
+  adblockmatcher.cpp \
+  adblockrule.cpp
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "adblockblockednetworkreply.h"
+
+#include "adblockrule.h"
+
+#include <qtimer.h>
+
+AdBlockBlockedNetworkReply::AdBlockBlockedNetworkReply(QNetworkAccessManager::Operation op,
+                                                       const QNetworkRequest &request,
+                                                       const AdBlockRule *rule, QObject *parent)
+    : QNetworkReply(parent)
+    , m_filter(rule ? rule->filter() : QString())
+{
+    setOperation(op);
+    setRequest(request);
+    setUrl(request.url());
+    setError(QNetworkReply::ContentAccessDenied, tr("Blocked by the content filter rule: %1").arg(m_filter));
+    open(QIODevice::ReadOnly);
+
+    QTimer::singleShot(0, this, SLOT(delayedFinished()));
+}
+
+QString AdBlockBlockedNetworkReply::filter() const
+{
+    return m_filter;
+}
+
+qint64 AdBlockBlockedNetworkReply::readData(char *data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+    return -1;
+}
+
+void AdBlockBlockedNetworkReply::delayedFinished()
+{
+    emit error(QNetworkReply::ContentAccessDenied);
+    emit finished();
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef ADBLOCKBLOCKEDNETWORKREPLY_H
+#define ADBLOCKBLOCKEDNETWORKREPLY_H
+
+#include <qnetworkreply.h>
+
+class AdBlockRule;
+
+/*
+    What a blocked request gets instead of going to the network, a reply
+    without content that fails as soon as the event loop runs.
+  */
+class AdBlockBlockedNetworkReply : public QNetworkReply
+{
+    Q_OBJECT
+
+public:
+    AdBlockBlockedNetworkReply(QNetworkAccessManager::Operation op, const QNetworkRequest &request,
+                               const AdBlockRule *rule, QObject *parent = 0);
+
+    QString filter() const;
+
+    virtual void abort() { };
+
+protected:
+    virtual qint64 readData(char *data, qint64 maxSize);
+
+private slots:
+    void delayedFinished();
+
+private:
+    QString m_filter;
+};
+
+#endif // ADBLOCKBLOCKEDNETWORKREPLY_H
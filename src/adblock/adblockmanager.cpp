@@ -0,0 +1,172 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "adblockmanager.h"
+
+#include <qcoreapplication.h>
+#include <qdesktopservices.h>
+#include <qdir.h>
+#include <qfile.h>
+#include <qsettings.h>
+#include <qtextstream.h>
+#include <qurl.h>
+
+#include <qdebug.h>
+
+AdBlockManager::AdBlockManager(QObject *parent)
+    : QObject(parent)
+    , m_enabled(true)
+    , m_loaded(false)
+    , m_checkedRequests(0)
+    , m_blockedRequests(0)
+{
+}
+
+AdBlockManager::~AdBlockManager()
+{
+    qDeleteAll(m_rules);
+}
+
+bool AdBlockManager::isEnabled() const
+{
+    return m_enabled;
+}
+
+void AdBlockManager::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+QString AdBlockManager::rulesDirectory()
+{
+    QString directory = QDesktopServices::storageLocation(QDesktopServices::DataLocation);
+    if (directory.isEmpty())
+        directory = QDir::homePath() + QLatin1String("/.") + QCoreApplication::applicationName();
+    return directory + QLatin1String("/adblock");
+}
+
+void AdBlockManager::loadSettings()
+{
+    QSettings settings;
+    settings.beginGroup(QLatin1String("AdBlock"));
+    m_enabled = settings.value(QLatin1String("enabled"), true).toBool();
+    settings.endGroup();
+
+    if (!m_enabled || m_loaded)
+        return;
+    m_loaded = true;
+
+    QDir directory(rulesDirectory());
+    QStringList files = directory.entryList(QStringList() << QLatin1String("*.txt"), QDir::Files, QDir::Name);
+    foreach (const QString &file, files)
+        loadRules(directory.filePath(file));
+}
+
+bool AdBlockManager::loadRules(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly)) {
+        qWarning() << "AdBlockManager: Unable to open" << fileName;
+        return false;
+    }
+
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+    QStringList filters;
+    while (!stream.atEnd())
+        filters.append(stream.readLine());
+    addRules(filters);
+    return true;
+}
+
+void AdBlockManager::addRules(const QStringList &filters)
+{
+    foreach (const QString &filter, filters) {
+        AdBlockRule *rule = new AdBlockRule(filter);
+        if (!rule->isValid()) {
+            delete rule;
+            continue;
+        }
+        m_rules.append(rule);
+        if (rule->isDocumentException())
+            m_documentExceptions.addRule(rule);
+        else if (rule->isException())
+            m_exceptions.addRule(rule);
+        else
+            m_blocking.addRule(rule);
+    }
+    emit rulesChanged();
+}
+
+void AdBlockManager::clear()
+{
+    m_blocking.clear();
+    m_exceptions.clear();
+    m_documentExceptions.clear();
+    qDeleteAll(m_rules);
+    m_rules.clear();
+    emit rulesChanged();
+}
+
+int AdBlockManager::ruleCount() const
+{
+    return m_rules.count();
+}
+
+const AdBlockRule *AdBlockManager::block(const QUrl &url, const QUrl &firstPartyUrl,
+                                         AdBlockRequest::Type type)
+{
+    if (!m_enabled || m_blocking.isEmpty())
+        return 0;
+
+    ++m_checkedRequests;
+    AdBlockRequest request(url, firstPartyUrl, type);
+    const AdBlockRule *rule = m_blocking.match(request);
+    if (!rule)
+        return 0;
+
+    if (m_exceptions.match(request))
+        return 0;
+
+    // The page is its own first party, so that domain= works for documents
+    if (!m_documentExceptions.isEmpty() && firstPartyUrl.isValid()) {
+        AdBlockRequest page(firstPartyUrl, firstPartyUrl, AdBlockRequest::Document);
+        if (m_documentExceptions.match(page))
+            return 0;
+    }
+
+    ++m_blockedRequests;
+    return rule;
+}
+
+int AdBlockManager::checkedRequests() const
+{
+    return m_checkedRequests;
+}
+
+int AdBlockManager::blockedRequests() const
+{
+    return m_blockedRequests;
+}
+
+void AdBlockManager::resetStatistics()
+{
+    m_checkedRequests = 0;
+    m_blockedRequests = 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef ADBLOCKMANAGER_H
+#define ADBLOCKMANAGER_H
+
+#include <qobject.h>
+
+#include "adblockmatcher.h"
+#include "adblockrule.h"
+
+#include <qlist.h>
+#include <qstringlist.h>
+
+class QUrl;
+
+/*
+    Decides which requests are blocked.
+
+    Filter lists in the Adblock Plus format are read from the adblock
+    directory in the data location, every *.txt file there is loaded.
+    Blocking, exception and whole page exception rules are kept in
+    separate matchers so that the common case, a request no rule blocks,
+    only costs a lookup of the words of its url.
+  */
+class AdBlockManager : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void rulesChanged();
+
+public:
+    AdBlockManager(QObject *parent = 0);
+    ~AdBlockManager();
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    static QString rulesDirectory();
+    bool loadRules(const QString &fileName);
+    void addRules(const QStringList &filters);
+    void clear();
+    int ruleCount() const;
+
+    // Returns the rule that blocks the request or 0
+    const AdBlockRule *block(const QUrl &url, const QUrl &firstPartyUrl,
+                             AdBlockRequest::Type type = AdBlockRequest::Other);
+
+    int checkedRequests() const;
+    int blockedRequests() const;
+    void resetStatistics();
+
+public slots:
+    void loadSettings();
+
+private:
+    bool m_enabled;
+    bool m_loaded;
+    QList<AdBlockRule*> m_rules;
+    AdBlockMatcher m_blocking;
+    AdBlockMatcher m_exceptions;
+    AdBlockMatcher m_documentExceptions;
+
+    int m_checkedRequests;
+    int m_blockedRequests;
+};
+
+#endif // ADBLOCKMANAGER_H
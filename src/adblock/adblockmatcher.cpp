@@ -0,0 +1,107 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "adblockmatcher.h"
+
+#include "adblockrule.h"
+
+AdBlockMatcher::AdBlockMatcher()
+    : m_count(0)
+{
+}
+
+void AdBlockMatcher::clear()
+{
+    m_tokenRules.clear();
+    m_otherRules.clear();
+    m_count = 0;
+}
+
+bool AdBlockMatcher::isEmpty() const
+{
+    return m_count == 0;
+}
+
+int AdBlockMatcher::count() const
+{
+    return m_count;
+}
+
+void AdBlockMatcher::addRule(const AdBlockRule *rule)
+{
+    ++m_count;
+    QByteArray best;
+    int bestCount = 0;
+    foreach (const QByteArray &token, rule->tokens()) {
+        QHash<QByteArray, QVector<const AdBlockRule*> >::const_iterator it = m_tokenRules.constFind(token);
+        int count = (it == m_tokenRules.constEnd()) ? 0 : it.value().count();
+        if (best.isEmpty() || count < bestCount
+            || (count == bestCount && token.length() > best.length())) {
+            best = token;
+            bestCount = count;
+        }
+    }
+
+    if (best.isEmpty())
+        m_otherRules.append(rule);
+    else
+        m_tokenRules[best].append(rule);
+}
+
+const AdBlockRule *AdBlockMatcher::match(const AdBlockRequest &request) const
+{
+    const QByteArray &url = request.lowerUrl;
+    const char *data = url.constData();
+    int length = url.size();
+
+    int start = 0;
+    while (start < length) {
+        char c = data[start];
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '%')) {
+            ++start;
+            continue;
+        }
+        int end = start + 1;
+        while (end < length) {
+            c = data[end];
+            if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '%'))
+                break;
+            ++end;
+        }
+        if (end - start >= 2) {
+            // Looking the word up doesn't copy it
+            QByteArray token = QByteArray::fromRawData(data + start, end - start);
+            QHash<QByteArray, QVector<const AdBlockRule*> >::const_iterator it = m_tokenRules.constFind(token);
+            if (it != m_tokenRules.constEnd()) {
+                const QVector<const AdBlockRule*> &rules = it.value();
+                for (int i = 0; i < rules.count(); ++i) {
+                    if (rules.at(i)->matches(request))
+                        return rules.at(i);
+                }
+            }
+        }
+        start = end;
+    }
+
+    for (int i = 0; i < m_otherRules.count(); ++i) {
+        if (m_otherRules.at(i)->matches(request))
+            return m_otherRules.at(i);
+    }
+    return 0;
+}
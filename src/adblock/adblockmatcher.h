@@ -0,0 +1,59 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef ADBLOCKMATCHER_H
+#define ADBLOCKMATCHER_H
+
+#include <qbytearray.h>
+#include <qhash.h>
+#include <qvector.h>
+
+class AdBlockRequest;
+class AdBlockRule;
+
+/*
+    Finds the first of a set of rules that matches a request without
+    trying every rule.
+
+    Each rule is filed under one of its tokens, a word any url it matches
+    has to contain as a whole.  Of the tokens of a rule the one with the
+    fewest rules filed under it so far is used, which keeps the lists short.
+    A url is split into words the same way and only the rules filed under
+    those words are tried, together with the few rules that have no token.
+  */
+class AdBlockMatcher
+{
+public:
+    AdBlockMatcher();
+
+    void clear();
+    bool isEmpty() const;
+    int count() const;
+
+    // The rule is not owned by the matcher
+    void addRule(const AdBlockRule *rule);
+    const AdBlockRule *match(const AdBlockRequest &request) const;
+
+private:
+    QHash<QByteArray, QVector<const AdBlockRule*> > m_tokenRules;
+    QVector<const AdBlockRule*> m_otherRules;
+    int m_count;
+};
+
+#endif // ADBLOCKMATCHER_H
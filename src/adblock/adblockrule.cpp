@@ -0,0 +1,391 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "adblockrule.h"
+
+#include "publicsuffix.h"
+
+#include <qstringlist.h>
+#include <qurl.h>
+
+static const int ALL_TYPES = AdBlockRequest::Other | AdBlockRequest::Script | AdBlockRequest::Image
+                             | AdBlockRequest::StyleSheet | AdBlockRequest::Object
+                             | AdBlockRequest::SubDocument | AdBlockRequest::XmlHttpRequest;
+
+static inline bool isTokenCharacter(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '%';
+}
+
+// What ^ matches, anything but a letter, a digit or one of _-.%
+static inline bool isSeparator(char c)
+{
+    return !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+             || c == '_' || c == '-' || c == '.' || c == '%');
+}
+
+// Returns how much of the url \a part matches at \a at, or -1
+static int matchPart(const QByteArray &url, int at, const QByteArray &part)
+{
+    const char *u = url.constData() + at;
+    const char *p = part.constData();
+    int available = url.size() - at;
+    int length = part.size();
+    for (int i = 0; i < length; ++i) {
+        if (i >= available) {
+            // ^ also matches the end of the url
+            if (p[i] == '^' && i == length - 1)
+                return i;
+            return -1;
+        }
+        if (p[i] == '^') {
+            if (!isSeparator(u[i]))
+                return -1;
+        } else if (p[i] != u[i]) {
+            return -1;
+        }
+    }
+    return length;
+}
+
+static QString baseDomain(const QString &host)
+{
+    QString domain = PublicSuffix::registrableDomain(host);
+    return domain.isEmpty() ? host : domain;
+}
+
+AdBlockRequest::AdBlockRequest(const QUrl &requestUrl, const QUrl &firstPartyUrl, Type requestType)
+    : url(requestUrl.toEncoded())
+    , lowerUrl(url.toLower())
+    , hostStart(0)
+    , hostEnd(0)
+    , firstPartyHost(firstPartyUrl.host().toLower())
+    , thirdParty(false)
+    , type(requestType)
+{
+    int scheme = lowerUrl.indexOf("://");
+    if (scheme != -1) {
+        hostStart = scheme + 3;
+        hostEnd = hostStart;
+        while (hostEnd < lowerUrl.size()) {
+            char c = lowerUrl.at(hostEnd);
+            if (c == '/' || c == '?' || c == '#')
+                break;
+            if (c == '@')
+                hostStart = hostEnd + 1;
+            ++hostEnd;
+        }
+        int port = lowerUrl.indexOf(':', hostStart);
+        if (port != -1 && port < hostEnd)
+            hostEnd = port;
+    }
+
+    if (!firstPartyHost.isEmpty())
+        thirdParty = baseDomain(requestUrl.host().toLower()) != baseDomain(firstPartyHost);
+}
+
+AdBlockRequest::Type AdBlockRequest::typeForUrl(const QUrl &url)
+{
+    QString path = url.path();
+    int dot = path.lastIndexOf(QLatin1Char('.'));
+    if (dot == -1 || dot < path.lastIndexOf(QLatin1Char('/')))
+        return Other;
+    QString suffix = path.mid(dot + 1).toLower();
+    if (suffix == QLatin1String("js"))
+        return Script;
+    if (suffix == QLatin1String("css"))
+        return StyleSheet;
+    if (suffix == QLatin1String("png") || suffix == QLatin1String("gif")
+        || suffix == QLatin1String("jpg") || suffix == QLatin1String("jpeg")
+        || suffix == QLatin1String("ico") || suffix == QLatin1String("bmp")
+        || suffix == QLatin1String("svg") || suffix == QLatin1String("webp"))
+        return Image;
+    if (suffix == QLatin1String("swf"))
+        return Object;
+    return Other;
+}
+
+AdBlockRule::AdBlockRule(const QString &filter)
+    : m_filter(filter.trimmed())
+    , m_valid(false)
+    , m_exception(false)
+    , m_document(false)
+    , m_matchCase(false)
+    , m_thirdParty(AnyParty)
+    , m_types(ALL_TYPES)
+    , m_anchorStart(false)
+    , m_anchorDomain(false)
+    , m_anchorEnd(false)
+{
+    QString pattern = m_filter;
+    if (pattern.isEmpty()
+        || pattern.startsWith(QLatin1Char('!'))
+        || pattern.startsWith(QLatin1Char('['))
+        || pattern.contains(QLatin1String("##"))
+        || pattern.contains(QLatin1String("#@#"))
+        || pattern.contains(QLatin1String("#?#")))
+        return;
+
+    if (pattern.startsWith(QLatin1String("@@"))) {
+        m_exception = true;
+        pattern = pattern.mid(2);
+    }
+
+    // A $ can also be part of a regular expression
+    int options = pattern.lastIndexOf(QLatin1Char('$'));
+    if (options != -1
+        && !(pattern.startsWith(QLatin1Char('/')) && pattern.endsWith(QLatin1Char('/')))) {
+        if (!parseOptions(pattern.mid(options + 1)))
+            return;
+        pattern = pattern.left(options);
+    }
+
+    if (pattern.length() > 2
+        && pattern.startsWith(QLatin1Char('/'))
+        && pattern.endsWith(QLatin1Char('/'))) {
+        m_regExp = QRegExp(pattern.mid(1, pattern.length() - 2),
+                           m_matchCase ? Qt::CaseSensitive : Qt::CaseInsensitive,
+                           QRegExp::RegExp2);
+        m_valid = m_regExp.isValid();
+        return;
+    }
+
+    if (pattern.startsWith(QLatin1String("||"))) {
+        m_anchorDomain = true;
+        pattern = pattern.mid(2);
+    } else if (pattern.startsWith(QLatin1Char('|'))) {
+        m_anchorStart = true;
+        pattern = pattern.mid(1);
+    }
+    if (pattern.endsWith(QLatin1Char('|'))) {
+        m_anchorEnd = true;
+        pattern.chop(1);
+    }
+    if (pattern.startsWith(QLatin1Char('*')))
+        m_anchorStart = m_anchorDomain = false;
+    if (pattern.endsWith(QLatin1Char('*')))
+        m_anchorEnd = false;
+
+    QByteArray bytes = m_matchCase ? pattern.toUtf8() : pattern.toLower().toUtf8();
+    foreach (const QByteArray &part, bytes.split('*')) {
+        if (!part.isEmpty())
+            m_parts.append(part);
+    }
+    m_valid = true;
+}
+
+bool AdBlockRule::parseOptions(const QString &options)
+{
+    int includeTypes = 0;
+    int excludeTypes = 0;
+    foreach (const QString &option, options.toLower().split(QLatin1Char(','), QString::SkipEmptyParts)) {
+        bool negated = option.startsWith(QLatin1Char('~'));
+        QString name = negated ? option.mid(1) : option;
+
+        int type = 0;
+        if (name == QLatin1String("script"))
+            type = AdBlockRequest::Script;
+        else if (name == QLatin1String("image"))
+            type = AdBlockRequest::Image;
+        else if (name == QLatin1String("stylesheet"))
+            type = AdBlockRequest::StyleSheet;
+        else if (name == QLatin1String("object") || name == QLatin1String("object-subrequest"))
+            type = AdBlockRequest::Object;
+        else if (name == QLatin1String("subdocument"))
+            type = AdBlockRequest::SubDocument;
+        else if (name == QLatin1String("xmlhttprequest"))
+            type = AdBlockRequest::XmlHttpRequest;
+        else if (name == QLatin1String("other"))
+            type = AdBlockRequest::Other;
+        else if (name == QLatin1String("document") && m_exception && !negated)
+            type = AdBlockRequest::Document;
+
+        if (type) {
+            if (negated)
+                excludeTypes |= type;
+            else
+                includeTypes |= type;
+        } else if (name == QLatin1String("third-party")) {
+            m_thirdParty = negated ? FirstPartyOnly : ThirdPartyOnly;
+        } else if (name == QLatin1String("match-case")) {
+            m_matchCase = !negated;
+        } else if (name == QLatin1String("collapse")) {
+            // Only about how a blocked element is shown
+        } else if (option.startsWith(QLatin1String("domain="))) {
+            foreach (const QString &domain, option.mid(7).split(QLatin1Char('|'), QString::SkipEmptyParts)) {
+                if (domain.startsWith(QLatin1Char('~')))
+                    m_excludeDomains.insert(domain.mid(1));
+                else
+                    m_includeDomains.insert(domain);
+            }
+        } else {
+            return false;
+        }
+    }
+
+    if (includeTypes)
+        m_types = includeTypes;
+    m_types &= ~excludeTypes;
+    m_document = (m_types & AdBlockRequest::Document);
+    return m_types != 0;
+}
+
+QString AdBlockRule::filter() const
+{
+    return m_filter;
+}
+
+bool AdBlockRule::isValid() const
+{
+    return m_valid;
+}
+
+bool AdBlockRule::isException() const
+{
+    return m_exception;
+}
+
+bool AdBlockRule::isDocumentException() const
+{
+    return m_exception && m_document;
+}
+
+bool AdBlockRule::isRegExp() const
+{
+    return !m_regExp.isEmpty();
+}
+
+QList<QByteArray> AdBlockRule::tokens() const
+{
+    QList<QByteArray> tokens;
+    for (int i = 0; i < m_parts.count(); ++i) {
+        QByteArray part = m_matchCase ? m_parts.at(i).toLower() : m_parts.at(i);
+        int start = 0;
+        while (start < part.size()) {
+            if (!isTokenCharacter(part.at(start))) {
+                ++start;
+                continue;
+            }
+            int end = start;
+            while (end < part.size() && isTokenCharacter(part.at(end)))
+                ++end;
+            // Next to a wildcard the url could have more of the word
+            bool startBounded = start > 0 || (i == 0 && (m_anchorStart || m_anchorDomain));
+            bool endBounded = end < part.size() || (i == m_parts.count() - 1 && m_anchorEnd);
+            if (startBounded && endBounded && end - start >= 2)
+                tokens.append(part.mid(start, end - start));
+            start = end;
+        }
+    }
+    return tokens;
+}
+
+bool AdBlockRule::matches(const AdBlockRequest &request) const
+{
+    if (!m_valid || !(m_types & request.type))
+        return false;
+    if ((m_thirdParty == ThirdPartyOnly && !request.thirdParty)
+        || (m_thirdParty == FirstPartyOnly && request.thirdParty))
+        return false;
+    if ((!m_includeDomains.isEmpty() || !m_excludeDomains.isEmpty())
+        && !matchesDomain(request.firstPartyHost))
+        return false;
+    return matchesUrl(request);
+}
+
+/*
+    The most specific domain of \a host that the rule mentions decides,
+    so domain=example.com|~ads.example.com works as expected.
+  */
+bool AdBlockRule::matchesDomain(const QString &host) const
+{
+    QString domain = host;
+    while (!domain.isEmpty()) {
+        if (m_excludeDomains.contains(domain))
+            return false;
+        if (m_includeDomains.contains(domain))
+            return true;
+        int dot = domain.indexOf(QLatin1Char('.'));
+        if (dot == -1)
+            break;
+        domain = domain.mid(dot + 1);
+    }
+    return m_includeDomains.isEmpty();
+}
+
+bool AdBlockRule::matchesUrl(const AdBlockRequest &request) const
+{
+    if (!m_regExp.isEmpty())
+        return m_regExp.indexIn(QString::fromLatin1(request.url)) != -1;
+
+    const QByteArray &url = m_matchCase ? request.url : request.lowerUrl;
+    if (m_anchorDomain) {
+        // At the start of the host or of one of its sub domains
+        for (int i = request.hostStart; i < request.hostEnd; ++i) {
+            if ((i == request.hostStart || url.at(i - 1) == '.')
+                && matchesParts(url, i, true))
+                return true;
+        }
+        return false;
+    }
+    return matchesParts(url, 0, m_anchorStart);
+}
+
+bool AdBlockRule::matchesParts(const QByteArray &url, int from, bool anchored) const
+{
+    int position = from;
+    int count = m_parts.count();
+    for (int i = 0; i < count; ++i) {
+        const QByteArray &part = m_parts.at(i);
+
+        if (i == count - 1 && m_anchorEnd) {
+            int start = url.size() - part.size();
+            if (start < position || (i == 0 && anchored && start != position))
+                return false;
+            return matchPart(url, start, part) != -1;
+        }
+
+        if (i == 0 && anchored) {
+            int length = matchPart(url, position, part);
+            if (length == -1)
+                return false;
+            position += length;
+            continue;
+        }
+
+        // The leftmost match leaves the most room for the rest
+        int length = -1;
+        char first = part.at(0);
+        while (position <= url.size()) {
+            if (first != '^') {
+                position = url.indexOf(first, position);
+                if (position == -1)
+                    return false;
+            }
+            length = matchPart(url, position, part);
+            if (length != -1)
+                break;
+            ++position;
+        }
+        if (length == -1)
+            return false;
+        position += length;
+    }
+    return !m_anchorEnd || count > 0 || position == url.size();
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef ADBLOCKRULE_H
+#define ADBLOCKRULE_H
+
+#include <qbytearray.h>
+#include <qlist.h>
+#include <qregexp.h>
+#include <qset.h>
+#include <qstring.h>
+
+class QUrl;
+
+/*
+    What a request is matched with, prepared once so that every rule can
+    look at the same lower case url and first party information.
+  */
+class AdBlockRequest
+{
+public:
+    enum Type {
+        Other = 0x01,
+        Script = 0x02,
+        Image = 0x04,
+        StyleSheet = 0x08,
+        Object = 0x10,
+        SubDocument = 0x20,
+        XmlHttpRequest = 0x40,
+        Document = 0x80
+    };
+
+    AdBlockRequest(const QUrl &url, const QUrl &firstPartyUrl, Type type = Other);
+
+    static Type typeForUrl(const QUrl &url);
+
+    QByteArray url;
+    QByteArray lowerUrl;
+    int hostStart;
+    int hostEnd;
+    QString firstPartyHost;
+    bool thirdParty;
+    Type type;
+};
+
+/*
+    A single filter in the Adblock Plus syntax.
+
+    Supported are exception rules (@@), the anchors |, || and the
+    wildcards * and ^, regular expressions between slashes and the options
+    third-party, match-case, domain= and the request types that can be
+    told from a url.  Element hiding rules and rules with other options
+    are not valid, they are ignored rather than applied too widely.
+  */
+class AdBlockRule
+{
+public:
+    AdBlockRule(const QString &filter = QString());
+
+    QString filter() const;
+    bool isValid() const;
+    bool isException() const;
+    bool isDocumentException() const;
+    bool isRegExp() const;
+
+    // The words of the pattern that any url it matches has to contain as
+    // a whole, empty when the rule has to be tried on every request
+    QList<QByteArray> tokens() const;
+
+    bool matches(const AdBlockRequest &request) const;
+    bool matchesUrl(const AdBlockRequest &request) const;
+
+private:
+    bool parseOptions(const QString &options);
+    bool matchesDomain(const QString &host) const;
+    bool matchesParts(const QByteArray &url, int from, bool anchored) const;
+
+    QString m_filter;
+    bool m_valid;
+    bool m_exception;
+    bool m_document;
+    bool m_matchCase;
+
+    enum ThirdParty {
+        AnyParty,
+        ThirdPartyOnly,
+        FirstPartyOnly
+    };
+    ThirdParty m_thirdParty;
+    int m_types;
+
+    // The pattern split at the wildcards
+    QList<QByteArray> m_parts;
+    bool m_anchorStart;
+    bool m_anchorDomain;
+    bool m_anchorEnd;
+    QRegExp m_regExp;
+
+    QSet<QString> m_includeDomains;
+    QSet<QString> m_excludeDomains;
+};
+
+#endif // ADBLOCKRULE_H
@@ -518,7 +518,7 @@ NetworkAccessManager *BrowserApplication::networkAccessManager()
 HistoryManager *BrowserApplication::historyManager()
 {
     if (!s_historyManager)
-        s_historyManager = new HistoryManager();
+        s_historyManager = new HistoryManager(0, HistoryManager::LoadInBackground);
     return s_historyManager;
 }
 
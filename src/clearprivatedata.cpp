@@ -28,6 +28,8 @@
 #include "toolbarsearch.h"
 
 #include <qcheckbox.h>
+#include <qcombobox.h>
+#include <qdatetime.h>
 #include <qdialogbuttonbox.h>
 #include <qlabel.h>
 #include <qlayout.h>
@@ -52,7 +54,21 @@ ClearPrivateData::ClearPrivateData(QWidget *parent)
 
     m_browsingHistory = new QCheckBox(tr("&Browsing History"));
     m_browsingHistory->setChecked(settings.value(QLatin1String("browsingHistory"), true).toBool());
-    layout->addWidget(m_browsingHistory);
+    // How far back to clear, in seconds with 0 being everything
+    m_browsingHistoryRange = new QComboBox;
+    m_browsingHistoryRange->addItem(tr("Everything"), 0);
+    m_browsingHistoryRange->addItem(tr("Last Hour"), 60 * 60);
+    m_browsingHistoryRange->addItem(tr("Last Day"), 24 * 60 * 60);
+    m_browsingHistoryRange->addItem(tr("Last Week"), 7 * 24 * 60 * 60);
+    int range = m_browsingHistoryRange->findData(settings.value(QLatin1String("browsingHistoryRange"), 0).toInt());
+    m_browsingHistoryRange->setCurrentIndex(qMax(0, range));
+    connect(m_browsingHistory, SIGNAL(toggled(bool)),
+            m_browsingHistoryRange, SLOT(setEnabled(bool)));
+    m_browsingHistoryRange->setEnabled(m_browsingHistory->isChecked());
+    QHBoxLayout *browsingHistoryLayout = new QHBoxLayout;
+    browsingHistoryLayout->addWidget(m_browsingHistory);
+    browsingHistoryLayout->addWidget(m_browsingHistoryRange);
+    layout->addLayout(browsingHistoryLayout);
 
     m_downloadHistory = new QCheckBox(tr("&Download History"));
     m_downloadHistory->setChecked(settings.value(QLatin1String("downloadHistory"), true).toBool());
@@ -105,6 +121,8 @@ void ClearPrivateData::accept()
     settings.beginGroup(QLatin1String("clearprivatedata"));
 
     settings.setValue(QLatin1String("browsingHistory"), m_browsingHistory->isChecked());
+    int range = m_browsingHistoryRange->itemData(m_browsingHistoryRange->currentIndex()).toInt();
+    settings.setValue(QLatin1String("browsingHistoryRange"), range);
     settings.setValue(QLatin1String("downloadHistory"), m_downloadHistory->isChecked());
     settings.setValue(QLatin1String("searchHistory"), m_searchHistory->isChecked());
     settings.setValue(QLatin1String("cookies"), m_cookies->isChecked());
@@ -116,7 +134,12 @@ void ClearPrivateData::accept()
     settings.endGroup();
 
     if (m_browsingHistory->isChecked()) {
-        BrowserApplication::historyManager()->clear();
+        HistoryManager *historyManager = BrowserApplication::historyManager();
+        if (range > 0) {
+            historyManager->removeHistoryEntries(QDateTime::currentDateTime().addSecs(-range));
+        } else {
+            historyManager->clear();
+        }
     }
 
     if (m_downloadHistory->isChecked()) {
@@ -23,6 +23,7 @@
 #include <qdialog.h>
 
 class QCheckBox;
+class QComboBox;
 
 class ClearPrivateData : public QDialog
 {
@@ -36,6 +37,7 @@ public slots:
 
 private:
     QCheckBox *m_browsingHistory;
+    QComboBox *m_browsingHistoryRange;
     QCheckBox *m_downloadHistory;
     QCheckBox *m_searchHistory;
     QCheckBox *m_cookies;
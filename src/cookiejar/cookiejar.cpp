@@ -63,6 +63,7 @@
 #include "cookiejar.h"
 
 #include "autosaver.h"
+#include "cookiejournal.h"
 
 #include <qapplication.h>
 #include <qdesktopservices.h>
@@ -119,6 +120,9 @@ CookieJar::CookieJar(QObject *parent)
     : NetworkCookieJar(parent)
     , m_loaded(false)
     , m_saveTimer(new AutoSaver(this))
+    , m_journal(new CookieJournal)
+    , m_compactJournal(false)
+    , m_exceptionsChanged(false)
     , m_acceptCookies(AcceptOnlyFromSitesNavigatedTo)
 {
 }
@@ -128,11 +132,26 @@ CookieJar::~CookieJar()
     if (m_loaded && m_keepCookies == KeepUntilExit)
         clear();
     m_saveTimer->saveIfNeccessary();
+    delete m_journal;
+}
+
+QString CookieJar::dataDirectory()
+{
+    QString directory = QDesktopServices::storageLocation(QDesktopServices::DataLocation);
+    if (directory.isEmpty())
+        directory = QDir::homePath() + QLatin1String("/.") + QCoreApplication::applicationName();
+    return directory;
+}
+
+void CookieJar::replaceAllCookies(const QList<QNetworkCookie> &cookies)
+{
+    setAllCookies(cookies);
+    m_compactJournal = true;
 }
 
 void CookieJar::clear()
 {
-    setAllCookies(QList<QNetworkCookie>());
+    replaceAllCookies(QList<QNetworkCookie>());
     m_saveTimer->changeOccurred();
     emit cookiesChanged();
 }
@@ -142,9 +161,18 @@ void CookieJar::load()
     if (m_loaded)
         return;
     // load cookies and exceptions
-    qRegisterMetaTypeStreamOperators<QList<QNetworkCookie> >("QList<QNetworkCookie>");
-    QSettings cookieSettings(QDesktopServices::storageLocation(QDesktopServices::DataLocation) + QLatin1String("/cookies.ini"), QSettings::IniFormat);
-    setAllCookies(qvariant_cast<QList<QNetworkCookie> >(cookieSettings.value(QLatin1String("cookies"))));
+    QString directory = dataDirectory();
+    QSettings cookieSettings(directory + QLatin1String("/cookies.ini"), QSettings::IniFormat);
+    m_journal->setDirectory(directory);
+    QList<QNetworkCookie> legacyCookies;
+    if (!m_journal->hasSnapshot() && cookieSettings.contains(QLatin1String("cookies"))) {
+        // Older versions kept all of the cookies in cookies.ini
+        qRegisterMetaTypeStreamOperators<QList<QNetworkCookie> >("QList<QNetworkCookie>");
+        legacyCookies = qvariant_cast<QList<QNetworkCookie> >(cookieSettings.value(QLatin1String("cookies")));
+        m_compactJournal = true;
+        m_exceptionsChanged = true;
+    }
+    setAllCookies(m_journal->load(legacyCookies));
     cookieSettings.beginGroup(QLatin1String("Exceptions"));
     m_exceptions_block = cookieSettings.value(QLatin1String("block")).toStringList();
     m_exceptions_allow = cookieSettings.value(QLatin1String("allow")).toStringList();
@@ -152,6 +180,7 @@ void CookieJar::load()
     qSort(m_exceptions_block.begin(), m_exceptions_block.end());
     qSort(m_exceptions_allow.begin(), m_exceptions_allow.end());
     qSort(m_exceptions_allowForSession.begin(), m_exceptions_allowForSession.end());
+    compileExceptions();
 
     loadSettings();
 }
@@ -174,7 +203,7 @@ void CookieJar::loadSettings()
                     static_cast<KeepPolicy>(keepPolicyEnum.keyToValue(value));
 
     if (m_keepCookies == KeepUntilExit)
-        setAllCookies(QList<QNetworkCookie>());
+        replaceAllCookies(QList<QNetworkCookie>());
 
     m_loaded = true;
     m_filterTrackingCookies = settings.value(QLatin1String("filterTrackingCookies"), true).toBool();
@@ -185,25 +214,37 @@ void CookieJar::save()
 {
     if (!m_loaded)
         return;
-    purgeOldCookies();
-    QString directory = QDesktopServices::storageLocation(QDesktopServices::DataLocation);
-    if (directory.isEmpty())
-        directory = QDir::homePath() + QLatin1String("/.") + QCoreApplication::applicationName();
+    if (NetworkCookieJar::removeExpiredCookies() > 0)
+        emit cookiesChanged();
+    QString directory = dataDirectory();
     if (!QFile::exists(directory)) {
         QDir dir;
         dir.mkpath(directory);
     }
-    QSettings cookieSettings(directory + QLatin1String("/cookies.ini"), QSettings::IniFormat);
-    QList<QNetworkCookie> cookies = allCookies();
-    for (int i = cookies.count() - 1; i >= 0; --i) {
-        if (cookies.at(i).isSessionCookie())
-            cookies.removeAt(i);
+    if (m_journal->directory() != directory)
+        m_journal->setDirectory(directory);
+
+    if (m_compactJournal || m_journal->needsCompaction()) {
+        QList<QNetworkCookie> cookies = allCookies();
+        for (int i = cookies.count() - 1; i >= 0; --i) {
+            if (cookies.at(i).isSessionCookie())
+                cookies.removeAt(i);
+        }
+        m_journal->compact(cookies);
+        m_compactJournal = false;
+    } else {
+        m_journal->flush();
+    }
+
+    if (m_exceptionsChanged) {
+        QSettings cookieSettings(directory + QLatin1String("/cookies.ini"), QSettings::IniFormat);
+        cookieSettings.remove(QLatin1String("cookies"));
+        cookieSettings.beginGroup(QLatin1String("Exceptions"));
+        cookieSettings.setValue(QLatin1String("block"), m_exceptions_block);
+        cookieSettings.setValue(QLatin1String("allow"), m_exceptions_allow);
+        cookieSettings.setValue(QLatin1String("allowForSession"), m_exceptions_allowForSession);
+        m_exceptionsChanged = false;
     }
-    cookieSettings.setValue(QLatin1String("cookies"), qVariantFromValue<QList<QNetworkCookie> >(cookies));
-    cookieSettings.beginGroup(QLatin1String("Exceptions"));
-    cookieSettings.setValue(QLatin1String("block"), m_exceptions_block);
-    cookieSettings.setValue(QLatin1String("allow"), m_exceptions_allow);
-    cookieSettings.setValue(QLatin1String("allowForSession"), m_exceptions_allowForSession);
 
     // save cookie settings
     QSettings settings;
@@ -217,21 +258,29 @@ void CookieJar::save()
     settings.setValue(QLatin1String("filterTrackingCookies"), m_filterTrackingCookies);
 }
 
-void CookieJar::purgeOldCookies()
+int CookieJar::removeExpiredCookies()
 {
-    QList<QNetworkCookie> cookies = allCookies();
-    if (cookies.isEmpty())
-        return;
-    int oldCount = cookies.count();
-    QDateTime now = QDateTime::currentDateTime();
-    for (int i = cookies.count() - 1; i >= 0; --i) {
-        if (!cookies.at(i).isSessionCookie() && cookies.at(i).expirationDate() < now)
-            cookies.removeAt(i);
+    int removed = NetworkCookieJar::removeExpiredCookies();
+    if (removed > 0) {
+        m_saveTimer->changeOccurred();
+        emit cookiesChanged();
     }
-    if (oldCount == cookies.count())
+    return removed;
+}
+
+void CookieJar::cookieInserted(const QNetworkCookie &cookie)
+{
+    // Session cookies are never saved, but one may replace a saved cookie
+    m_journal->append(cookie.isSessionCookie() ? CookieJournal::DeleteRecord : CookieJournal::SetRecord, cookie);
+    m_saveTimer->changeOccurred();
+}
+
+void CookieJar::cookieDeleted(const QNetworkCookie &cookie)
+{
+    if (cookie.isSessionCookie())
         return;
-    setAllCookies(cookies);
-    emit cookiesChanged();
+    m_journal->append(CookieJournal::DeleteRecord, cookie);
+    m_saveTimer->changeOccurred();
 }
 
 QList<QNetworkCookie> CookieJar::cookiesForUrl(const QUrl &url) const
@@ -259,9 +308,10 @@ bool CookieJar::setCookiesFromUrl(const QList<QNetworkCookie> &cookieList, const
         return false;
 
     QString host = url.host();
-    bool eBlock = isOnDomainList(m_exceptions_block, host);
-    bool eAllow = !eBlock && isOnDomainList(m_exceptions_allow, host);
-    bool eAllowSession = !eBlock && !eAllow && isOnDomainList(m_exceptions_allowForSession, host);
+    int lists = domainLists(m_exceptions, host);
+    bool eBlock = lists & BlockList;
+    bool eAllow = !eBlock && (lists & AllowList);
+    bool eAllowSession = !eBlock && !eAllow && (lists & AllowForSessionList);
 
     bool addedCookies = false;
     // pass exceptions
@@ -290,22 +340,7 @@ bool CookieJar::setCookiesFromUrl(const QList<QNetworkCookie> &cookieList, const
                 } else {
                     // finally force it in if wanted
                     if (m_acceptCookies == AcceptAlways) {
-                        QList<QNetworkCookie> cookies = allCookies();
-                        QList<QNetworkCookie>::Iterator it = cookies.begin(),
-                                   end = cookies.end();
-                        for ( ; it != end; ++it) {
-                            // does this cookie already exist?
-                            if (cookie.name() == it->name() &&
-                                cookie.domain() == it->domain() &&
-                                cookie.path() == it->path()) {
-                                // found a match
-                                cookies.erase(it);
-                                break;
-                            }
-                        }
-
-                        cookies += cookie;
-                        setAllCookies(cookies);
+                        insertCookie(cookie);
                         addedCookies = true;
                     }
     #if 0
@@ -355,6 +390,41 @@ bool CookieJar::isOnDomainList(const QStringList &rules, const QString &domain)
     return false;
 }
 
+/*
+    Either form of rule matches the domain without the leading dot and
+    everything that ends with a dot followed by it, so the rules can be
+    looked up by each of the suffixes of a domain that follow a dot.
+  */
+void CookieJar::addToDomainLists(DomainLists &lists, const QStringList &rules, DomainList list)
+{
+    foreach (const QString &rule, rules) {
+        QString domain = rule.startsWith(QLatin1Char('.')) ? rule.mid(1) : rule;
+        lists[domain] |= list;
+    }
+}
+
+// Returns the DomainList flags of the lists \a domain is on
+int CookieJar::domainLists(const DomainLists &lists, const QString &domain)
+{
+    if (lists.isEmpty())
+        return 0;
+    int found = lists.value(domain);
+    int dot = domain.indexOf(QLatin1Char('.'));
+    while (dot != -1) {
+        found |= lists.value(domain.mid(dot + 1));
+        dot = domain.indexOf(QLatin1Char('.'), dot + 1);
+    }
+    return found;
+}
+
+void CookieJar::compileExceptions()
+{
+    m_exceptions.clear();
+    addToDomainLists(m_exceptions, m_exceptions_block, BlockList);
+    addToDomainLists(m_exceptions, m_exceptions_allow, AllowList);
+    addToDomainLists(m_exceptions, m_exceptions_allowForSession, AllowForSessionList);
+}
+
 CookieJar::AcceptPolicy CookieJar::acceptPolicy() const
 {
     if (!m_loaded)
@@ -416,6 +486,8 @@ void CookieJar::setBlockedCookies(const QStringList &list)
         load();
     m_exceptions_block = list;
     qSort(m_exceptions_block.begin(), m_exceptions_block.end());
+    compileExceptions();
+    m_exceptionsChanged = true;
     applyRules();
     m_saveTimer->changeOccurred();
 }
@@ -426,6 +498,8 @@ void CookieJar::setAllowedCookies(const QStringList &list)
         load();
     m_exceptions_allow = list;
     qSort(m_exceptions_allow.begin(), m_exceptions_allow.end());
+    compileExceptions();
+    m_exceptionsChanged = true;
     applyRules();
     m_saveTimer->changeOccurred();
 }
@@ -436,6 +510,8 @@ void CookieJar::setAllowForSessionCookies(const QStringList &list)
         load();
     m_exceptions_allowForSession = list;
     qSort(m_exceptions_allowForSession.begin(), m_exceptions_allowForSession.end());
+    compileExceptions();
+    m_exceptionsChanged = true;
     applyRules();
     m_saveTimer->changeOccurred();
 }
@@ -446,16 +522,17 @@ void CookieJar::applyRules()
     bool changed = false;
     for (int i = cookies.count() - 1; i >= 0; --i) {
         const QNetworkCookie &cookie = cookies.at(i);
-        if (isOnDomainList(m_exceptions_block, cookie.domain())) {
+        int lists = domainLists(m_exceptions, cookie.domain());
+        if (lists & BlockList) {
             cookies.removeAt(i);
             changed = true;
-        } else if (isOnDomainList(m_exceptions_allowForSession, cookie.domain())) {
+        } else if (lists & AllowForSessionList) {
             const_cast<QNetworkCookie&>(cookie).setExpirationDate(QDateTime());
             changed = true;
         }
     }
     if (changed) {
-        setAllCookies(cookies);
+        replaceAllCookies(cookies);
         m_saveTimer->changeOccurred();
         emit cookiesChanged();
     }
@@ -65,9 +65,11 @@
 
 #include "networkcookiejar.h"
 
+#include <qhash.h>
 #include <qstringlist.h>
 
 class AutoSaver;
+class CookieJournal;
 class CookieJar : public NetworkCookieJar
 {
     friend class CookieModel;
@@ -127,14 +129,37 @@ private slots:
     void save();
 
 protected:
+    enum DomainList {
+        BlockList = 1,
+        AllowList = 2,
+        AllowForSessionList = 4
+    };
+
+    // The rules of the exception lists by the domain they match with the
+    // DomainList flags of the lists they are on
+    typedef QHash<QString, int> DomainLists;
+
     static bool isOnDomainList(const QStringList &rules, const QString &domain);
+    static void addToDomainLists(DomainLists &lists, const QStringList &rules, DomainList list);
+    static int domainLists(const DomainLists &lists, const QString &domain);
+    int removeExpiredCookies();
+    void cookieInserted(const QNetworkCookie &cookie);
+    void cookieDeleted(const QNetworkCookie &cookie);
 
 private:
+    static QString dataDirectory();
+    void replaceAllCookies(const QList<QNetworkCookie> &cookies);
     void applyRules();
-    void purgeOldCookies();
+    void compileExceptions();
     void load();
     bool m_loaded;
     AutoSaver *m_saveTimer;
+
+    // Cookies are saved by appending to the journal, changes that replace
+    // the whole jar are saved by compacting it
+    CookieJournal *m_journal;
+    bool m_compactJournal;
+    bool m_exceptionsChanged;
     bool m_filterTrackingCookies;
 
     AcceptPolicy m_acceptCookies;
@@ -143,6 +168,7 @@ private:
     QStringList m_exceptions_block;
     QStringList m_exceptions_allow;
     QStringList m_exceptions_allowForSession;
+    DomainLists m_exceptions;
 };
 
 #endif // COOKIEJAR_H
@@ -6,6 +6,7 @@ HEADERS += \
   cookieexceptionsdialog.h \
   cookieexceptionsmodel.h \
   cookiejar.h \
+  cookiejournal.h \
   cookiemodel.h
 
 SOURCES += \
@@ -13,7 +14,8 @@ SOURCES += \
   cookieexceptionsmodel.cpp \
   cookiemodel.cpp \
   cookieexceptionsdialog.cpp \
-  cookiejar.cpp
+  cookiejar.cpp \
+  cookiejournal.cpp
 
 FORMS += \
     cookies.ui \
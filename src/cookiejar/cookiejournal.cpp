@@ -0,0 +1,377 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "cookiejournal.h"
+
+#include <qdatastream.h>
+#include <qfileinfo.h>
+#include <qfile.h>
+#include <qthread.h>
+
+#include <qdebug.h>
+
+static const quint32 SNAPSHOT_MAGIC = 0x41434b53; // ACKS
+static const quint32 JOURNAL_MAGIC = 0x41434b4a;  // ACKJ
+static const quint32 JOURNAL_VERSION = 1;
+// journal: magic, version, generation
+static const int JOURNAL_HEADER_SIZE = 12;
+
+// Don't bother compacting journals smaller than this
+static const qint64 MINIMUM_COMPACTION_SIZE = 64 * 1024;
+
+/*
+    Writes a new snapshot and then removes the journal it replaces.
+  */
+class CookieJournalWriter : public QThread
+{
+public:
+    CookieJournalWriter(const QString &fileName, const QString &oldJournalFileName,
+                        const QList<QNetworkCookie> &cookies, quint32 generation, QObject *parent = 0)
+        : QThread(parent)
+        , m_fileName(fileName)
+        , m_oldJournalFileName(oldJournalFileName)
+        , m_cookies(cookies)
+        , m_generation(generation)
+        , m_size(0)
+    {}
+
+    qint64 size() const { return m_size; }
+
+protected:
+    void run();
+
+private:
+    QString m_fileName;
+    QString m_oldJournalFileName;
+    QList<QNetworkCookie> m_cookies;
+    quint32 m_generation;
+    qint64 m_size;
+};
+
+void CookieJournalWriter::run()
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << SNAPSHOT_MAGIC << JOURNAL_VERSION << m_generation << quint32(m_cookies.count());
+    foreach (const QNetworkCookie &cookie, m_cookies)
+        stream << cookie.toRawForm();
+
+    QFile file(m_fileName + QLatin1String(".new"));
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)
+        || file.write(data) != data.size()
+        || !file.flush()) {
+        qWarning() << "CookieJournal: unable to write" << file.fileName();
+        file.close();
+        file.remove();
+        return;
+    }
+    file.close();
+
+    // The journal is only removed once the snapshot that replaces it is in place
+    QFile::remove(m_fileName);
+    if (!file.rename(m_fileName)) {
+        qWarning() << "CookieJournal: unable to rename" << file.fileName();
+        return;
+    }
+    QFile::remove(m_oldJournalFileName);
+    m_size = data.size();
+}
+
+CookieJournal::CookieJournal()
+    : m_journalSize(0)
+    , m_snapshotSize(0)
+    , m_generation(0)
+    , m_writer(0)
+{
+}
+
+CookieJournal::~CookieJournal()
+{
+    waitForCompaction();
+}
+
+QString CookieJournal::directory() const
+{
+    return m_directory;
+}
+
+void CookieJournal::setDirectory(const QString &directory)
+{
+    waitForCompaction();
+    m_directory = directory;
+    m_unsavedRecords.clear();
+    m_journalSize = QFileInfo(journalFileName()).size() + QFileInfo(oldJournalFileName()).size();
+    m_snapshotSize = QFileInfo(snapshotFileName()).size();
+    readGeneration();
+}
+
+QString CookieJournal::snapshotFileName() const
+{
+    return m_directory + QLatin1String("/cookies.dat");
+}
+
+QString CookieJournal::journalFileName() const
+{
+    return m_directory + QLatin1String("/cookies.journal");
+}
+
+QString CookieJournal::oldJournalFileName() const
+{
+    return m_directory + QLatin1String("/cookies.journal.old");
+}
+
+// Returns the generation in the header of \a fileName or 0
+static quint32 fileGeneration(const QString &fileName, quint32 magic)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly))
+        return 0;
+    QDataStream stream(&file);
+    quint32 fileMagic;
+    quint32 version;
+    quint32 generation;
+    stream >> fileMagic >> version >> generation;
+    if (stream.status() != QDataStream::Ok || fileMagic != magic || version != JOURNAL_VERSION)
+        return 0;
+    return generation;
+}
+
+// Picks up where the files in the directory left off
+void CookieJournal::readGeneration()
+{
+    m_generation = qMax(fileGeneration(snapshotFileName(), SNAPSHOT_MAGIC),
+                        qMax(fileGeneration(journalFileName(), JOURNAL_MAGIC),
+                             fileGeneration(oldJournalFileName(), JOURNAL_MAGIC)));
+}
+
+bool CookieJournal::hasSnapshot() const
+{
+    return QFile::exists(snapshotFileName())
+        || QFile::exists(snapshotFileName() + QLatin1String(".new"));
+}
+
+static QString cookieKey(const QNetworkCookie &cookie)
+{
+    return cookie.domain() + QLatin1Char('\n') + cookie.path()
+           + QLatin1Char('\n') + QString::fromLatin1(cookie.name());
+}
+
+static QNetworkCookie parseCookie(const QByteArray &rawForm)
+{
+    QList<QNetworkCookie> cookies = QNetworkCookie::parseCookies(rawForm);
+    if (cookies.isEmpty()) {
+        qWarning() << "CookieJournal: Unable to parse saved cookie:" << rawForm;
+        return QNetworkCookie();
+    }
+    return cookies.first();
+}
+
+QList<QNetworkCookie> CookieJournal::load(const QList<QNetworkCookie> &cookies)
+{
+    waitForCompaction();
+
+    // We crashed between writing a snapshot and renaming it into place
+    QString newSnapshot = snapshotFileName() + QLatin1String(".new");
+    if (!QFile::exists(snapshotFileName()) && QFile::exists(newSnapshot))
+        QFile::rename(newSnapshot, snapshotFileName());
+
+    QList<QNetworkCookie> loaded;
+    quint32 generation = 0;
+    QFile file(snapshotFileName());
+    if (file.open(QFile::ReadOnly)) {
+        QDataStream stream(&file);
+        quint32 magic;
+        quint32 version;
+        quint32 count;
+        stream >> magic >> version >> generation >> count;
+        if (magic != SNAPSHOT_MAGIC || version != JOURNAL_VERSION) {
+            qWarning() << "CookieJournal: unknown snapshot format" << file.fileName();
+            generation = 0;
+        } else {
+            for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+                QByteArray rawForm;
+                stream >> rawForm;
+                QNetworkCookie cookie = parseCookie(rawForm);
+                if (!cookie.name().isEmpty())
+                    loaded.append(cookie);
+            }
+        }
+    } else {
+        loaded = cookies;
+    }
+
+    QHash<QString, int> keys;
+    for (int i = 0; i < loaded.count(); ++i)
+        keys.insert(cookieKey(loaded.at(i)), i);
+    m_generation = generation;
+    replay(oldJournalFileName(), generation, loaded, keys);
+    replay(journalFileName(), generation, loaded, keys);
+
+    // Drop what the journal deleted
+    QList<QNetworkCookie> result;
+    foreach (const QNetworkCookie &cookie, loaded) {
+        if (!cookie.name().isEmpty())
+            result.append(cookie);
+    }
+
+    m_unsavedRecords.clear();
+    m_journalSize = QFileInfo(journalFileName()).size() + QFileInfo(oldJournalFileName()).size();
+    m_snapshotSize = file.size();
+    return result;
+}
+
+/*
+    A journal ends at the last complete record, whatever follows it was
+    being written when we crashed.  One that is not newer than the snapshot
+    was left behind by a crash after the snapshot replaced it and is removed.
+  */
+void CookieJournal::replay(const QString &fileName, quint32 snapshotGeneration,
+                           QList<QNetworkCookie> &cookies, QHash<QString, int> &keys)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly))
+        return;
+    QDataStream stream(&file);
+    quint32 magic;
+    quint32 version;
+    quint32 generation;
+    stream >> magic >> version >> generation;
+    if (magic != JOURNAL_MAGIC || version != JOURNAL_VERSION) {
+        qWarning() << "CookieJournal: unknown journal format" << fileName;
+        return;
+    }
+    if (generation <= snapshotGeneration) {
+        file.close();
+        QFile::remove(fileName);
+        return;
+    }
+    m_generation = qMax(m_generation, generation);
+
+    while (!stream.atEnd()) {
+        quint8 type;
+        QByteArray rawForm;
+        stream >> type >> rawForm;
+        if (stream.status() != QDataStream::Ok)
+            break;
+        QNetworkCookie cookie = parseCookie(rawForm);
+        if (cookie.name().isEmpty())
+            continue;
+        QString key = cookieKey(cookie);
+        int index = keys.value(key, -1);
+        switch (type) {
+        case SetRecord:
+            if (index == -1) {
+                keys.insert(key, cookies.count());
+                cookies.append(cookie);
+            } else {
+                cookies[index] = cookie;
+            }
+            break;
+        case DeleteRecord:
+            if (index != -1) {
+                cookies[index] = QNetworkCookie(QByteArray(), QByteArray());
+                keys.remove(key);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void CookieJournal::append(RecordType type, const QNetworkCookie &cookie)
+{
+    QByteArray record;
+    QDataStream stream(&record, QIODevice::WriteOnly);
+    stream << quint8(type) << cookie.toRawForm();
+    m_unsavedRecords += record;
+}
+
+bool CookieJournal::flush()
+{
+    if (m_unsavedRecords.isEmpty())
+        return true;
+
+    QFile file(journalFileName());
+    if (!file.open(QFile::WriteOnly | QFile::Append)) {
+        qWarning() << "CookieJournal: unable to open" << file.fileName();
+        return false;
+    }
+    QByteArray data;
+    if (file.size() == 0) {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream << JOURNAL_MAGIC << JOURNAL_VERSION << ++m_generation;
+    }
+    data += m_unsavedRecords;
+    m_unsavedRecords.clear();
+    if (file.write(data) != data.size()) {
+        qWarning() << "CookieJournal: unable to write" << file.fileName();
+        return false;
+    }
+    m_journalSize += data.size();
+    return true;
+}
+
+bool CookieJournal::needsCompaction() const
+{
+    qint64 snapshotSize = m_snapshotSize;
+    if (m_writer && m_writer->isFinished())
+        snapshotSize = m_writer->size();
+    return m_journalSize + m_unsavedRecords.size() > qMax(MINIMUM_COMPACTION_SIZE, snapshotSize);
+}
+
+void CookieJournal::compact(const QList<QNetworkCookie> &cookies)
+{
+    waitForCompaction();
+    m_unsavedRecords.clear();
+
+    // New records go to a new journal, the old one is kept until the
+    // snapshot is written
+    QFile journal(journalFileName());
+    if (journal.exists()) {
+        QFile oldJournal(oldJournalFileName());
+        if (!oldJournal.exists()) {
+            journal.rename(oldJournal.fileName());
+        } else if (journal.open(QFile::ReadOnly) && oldJournal.open(QFile::WriteOnly | QFile::Append)) {
+            // Left behind by a compaction that failed, skip the header of
+            // the newer journal and keep its records
+            journal.seek(JOURNAL_HEADER_SIZE);
+            oldJournal.write(journal.readAll());
+            journal.close();
+            oldJournal.close();
+            journal.remove();
+        }
+    }
+    m_journalSize = 0;
+
+    // The snapshot replaces every journal written so far
+    m_writer = new CookieJournalWriter(snapshotFileName(), oldJournalFileName(), cookies, m_generation);
+    m_writer->start(QThread::LowPriority);
+}
+
+void CookieJournal::waitForCompaction()
+{
+    if (!m_writer)
+        return;
+    m_writer->wait();
+    if (m_writer->size() > 0)
+        m_snapshotSize = m_writer->size();
+    delete m_writer;
+    m_writer = 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef COOKIEJOURNAL_H
+#define COOKIEJOURNAL_H
+
+#include <qhash.h>
+#include <qlist.h>
+#include <qnetworkcookie.h>
+#include <qstring.h>
+
+/*
+    On disk storage for the cookies of a CookieJar.
+
+    The cookies are kept as a snapshot of the whole jar (cookies.dat) and a
+    journal (cookies.journal) of the cookies that were set or deleted since.
+    Saving a few changes appends a few records to the journal, and once the
+    journal grows past the size of the snapshot the jar is compacted into a
+    new snapshot on a worker thread.
+
+    A set record replaces the cookie with the same domain, path and name and
+    a delete record removes it.  When compacting, the journal is moved out of
+    the way (cookies.journal.old) and only removed once the new snapshot has
+    been renamed into place, so a crash at any point loses nothing that was
+    written.
+
+    Every journal starts with a generation that is one higher than the one
+    before it, and a snapshot carries the generation of the newest journal
+    it replaces.  Only journals with a newer generation than the snapshot
+    are replayed, replaying an older one could bring back cookies that were
+    deleted or cleared after it was written.
+  */
+class CookieJournalWriter;
+class CookieJournal
+{
+public:
+    enum RecordType {
+        SetRecord = 1,
+        DeleteRecord = 2
+    };
+
+    CookieJournal();
+    ~CookieJournal();
+
+    QString directory() const;
+    void setDirectory(const QString &directory);
+
+    bool hasSnapshot() const;
+
+    // The cookies in the snapshot, or \a cookies when there is none, with
+    // the journal replayed on top
+    QList<QNetworkCookie> load(const QList<QNetworkCookie> &cookies = QList<QNetworkCookie>());
+
+    // Records are kept in memory until flush()
+    void append(RecordType type, const QNetworkCookie &cookie);
+    bool flush();
+
+    bool needsCompaction() const;
+    // Replaces the snapshot with \a cookies and drops the journal
+    void compact(const QList<QNetworkCookie> &cookies);
+    void waitForCompaction();
+
+private:
+    QString snapshotFileName() const;
+    QString journalFileName() const;
+    QString oldJournalFileName() const;
+    void replay(const QString &fileName, quint32 snapshotGeneration,
+                QList<QNetworkCookie> &cookies, QHash<QString, int> &keys);
+    void readGeneration();
+
+    QString m_directory;
+    QByteArray m_unsavedRecords;
+    qint64 m_journalSize;
+    qint64 m_snapshotSize;
+    // Of the newest journal that was written or read
+    quint32 m_generation;
+    CookieJournalWriter *m_writer;
+};
+
+#endif // COOKIEJOURNAL_H
+
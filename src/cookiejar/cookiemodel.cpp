@@ -164,10 +164,8 @@ bool CookieModel::removeRows(int row, int count, const QModelIndex &parent)
     int lastRow = row + count - 1;
     beginRemoveRows(parent, row, lastRow);
     QList<QNetworkCookie> lst = m_cookieJar->allCookies();
-    for (int i = lastRow; i >= row; --i) {
-        lst.removeAt(i);
-    }
-    m_cookieJar->setAllCookies(lst);
+    for (int i = lastRow; i >= row; --i)
+        m_cookieJar->deleteCookie(lst.at(i));
     endRemoveRows();
     return true;
 }
@@ -36,7 +36,7 @@
 
 #include "networkcookiejar.h"
 #include "networkcookiejar_p.h"
-#include "twoleveldomains_p.h"
+#include "publicsuffix.h"
 
 //#define NETWORKCOOKIEJAR_DEBUG
 
@@ -49,6 +49,9 @@
 
 #include <qurl.h>
 #include <qdatetime.h>
+#include <qcoreapplication.h>
+#include <qcoreevent.h>
+#include <qthread.h>
 
 #if defined(NETWORKCOOKIEJAR_DEBUG)
 #include <qdebug.h>
@@ -58,7 +61,7 @@
 NetworkCookieJar::NetworkCookieJar(QObject *parent)
         : QNetworkCookieJar(parent)
 {
-    d = new NetworkCookieJarPrivate;
+    d = new NetworkCookieJarPrivate(this);
 }
 
 NetworkCookieJar::~NetworkCookieJar()
@@ -76,9 +79,21 @@ static QStringList splitHost(const QString &host) {
     return parts;
 }
 
-inline static bool shorterPaths(const QNetworkCookie &c1, const QNetworkCookie &c2)
+class ShorterPaths {
+public:
+    ShorterPaths(const NetworkCookieStore &store) : store(store) {}
+    inline bool operator()(int c1, int c2) const
+        { return store.path(c2).length() < store.path(c1).length(); }
+    const NetworkCookieStore &store;
+};
+
+static QString urlHost(const QUrl &url, bool *isSecure)
 {
-    return c2.path().length() < c1.path().length();
+    QString scheme = url.scheme().toLower();
+    *isSecure = scheme == QLatin1String("https");
+    if (scheme == QLatin1String("file"))
+        return QLatin1String("localhost");
+    return url.host();
 }
 
 QList<QNetworkCookie> NetworkCookieJar::cookiesForUrl(const QUrl &url) const
@@ -86,67 +101,37 @@ QList<QNetworkCookie> NetworkCookieJar::cookiesForUrl(const QUrl &url) const
 #if defined(NETWORKCOOKIEJAR_DEBUG)
     qDebug() << "NetworkCookieJar::" << __FUNCTION__ << url;
 #endif
-    // Generate split host
-    QString host = url.host();
-    if (url.scheme().toLower() == QLatin1String("file"))
-        host = QLatin1String("localhost");
-    QStringList urlHost = splitHost(host);
-
-    // Get all the cookies for url
-    QList<QNetworkCookie> cookies = d->tree.find(urlHost);
-    if (urlHost.count() > 2) {
-        int top = 2;
-        if (d->matchesBlacklist(urlHost.last()))
-            top = 3;
-
-        urlHost.removeFirst();
-        while (urlHost.count() >= top) {
-            cookies += d->tree.find(urlHost);
-            urlHost.removeFirst();
-        }
-    }
-
-    // Prevent doing anything expensive in the common case where
-    // there are no cookies to check
-    if (cookies.isEmpty())
-        return cookies;
+    bool isSecure;
+    QString host = urlHost(url, &isSecure);
 
+    // Everything but the path only depends on the host, a page asks for the
+    // cookies of the same few hosts over and over
     QDateTime now = QDateTime::currentDateTime().toTimeSpec(Qt::UTC);
-    const QString urlPath = d->urlPath(url);
-    const bool isSecure = url.scheme().toLower() == QLatin1String("https");
-    QList<QNetworkCookie>::iterator i = cookies.begin();
-    for (; i != cookies.end();) {
-        if (!d->matchingPath(*i, urlPath)) {
-#if defined(NETWORKCOOKIEJAR_DEBUG)
-            qDebug() << __FUNCTION__ << "Ignoring cookie, path does not match" << *i << urlPath;
-#endif
-            i = cookies.erase(i);
-            continue;
+    QString cacheKey = (isSecure ? QLatin1Char('s') : QLatin1Char('i')) + host;
+    QList<QNetworkCookie> cookies;
+    NetworkCookieJarHostCookies *cached = d->hostCache.object(cacheKey);
+    if (cached
+        && cached->generation == d->generation
+        && (!cached->expires.isValid() || now <= cached->expires)) {
+        ++d->cacheHits;
+        cookies = cached->cookies;
+    } else {
+        ++d->cacheMisses;
+        QList<int> ids = d->hostCookies(d->tree, d->store, d->secondLevelDomains, host, isSecure, now);
+        cookies = d->store.cookies(ids);
+        cached = new NetworkCookieJarHostCookies;
+        cached->generation = d->generation;
+        cached->cookies = cookies;
+        foreach (const QNetworkCookie &cookie, cookies) {
+            if (!cookie.isSessionCookie()
+                && (!cached->expires.isValid() || cookie.expirationDate() < cached->expires))
+                cached->expires = cookie.expirationDate();
         }
-        if (!isSecure && i->isSecure()) {
-            i = cookies.erase(i);
-#if defined(NETWORKCOOKIEJAR_DEBUG)
-            qDebug() << __FUNCTION__ << "Ignoring cookie, security mismatch"
-                     << *i << !isSecure;
-#endif
-            continue;
-        }
-        if (!i->isSessionCookie() && now > i->expirationDate()) {
-            // remove now (expensive short term) because there will
-            // probably be many more cookiesForUrl calls for this host
-            d->tree.remove(splitHost(i->domain()), *i);
-#if defined(NETWORKCOOKIEJAR_DEBUG)
-            qDebug() << __FUNCTION__ << "Ignoring cookie, expiration issue"
-                     << *i << now;
-#endif
-            i = cookies.erase(i);
-            continue;
-        }
-        ++i;
+        d->hostCache.insert(cacheKey, cached);
     }
 
-    // shorter paths should go first
-    qSort(cookies.begin(), cookies.end(), shorterPaths);
+    d->removeMismatchedPaths(cookies, url);
+
 #if defined(NETWORKCOOKIEJAR_DEBUG)
     qDebug() << "NetworkCookieJar::" << __FUNCTION__ << "returning" << cookies.count();
     qDebug() << cookies;
@@ -154,6 +139,60 @@ QList<QNetworkCookie> NetworkCookieJar::cookiesForUrl(const QUrl &url) const
     return cookies;
 }
 
+/*!
+    Returns how many calls to cookiesForUrl() were answered from the
+    cookies cached for the host of the url.
+  */
+int NetworkCookieJar::cacheHits() const
+{
+    return d->cacheHits;
+}
+
+/*!
+    Returns how many calls to cookiesForUrl() had to look up the cookies
+    of the host of the url.
+  */
+int NetworkCookieJar::cacheMisses() const
+{
+    return d->cacheMisses;
+}
+
+/*!
+    Returns an estimate of the memory used by the cookies, their index and
+    the expiration heap.
+  */
+int NetworkCookieJar::memoryUsage() const
+{
+    return d->tree.memoryUsage() + d->store.memoryUsage()
+           + d->expiryHeap.capacity() * sizeof(NetworkCookieJarExpiry);
+}
+
+static const QEvent::Type PublishSnapshotEvent = QEvent::User;
+
+/*!
+    Returns the most recently published snapshot of the cookies, which can
+    be used on any thread.
+
+    Asking for a snapshot on the thread of the jar publishes any changes
+    right away.  Once a snapshot has been asked for on another thread,
+    changes are published whenever control returns to the event loop of
+    the thread of the jar.
+  */
+NetworkCookieJarSnapshot NetworkCookieJar::snapshot() const
+{
+    if (QThread::currentThread() == thread()) {
+        d->publishSnapshot();
+    } else if (d->snapshotReaders.testAndSetOrdered(0, 1)) {
+        // Changes made before the first reader came along
+        QCoreApplication::postEvent(const_cast<NetworkCookieJar*>(this),
+                                    new QEvent(PublishSnapshotEvent));
+    }
+    NetworkCookieJarSnapshot snapshot;
+    QReadLocker locker(&d->snapshotLock);
+    snapshot.d = d->snapshot;
+    return snapshot;
+}
+
 static const qint32 NetworkCookieJarMagic = 0xae;
 
 QByteArray NetworkCookieJar::saveState () const
@@ -162,9 +201,13 @@ QByteArray NetworkCookieJar::saveState () const
     QByteArray data;
     QDataStream stream(&data, QIODevice::WriteOnly);
 
+    // Written as a tree of cookies like before they were packed
+    FlatTrie<QNetworkCookie> tree;
+    foreach (int id, d->tree.all())
+        tree.insert(splitHost(d->store.domain(id)), d->store.cookie(id));
     stream << qint32(NetworkCookieJarMagic);
     stream << qint32(version);
-    stream << d->tree;
+    stream << tree;
     return data;
 }
 
@@ -181,7 +224,9 @@ bool NetworkCookieJar::restoreState(const QByteArray &state)
     stream >> v;
     if (marker != NetworkCookieJarMagic || v != version)
         return false;
-    stream >> d->tree;
+    FlatTrie<QNetworkCookie> tree;
+    stream >> tree;
+    setAllCookies(tree.all());
     return true;
 }
 
@@ -190,18 +235,60 @@ bool NetworkCookieJar::restoreState(const QByteArray &state)
   */
 void NetworkCookieJar::endSession()
 {
-    const QList<QNetworkCookie> cookies = d->tree.all();
-    QDateTime now = QDateTime::currentDateTime().toTimeSpec(Qt::UTC);
-    QList<QNetworkCookie>::const_iterator i = cookies.constBegin();
-    for (; i != cookies.constEnd();) {
-        if (i->isSessionCookie()
-            || (!i->isSessionCookie() && now > i->expirationDate())) {
-                d->tree.remove(splitHost(i->domain()), *i);
-        }
-        ++i;
+    removeExpiredCookies();
+    foreach (int id, d->tree.all()) {
+        if (d->store.isSessionCookie(id))
+            d->removeCookie(splitHost(d->store.domain(id)), id);
     }
 }
 
+/*!
+    Removes every cookie that has expired and returns how many were removed.
+
+    This is done when the first cookie expires and can be called before
+    the cookies are saved, until then cookiesForUrl() skips expired cookies.
+  */
+int NetworkCookieJar::removeExpiredCookies()
+{
+    return d->removeExpiredCookies();
+}
+
+/*!
+    Called when \a cookie has been added to the jar on its own, but not by
+    setAllCookies() or restoreState().
+  */
+void NetworkCookieJar::cookieInserted(const QNetworkCookie &cookie)
+{
+    Q_UNUSED(cookie);
+}
+
+/*!
+    Called when \a cookie has been removed from the jar on its own, but not
+    when it expired or by setAllCookies() or restoreState().
+  */
+void NetworkCookieJar::cookieDeleted(const QNetworkCookie &cookie)
+{
+    Q_UNUSED(cookie);
+}
+
+void NetworkCookieJar::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() == d->expiryTimer.timerId())
+        removeExpiredCookies();
+    else if (event->timerId() == d->publishTimer.timerId())
+        d->publishSnapshot();
+    else
+        QNetworkCookieJar::timerEvent(event);
+}
+
+void NetworkCookieJar::customEvent(QEvent *event)
+{
+    if (event->type() == PublishSnapshotEvent)
+        d->publishSnapshot();
+    else
+        QNetworkCookieJar::customEvent(event);
+}
+
 static const int maxCookiePathLength = 1024;
 
 bool NetworkCookieJar::setCookiesFromUrl(const QList<QNetworkCookie> &cookieList, const QUrl &url)
@@ -257,34 +344,50 @@ bool NetworkCookieJar::setCookiesFromUrl(const QList<QNetworkCookie> &cookieList
         QString domain = cookie.domain();
         Q_ASSERT(!domain.isEmpty());
         QStringList urlHost = splitHost(domain);
-
-        QList<QNetworkCookie> cookies = d->tree.find(urlHost);
-        QList<QNetworkCookie>::const_iterator it = cookies.constBegin();
-        for (; it != cookies.constEnd(); ++it) {
-            if (cookie.name() == it->name() &&
-                cookie.domain() == it->domain() &&
-                cookie.path() == it->path()) {
-                d->tree.remove(urlHost, *it);
-                break;
-            }
-        }
+        d->removeMatchingCookie(urlHost, cookie);
 
         if (alreadyDead)
             continue;
 
         changed = true;
-        d->tree.insert(urlHost, cookie);
+        d->insertCookie(urlHost, cookie);
     }
 
     return changed;
 }
 
+/*!
+    Adds \a cookie to the jar without any checks, replacing the cookie with
+    the same domain, path and name if there is one.  An expired cookie only
+    removes the one it replaces.
+
+    Only the cookies of the domain of \a cookie are looked at.
+  */
+bool NetworkCookieJar::insertCookie(const QNetworkCookie &cookie)
+{
+    QDateTime now = QDateTime::currentDateTime().toTimeSpec(Qt::UTC);
+    QStringList host = splitHost(cookie.domain());
+    bool removed = d->removeMatchingCookie(host, cookie);
+    if (!cookie.isSessionCookie() && cookie.expirationDate() < now)
+        return removed;
+    d->insertCookie(host, cookie);
+    return true;
+}
+
+/*!
+    Removes the cookie with the same domain, path and name as \a cookie.
+  */
+bool NetworkCookieJar::deleteCookie(const QNetworkCookie &cookie)
+{
+    return d->removeMatchingCookie(splitHost(cookie.domain()), cookie);
+}
+
 QList<QNetworkCookie> NetworkCookieJar::allCookies() const
 {
 #if defined(NETWORKCOOKIEJAR_DEBUG)
     qDebug() << "NetworkCookieJar::" << __FUNCTION__;
 #endif
-    return d->tree.all();
+    return d->store.cookies(d->tree.all());
 }
 
 void NetworkCookieJar::setAllCookies(const QList<QNetworkCookie> &cookieList)
@@ -293,13 +396,261 @@ void NetworkCookieJar::setAllCookies(const QList<QNetworkCookie> &cookieList)
     qDebug() << "NetworkCookieJar::" << __FUNCTION__ << cookieList.count();
 #endif
     d->tree.clear();
+    d->store.clear();
+    d->expiryHeap.clear();
+    d->expiringCookies = 0;
+    d->changed();
     foreach (const QNetworkCookie &cookie, cookieList) {
         QString domain = cookie.domain();
-        d->tree.insert(splitHost(domain), cookie);
+        d->insertCookie(splitHost(domain), cookie, false);
+    }
+    d->startExpiryTimer();
+}
+
+/*
+    Returns the ids of the cookies in \a tree for \a host that are secure
+    enough and have not expired, shortest path first.
+  */
+QList<int> NetworkCookieJarPrivate::hostCookies(const FlatTrie<int> &tree, const NetworkCookieStore &store,
+                                                const QStringList &secondLevelDomains,
+                                                const QString &host, bool isSecure, const QDateTime &now)
+{
+    // Get all the cookies for the host and the domains it is in down to
+    // the registrable domain
+    QStringList urlHost = splitHost(host);
+    QList<int> cookies = tree.find(urlHost);
+    if (urlHost.count() > 2) {
+        int top = suffixLabels(urlHost, secondLevelDomains) + 1;
+        urlHost.removeFirst();
+        while (urlHost.count() >= top) {
+            cookies += tree.find(urlHost);
+            urlHost.removeFirst();
+        }
+    }
+
+    qint64 nowMSecs = NetworkCookieStore::toMSecs(now);
+    QList<int>::iterator i = cookies.begin();
+    for (; i != cookies.end();) {
+        if (!isSecure && store.isSecure(*i)) {
+#if defined(NETWORKCOOKIEJAR_DEBUG)
+            qDebug() << __FUNCTION__ << "Ignoring cookie, security mismatch"
+                     << store.cookie(*i) << !isSecure;
+#endif
+            i = cookies.erase(i);
+            continue;
+        }
+        // Expired cookies are left for removeExpiredCookies()
+        if (!store.isSessionCookie(*i) && nowMSecs > store.expires(*i)) {
+#if defined(NETWORKCOOKIEJAR_DEBUG)
+            qDebug() << __FUNCTION__ << "Ignoring cookie, expiration issue"
+                     << store.cookie(*i) << now;
+#endif
+            i = cookies.erase(i);
+            continue;
+        }
+        ++i;
+    }
+
+    // shorter paths should go first
+    qSort(cookies.begin(), cookies.end(), ShorterPaths(store));
+    return cookies;
+}
+
+void NetworkCookieJarPrivate::removeMismatchedPaths(QList<QNetworkCookie> &cookies, const QUrl &url)
+{
+    // Prevent doing anything expensive in the common case where
+    // there are no cookies to check
+    if (cookies.isEmpty())
+        return;
+
+    const QString path = urlPath(url);
+    QList<QNetworkCookie>::iterator i = cookies.begin();
+    for (; i != cookies.end();) {
+        if (!matchingPath(*i, path)) {
+#if defined(NETWORKCOOKIEJAR_DEBUG)
+            qDebug() << __FUNCTION__ << "Ignoring cookie, path does not match" << *i << path;
+#endif
+            i = cookies.erase(i);
+            continue;
+        }
+        ++i;
     }
 }
 
-QString NetworkCookieJarPrivate::urlPath(const QUrl &url) const
+void NetworkCookieJarPrivate::changed()
+{
+    ++generation;
+    if (snapshotReaders && !publishTimer.isActive())
+        publishTimer.start(0, q);
+}
+
+/*
+    Readers keep the snapshot they got for as long as they like, the jar
+    only ever replaces the pointer to the current one.  Copying the tree
+    is cheap, the next change to the jar pays for detaching from it.
+  */
+void NetworkCookieJarPrivate::publishSnapshot()
+{
+    publishTimer.stop();
+    if (snapshot->generation == generation)
+        return;
+    QExplicitlySharedDataPointer<NetworkCookieJarSnapshotData> data(new NetworkCookieJarSnapshotData);
+    data->generation = generation;
+    data->tree = tree;
+    data->store = store;
+    data->secondLevelDomains = secondLevelDomains;
+
+    QWriteLocker locker(&snapshotLock);
+    qSwap(snapshot, data);
+    locker.unlock();
+    // the old snapshot is released outside of the lock
+}
+
+// In seconds, dates before 1970 are due right away
+static uint expiryTime(qint64 expires)
+{
+    return uint(expires / 1000);
+}
+
+void NetworkCookieJarPrivate::insertCookie(const QStringList &host, const QNetworkCookie &cookie, bool notify)
+{
+    int id = store.insert(cookie);
+    tree.insert(host, id);
+    changed();
+    if (notify)
+        q->cookieInserted(cookie);
+    if (!store.isSessionCookie(id)) {
+        ++expiringCookies;
+        pushExpiry(id);
+        if (expiryHeap.count() == 1 || expiryHeap.first().expires == expiryTime(store.expires(id)))
+            startExpiryTimer();
+    }
+}
+
+bool NetworkCookieJarPrivate::removeCookie(const QStringList &host, int id)
+{
+    if (!tree.remove(host, id))
+        return false;
+    changed();
+    q->cookieDeleted(store.cookie(id));
+    if (!store.isSessionCookie(id)) {
+        --expiringCookies;
+        if (expiryHeap.count() > 1024 && expiryHeap.count() > expiringCookies * 2)
+            rebuildExpiryHeap();
+    }
+    store.remove(id);
+    return true;
+}
+
+// Removes the cookie with the same domain, path and name as \a cookie
+bool NetworkCookieJarPrivate::removeMatchingCookie(const QStringList &host, const QNetworkCookie &cookie)
+{
+    foreach (int id, tree.find(host)) {
+        if (store.matches(id, cookie))
+            return removeCookie(host, id);
+    }
+    return false;
+}
+
+/*
+    Pops the cookies that are due off the heap, O(log n) for each
+  */
+int NetworkCookieJarPrivate::removeExpiredCookies()
+{
+    qint64 now = NetworkCookieStore::toMSecs(QDateTime::currentDateTime());
+    uint nowTime = expiryTime(now);
+    int removed = 0;
+    while (!expiryHeap.isEmpty() && expiryHeap.first().expires <= nowTime) {
+        NetworkCookieJarExpiry expiry = expiryHeap.first();
+        popExpiry();
+        int id = expiry.id;
+        if (!store.isLive(id)
+            || store.isSessionCookie(id)
+            || expiryTime(store.expires(id)) != expiry.expires)
+            continue;
+        if (now <= store.expires(id)) {
+            // Due within the second, try again later
+            pushExpiry(id);
+            break;
+        }
+        if (tree.remove(splitHost(store.domain(id)), id)) {
+            store.remove(id);
+            --expiringCookies;
+            ++removed;
+        }
+    }
+    if (removed > 0)
+        changed();
+    startExpiryTimer();
+    return removed;
+}
+
+void NetworkCookieJarPrivate::rebuildExpiryHeap()
+{
+    expiryHeap.clear();
+    expiringCookies = 0;
+    foreach (int id, tree.all()) {
+        if (store.isSessionCookie(id))
+            continue;
+        ++expiringCookies;
+        pushExpiry(id);
+    }
+    startExpiryTimer();
+}
+
+void NetworkCookieJarPrivate::pushExpiry(int id)
+{
+    NetworkCookieJarExpiry expiry;
+    expiry.expires = expiryTime(store.expires(id));
+    expiry.id = id;
+    int i = expiryHeap.count();
+    expiryHeap.append(expiry);
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (expiryHeap.at(parent).expires <= expiry.expires)
+            break;
+        expiryHeap[i] = expiryHeap.at(parent);
+        i = parent;
+    }
+    expiryHeap[i] = expiry;
+}
+
+void NetworkCookieJarPrivate::popExpiry()
+{
+    NetworkCookieJarExpiry last = expiryHeap.last();
+    expiryHeap.pop_back();
+    int count = expiryHeap.count();
+    if (count == 0)
+        return;
+    int i = 0;
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= count)
+            break;
+        if (child + 1 < count && expiryHeap.at(child + 1).expires < expiryHeap.at(child).expires)
+            ++child;
+        if (last.expires <= expiryHeap.at(child).expires)
+            break;
+        expiryHeap[i] = expiryHeap.at(child);
+        i = child;
+    }
+    expiryHeap[i] = last;
+}
+
+// Wakes up when the first cookie expires, or at least once an hour
+void NetworkCookieJarPrivate::startExpiryTimer()
+{
+    if (expiryHeap.isEmpty()) {
+        expiryTimer.stop();
+        return;
+    }
+    uint nowTime = QDateTime::currentDateTime().toTime_t();
+    uint expires = expiryHeap.first().expires;
+    int seconds = expires < nowTime ? 0 : int(qMin<uint>(expires - nowTime, 60 * 60));
+    expiryTimer.start((seconds + 1) * 1000, q);
+}
+
+QString NetworkCookieJarPrivate::urlPath(const QUrl &url)
 {
     QString urlPath = url.path();
     if (!urlPath.endsWith(QLatin1Char('/')))
@@ -307,7 +658,7 @@ QString NetworkCookieJarPrivate::urlPath(const QUrl &url) const
     return urlPath;
 }
 
-bool NetworkCookieJarPrivate::matchingPath(const QNetworkCookie &cookie, const QString &urlPath) const
+bool NetworkCookieJarPrivate::matchingPath(const QNetworkCookie &cookie, const QString &urlPath)
 {
     QString cookiePath = cookie.path();
     if (!cookiePath.endsWith(QLatin1Char('/')))
@@ -316,18 +667,19 @@ bool NetworkCookieJarPrivate::matchingPath(const QNetworkCookie &cookie, const Q
     return urlPath.startsWith(cookiePath);
 }
 
-bool NetworkCookieJarPrivate::matchesBlacklist(const QString &string) const
+/*
+    The number of labels at the end of the split domain \a parts that are
+    a public suffix, from the Public Suffix List and the top level domains
+    set with setSecondLevelDomains().
+  */
+int NetworkCookieJarPrivate::suffixLabels(const QStringList &parts, const QStringList &secondLevelDomains)
 {
-    if (!setSecondLevelDomain) {
-        // Alternatively to save a little bit of ram we could just
-        // use bsearch on twoLevelDomains in place
-        for (int j = 0; twoLevelDomains[j]; ++j)
-            secondLevelDomains += QLatin1String(twoLevelDomains[j]);
-        setSecondLevelDomain = true;
-    }
-    QStringList::const_iterator i =
-         qBinaryFind(secondLevelDomains.constBegin(), secondLevelDomains.constEnd(), string);
-        return (i != secondLevelDomains.constEnd());
+    int labels = PublicSuffix::suffixLabels(parts);
+    if (labels < 2 && parts.count() > 1
+        && qBinaryFind(secondLevelDomains.constBegin(), secondLevelDomains.constEnd(), parts.last())
+           != secondLevelDomains.constEnd())
+        labels = 2;
+    return labels;
 }
 
 bool NetworkCookieJarPrivate::matchingDomain(const QNetworkCookie &cookie, const QUrl &url) const
@@ -347,8 +699,8 @@ bool NetworkCookieJarPrivate::matchingDomain(const QNetworkCookie &cookie, const
             return true;
     }
 
-    // Check for blacklist
-    if (parts.count() == 2 && matchesBlacklist(parts.last()))
+    // No cookies for a public suffix such as co.uk
+    if (parts.count() > 1 && suffixLabels(parts, secondLevelDomains) >= parts.count())
         return false;
 
     QStringList urlParts = url.host().toLower().split(QLatin1Char('.'), QString::SkipEmptyParts);
@@ -366,10 +718,77 @@ bool NetworkCookieJarPrivate::matchingDomain(const QNetworkCookie &cookie, const
     return true;
 }
 
+/*!
+    Treats every second level domain of the top level domains in
+    \a secondLevelDomains as a public suffix, on top of the ones on the
+    Public Suffix List.
+  */
 void NetworkCookieJar::setSecondLevelDomains(const QStringList &secondLevelDomains)
 {
-    d->setSecondLevelDomain = true;
     d->secondLevelDomains = secondLevelDomains;
     qSort(d->secondLevelDomains);
+    d->changed();
+}
+
+/*!
+    \class NetworkCookieJarSnapshot
+
+    An immutable copy of the cookies of a NetworkCookieJar as they were
+    when it was published.  Snapshots are reference counted and can be
+    copied and looked up from any thread without locking.
+  */
+NetworkCookieJarSnapshot::NetworkCookieJarSnapshot()
+    : d(new NetworkCookieJarSnapshotData)
+{
+}
+
+NetworkCookieJarSnapshot::NetworkCookieJarSnapshot(const NetworkCookieJarSnapshot &other)
+    : d(other.d)
+{
+}
+
+NetworkCookieJarSnapshot::~NetworkCookieJarSnapshot()
+{
+}
+
+NetworkCookieJarSnapshot &NetworkCookieJarSnapshot::operator=(const NetworkCookieJarSnapshot &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    Returns the generation of the jar the snapshot was taken at, later
+    snapshots have a higher generation.
+  */
+int NetworkCookieJarSnapshot::generation() const
+{
+    return d->generation;
+}
+
+bool NetworkCookieJarSnapshot::isEmpty() const
+{
+    return d->tree.isEmpty();
+}
+
+/*!
+    Returns the cookies for \a url the same way NetworkCookieJar::cookiesForUrl()
+    would have when the snapshot was taken.
+  */
+QList<QNetworkCookie> NetworkCookieJarSnapshot::cookiesForUrl(const QUrl &url) const
+{
+    bool isSecure;
+    QString host = urlHost(url, &isSecure);
+    QDateTime now = QDateTime::currentDateTime().toTimeSpec(Qt::UTC);
+    QList<int> ids = NetworkCookieJarPrivate::hostCookies(d->tree, d->store, d->secondLevelDomains,
+                                                          host, isSecure, now);
+    QList<QNetworkCookie> cookies = d->store.cookies(ids);
+    NetworkCookieJarPrivate::removeMismatchedPaths(cookies, url);
+    return cookies;
+}
+
+QList<QNetworkCookie> NetworkCookieJarSnapshot::allCookies() const
+{
+    return d->store.cookies(d->tree.all());
 }
 
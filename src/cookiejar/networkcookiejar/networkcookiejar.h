@@ -38,6 +38,25 @@
 #define NETWORKCOOKIEJAR_H
 
 #include <qnetworkcookie.h>
+#include <qshareddata.h>
+
+class NetworkCookieJarSnapshotData;
+class NetworkCookieJarSnapshot {
+public:
+    NetworkCookieJarSnapshot();
+    NetworkCookieJarSnapshot(const NetworkCookieJarSnapshot &other);
+    ~NetworkCookieJarSnapshot();
+    NetworkCookieJarSnapshot &operator=(const NetworkCookieJarSnapshot &other);
+
+    int generation() const;
+    bool isEmpty() const;
+    QList<QNetworkCookie> cookiesForUrl(const QUrl &url) const;
+    QList<QNetworkCookie> allCookies() const;
+
+private:
+    friend class NetworkCookieJar;
+    QExplicitlySharedDataPointer<NetworkCookieJarSnapshotData> d;
+};
 
 class NetworkCookieJarPrivate;
 class NetworkCookieJar : public QNetworkCookieJar {
@@ -49,6 +68,16 @@ public:
     virtual QList<QNetworkCookie> cookiesForUrl(const QUrl & url) const;
     virtual bool setCookiesFromUrl(const QList<QNetworkCookie> &cookieList, const QUrl &url);
 
+    // How often cookiesForUrl() used the cookies cached for a host
+    int cacheHits() const;
+    int cacheMisses() const;
+
+    // Roughly how many bytes hold the cookies, without the host cache
+    int memoryUsage() const;
+
+    // Thread safe
+    NetworkCookieJarSnapshot snapshot() const;
+
 protected:
     QByteArray saveState() const;
     bool restoreState(const QByteArray &state);
@@ -56,9 +85,18 @@ protected:
 
     QList<QNetworkCookie> allCookies() const;
     void setAllCookies(const QList<QNetworkCookie> &cookieList);
+    bool insertCookie(const QNetworkCookie &cookie);
+    bool deleteCookie(const QNetworkCookie &cookie);
     void setSecondLevelDomains(const QStringList &secondLevelDomains);
 
+    virtual int removeExpiredCookies();
+    virtual void cookieInserted(const QNetworkCookie &cookie);
+    virtual void cookieDeleted(const QNetworkCookie &cookie);
+    void timerEvent(QTimerEvent *event);
+    void customEvent(QEvent *event);
+
 private:
+    friend class NetworkCookieJarPrivate;
     NetworkCookieJarPrivate *d;
 };
 
@@ -1,5 +1,5 @@
 INCLUDEPATH += $$PWD
 DEPENDPATH += $$PWD
 
-HEADERS += trie_p.h networkcookiejar.h twoleveldomains_p.h networkcookiejar_p.h
-SOURCES += networkcookiejar.cpp
+HEADERS += trie_p.h networkcookiejar.h networkcookiejar_p.h networkcookiestore_p.h publicsuffix.h publicsuffixlist_p.h
+SOURCES += networkcookiejar.cpp networkcookiestore.cpp publicsuffix.cpp
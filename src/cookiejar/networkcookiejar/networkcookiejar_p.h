@@ -37,8 +37,17 @@
 #ifndef NETWORKCOOKIEJARPRIVATE_H
 #define NETWORKCOOKIEJARPRIVATE_H
 
+#include "networkcookiestore_p.h"
 #include "trie_p.h"
 
+#include <qatomic.h>
+#include <qbasictimer.h>
+#include <qcache.h>
+#include <qdatetime.h>
+#include <qreadwritelock.h>
+#include <qshareddata.h>
+#include <qvector.h>
+
 QT_BEGIN_NAMESPACE
 QDataStream &operator<<(QDataStream &stream, const QNetworkCookie &cookie)
 {
@@ -57,20 +66,109 @@ QDataStream &operator>>(QDataStream &stream, QNetworkCookie &cookie)
 }
 QT_END_NAMESPACE
 
+/*
+    The cookies of a host that are left after checking everything but the
+    path, sorted with the shortest path first.  Only valid while the
+    generation of the jar is the same and until \a expires.
+*/
+class NetworkCookieJarHostCookies {
+public:
+    int generation;
+    QDateTime expires;
+    QList<QNetworkCookie> cookies;
+};
+
+/*
+    An entry in the expiration heap, the cookie might have been removed
+    from the tree since and its id reused.
+*/
+class NetworkCookieJarExpiry {
+public:
+    uint expires;
+    int id;
+};
+Q_DECLARE_TYPEINFO(NetworkCookieJarExpiry, Q_PRIMITIVE_TYPE);
+
+/*
+    What a NetworkCookieJarSnapshot looks cookies up in.  Never changed once
+    it has been published, the tree shares its data with the tree of the jar
+    until the jar changes again.
+*/
+class NetworkCookieJarSnapshotData : public QSharedData {
+public:
+    NetworkCookieJarSnapshotData() : generation(0) {}
+
+    int generation;
+    FlatTrie<int> tree;
+    NetworkCookieStore store;
+    QStringList secondLevelDomains;
+};
+
 class NetworkCookieJarPrivate {
 public:
-    NetworkCookieJarPrivate()
-        : setSecondLevelDomain(false)
+    NetworkCookieJarPrivate(NetworkCookieJar *jar)
+        : q(jar)
+        , expiringCookies(0)
+        , hostCache(256)
+        , generation(0)
+        , cacheHits(0)
+        , cacheMisses(0)
+        , snapshot(new NetworkCookieJarSnapshotData)
+        , snapshotReaders(0)
     {}
 
-    Trie<QNetworkCookie> tree;
-    mutable bool setSecondLevelDomain;
-    mutable QStringList secondLevelDomains;
+    NetworkCookieJar *q;
+
+    // The ids of the cookies in the store by their domain
+    FlatTrie<int> tree;
+    NetworkCookieStore store;
+
+    // A min-heap on the expiration date of the cookies that are not session
+    // cookies.  Removed cookies are left behind and skipped when they come
+    // up, the heap is rebuilt when most of it is left behind.
+    QVector<NetworkCookieJarExpiry> expiryHeap;
+    int expiringCookies;
+    QBasicTimer expiryTimer;
+    QStringList secondLevelDomains;
+
+    // Keyed by the host with 's' or 'i' for secure or insecure in front.
+    // Anything that changes the tree calls changed() to bump the generation.
+    QCache<QString, NetworkCookieJarHostCookies> hostCache;
+    int generation;
+    int cacheHits;
+    int cacheMisses;
+
+    // The last published snapshot, the lock is only held to copy or
+    // replace the pointer.  Snapshots are only published when asked for,
+    // once a reader on another thread has asked a batch of changes is
+    // published whenever control gets back to the event loop.  A jar
+    // nobody reads from never shares its tree and changes it in place.
+    QExplicitlySharedDataPointer<NetworkCookieJarSnapshotData> snapshot;
+    mutable QReadWriteLock snapshotLock;
+    QBasicTimer publishTimer;
+    QAtomicInt snapshotReaders;
+
+    void changed();
+    void publishSnapshot();
+
+    static QList<int> hostCookies(const FlatTrie<int> &tree, const NetworkCookieStore &store,
+                                  const QStringList &secondLevelDomains,
+                                  const QString &host, bool isSecure, const QDateTime &now);
+    static void removeMismatchedPaths(QList<QNetworkCookie> &cookies, const QUrl &url);
+
+    void insertCookie(const QStringList &host, const QNetworkCookie &cookie, bool notify = true);
+    bool removeCookie(const QStringList &host, int id);
+    bool removeMatchingCookie(const QStringList &host, const QNetworkCookie &cookie);
+    int removeExpiredCookies();
+    void rebuildExpiryHeap();
+    void pushExpiry(int id);
+    void popExpiry();
+    void startExpiryTimer();
 
-    bool matchesBlacklist(const QString &string) const;
+    static int suffixLabels(const QStringList &parts, const QStringList &secondLevelDomains);
     bool matchingDomain(const QNetworkCookie &cookie, const QUrl &url) const;
-    QString urlPath(const QUrl &url) const;
-    bool matchingPath(const QNetworkCookie &cookie, const QString &urlPath) const;
+    static QString urlPath(const QUrl &url);
+    static bool matchingPath(const QNetworkCookie &cookie, const QString &urlPath);
 };
 
 #endif
@@ -0,0 +1,223 @@
+/*
+   Copyright (C) 2009, Arora Developers. All rights reserved.
+*/
+
+/* ***** BEGIN LICENSE BLOCK *****
+ * Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ *
+ * The contents of this file are subject to the Mozilla Public License Version
+ * 1.1 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+ * for the specific language governing rights and limitations under the
+ * License.
+ *
+ * Alternatively, the contents of this file may be used under the terms of
+ * either the GNU General Public License Version 2 or later (the "GPL"), or
+ * the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+ * in which case the provisions of the GPL or the LGPL are applicable instead
+ * of those above. If you wish to allow use of your version of this file only
+ * under the terms of either the GPL or the LGPL, and not to allow others to
+ * use your version of this file under the terms of the MPL, indicate your
+ * decision by deleting the provisions above and replace them with the notice
+ * and other provisions required by the GPL or the LGPL. If you do not delete
+ * the provisions above, a recipient may use your version of this file under
+ * the terms of any one of the MPL, the GPL or the LGPL.
+ *
+ * ***** END LICENSE BLOCK ***** */
+
+
+#include "networkcookiestore_p.h"
+
+#include <qdatetime.h>
+
+#include <string.h>
+
+// Don't bother compacting an arena with less than this unused
+static const int MINIMUM_UNUSED_BYTES = 64 * 1024;
+
+NetworkCookieStore::NetworkCookieStore()
+    : m_unusedBytes(0)
+{
+}
+
+void NetworkCookieStore::clear()
+{
+    m_records.clear();
+    m_freeRecords.clear();
+    m_arena.clear();
+    m_unusedBytes = 0;
+    m_strings.clear();
+    m_stringRefs.clear();
+    m_freeStrings.clear();
+    m_stringIds.clear();
+}
+
+/*
+    Dates before 1970 are stored as the epoch, they have expired either way.
+*/
+qint64 NetworkCookieStore::toMSecs(const QDateTime &dateTime)
+{
+    QDate date = dateTime.date();
+    if (date.year() < 1970)
+        return 0;
+    if (date.year() > 2105)
+        return Q_INT64_C(0xfffffffe) * 1000;
+    return qint64(dateTime.toTime_t()) * 1000 + dateTime.time().msec();
+}
+
+int NetworkCookieStore::insert(const QNetworkCookie &cookie)
+{
+    QByteArray name = cookie.name();
+    QByteArray value = cookie.value();
+
+    NetworkCookieRecord record;
+    record.data = m_arena.size();
+    record.nameLength = name.size();
+    record.valueLength = value.size();
+    m_arena.append(name);
+    m_arena.append(value);
+    record.domain = intern(cookie.domain());
+    record.path = intern(cookie.path());
+    record.flags = NetworkCookieRecord::Live;
+    if (cookie.isSessionCookie())
+        record.flags |= NetworkCookieRecord::Session;
+    if (cookie.isSecure())
+        record.flags |= NetworkCookieRecord::Secure;
+#if QT_VERSION >= 0x040500
+    if (cookie.isHttpOnly())
+        record.flags |= NetworkCookieRecord::HttpOnly;
+#endif
+    record.expires = cookie.isSessionCookie() ? 0 : toMSecs(cookie.expirationDate());
+
+    if (m_freeRecords.isEmpty()) {
+        m_records.append(record);
+        return m_records.count() - 1;
+    }
+    int id = m_freeRecords.last();
+    m_freeRecords.pop_back();
+    m_records[id] = record;
+    return id;
+}
+
+void NetworkCookieStore::remove(int id)
+{
+    if (!isLive(id))
+        return;
+    NetworkCookieRecord &record = m_records[id];
+    m_unusedBytes += record.nameLength + record.valueLength;
+    release(record.domain);
+    release(record.path);
+    record.flags = 0;
+    m_freeRecords.append(id);
+
+    if (m_freeRecords.count() == m_records.count()) {
+        clear();
+        return;
+    }
+    if (m_unusedBytes > MINIMUM_UNUSED_BYTES && m_unusedBytes > m_arena.size() / 2)
+        compactArena();
+}
+
+bool NetworkCookieStore::matches(int id, const QNetworkCookie &cookie) const
+{
+    const NetworkCookieRecord &r = m_records.at(id);
+    QByteArray name = cookie.name();
+    return int(r.nameLength) == name.size()
+        && memcmp(m_arena.constData() + r.data, name.constData(), name.size()) == 0
+        && path(id) == cookie.path()
+        && domain(id) == cookie.domain();
+}
+
+QNetworkCookie NetworkCookieStore::cookie(int id) const
+{
+    const NetworkCookieRecord &r = m_records.at(id);
+    const char *data = m_arena.constData() + r.data;
+    QNetworkCookie cookie(QByteArray(data, r.nameLength),
+                          QByteArray(data + r.nameLength, r.valueLength));
+    cookie.setDomain(m_strings.at(r.domain));
+    cookie.setPath(m_strings.at(r.path));
+    cookie.setSecure(r.flags & NetworkCookieRecord::Secure);
+#if QT_VERSION >= 0x040500
+    cookie.setHttpOnly(r.flags & NetworkCookieRecord::HttpOnly);
+#endif
+    if (!(r.flags & NetworkCookieRecord::Session)) {
+        QDateTime expires = QDateTime::fromTime_t(uint(r.expires / 1000)).toUTC();
+        cookie.setExpirationDate(expires.addMSecs(r.expires % 1000));
+    }
+    return cookie;
+}
+
+QList<QNetworkCookie> NetworkCookieStore::cookies(const QList<int> &ids) const
+{
+    QList<QNetworkCookie> cookies;
+    cookies.reserve(ids.count());
+    foreach (int id, ids)
+        cookies.append(cookie(id));
+    return cookies;
+}
+
+int NetworkCookieStore::memoryUsage() const
+{
+    int bytes = sizeof(NetworkCookieStore);
+    bytes += m_records.capacity() * sizeof(NetworkCookieRecord);
+    bytes += m_freeRecords.capacity() * sizeof(int);
+    bytes += m_arena.capacity();
+    bytes += m_strings.capacity() * (sizeof(QString) + sizeof(int));
+    foreach (const QString &string, m_strings)
+        bytes += string.capacity() * sizeof(QChar);
+    // A hash node is the key, the value and a next pointer and hash
+    bytes += m_stringIds.count() * (sizeof(QString) + sizeof(int) + sizeof(void*) + sizeof(uint));
+    bytes += m_stringIds.capacity() * sizeof(void*);
+    return bytes;
+}
+
+int NetworkCookieStore::intern(const QString &string)
+{
+    QHash<QString, int>::const_iterator it = m_stringIds.constFind(string);
+    if (it != m_stringIds.constEnd()) {
+        ++m_stringRefs[it.value()];
+        return it.value();
+    }
+    int id;
+    if (m_freeStrings.isEmpty()) {
+        id = m_strings.count();
+        m_strings.append(string);
+        m_stringRefs.append(1);
+    } else {
+        id = m_freeStrings.last();
+        m_freeStrings.pop_back();
+        m_strings[id] = string;
+        m_stringRefs[id] = 1;
+    }
+    m_stringIds.insert(string, id);
+    return id;
+}
+
+void NetworkCookieStore::release(int string)
+{
+    if (--m_stringRefs[string] > 0)
+        return;
+    m_stringIds.remove(m_strings.at(string));
+    m_strings[string] = QString();
+    m_freeStrings.append(string);
+}
+
+void NetworkCookieStore::compactArena()
+{
+    QByteArray arena;
+    arena.reserve(m_arena.size() - m_unusedBytes);
+    for (int i = 0; i < m_records.count(); ++i) {
+        NetworkCookieRecord &r = m_records[i];
+        if (!(r.flags & NetworkCookieRecord::Live))
+            continue;
+        int offset = arena.size();
+        arena.append(m_arena.constData() + r.data, r.nameLength + r.valueLength);
+        r.data = offset;
+    }
+    m_arena = arena;
+    m_unusedBytes = 0;
+}
@@ -0,0 +1,124 @@
+/*
+   Copyright (C) 2009, Arora Developers. All rights reserved.
+*/
+
+/* ***** BEGIN LICENSE BLOCK *****
+ * Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ *
+ * The contents of this file are subject to the Mozilla Public License Version
+ * 1.1 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+ * for the specific language governing rights and limitations under the
+ * License.
+ *
+ * Alternatively, the contents of this file may be used under the terms of
+ * either the GNU General Public License Version 2 or later (the "GPL"), or
+ * the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+ * in which case the provisions of the GPL or the LGPL are applicable instead
+ * of those above. If you wish to allow use of your version of this file only
+ * under the terms of either the GPL or the LGPL, and not to allow others to
+ * use your version of this file under the terms of the MPL, indicate your
+ * decision by deleting the provisions above and replace them with the notice
+ * and other provisions required by the GPL or the LGPL. If you do not delete
+ * the provisions above, a recipient may use your version of this file under
+ * the terms of any one of the MPL, the GPL or the LGPL.
+ *
+ * ***** END LICENSE BLOCK ***** */
+
+
+#ifndef NETWORKCOOKIESTORE_P_H
+#define NETWORKCOOKIESTORE_P_H
+
+#include <qbytearray.h>
+#include <qhash.h>
+#include <qnetworkcookie.h>
+#include <qstring.h>
+#include <qvector.h>
+
+/*
+    A cookie packed into 32 bytes.  The name is followed by the value in
+    the byte arena of the store, the domain and path are ids of strings
+    interned by the store and the expiration date is in milliseconds since
+    the epoch.
+*/
+class NetworkCookieRecord {
+public:
+    enum Flag {
+        Live = 1,
+        Session = 2,
+        Secure = 4,
+        HttpOnly = 8
+    };
+
+    quint32 data;
+    quint32 nameLength;
+    quint32 valueLength;
+    quint32 domain;
+    quint32 path;
+    quint32 flags;
+    qint64 expires;
+};
+Q_DECLARE_TYPEINFO(NetworkCookieRecord, Q_PRIMITIVE_TYPE);
+
+/*
+    The cookies of a NetworkCookieJar by id.  Ids of removed cookies are
+    reused.  QNetworkCookie objects are only created for the cookies that
+    are handed out of the jar.
+
+    Interned strings are reference counted and the arena is compacted once
+    more than half of it belongs to removed cookies.  Like the containers
+    it is built on the store is implicitly shared, so copying it into a
+    snapshot is cheap and const access from several threads is safe.
+*/
+class NetworkCookieStore {
+public:
+    NetworkCookieStore();
+
+    void clear();
+    int insert(const QNetworkCookie &cookie);
+    void remove(int id);
+
+    inline int count() const { return m_records.count() - m_freeRecords.count(); }
+    inline bool isLive(int id) const
+        { return id >= 0 && id < m_records.count() && (m_records.at(id).flags & NetworkCookieRecord::Live); }
+    inline const NetworkCookieRecord &record(int id) const { return m_records.at(id); }
+
+    inline bool isSessionCookie(int id) const { return m_records.at(id).flags & NetworkCookieRecord::Session; }
+    inline bool isSecure(int id) const { return m_records.at(id).flags & NetworkCookieRecord::Secure; }
+    inline qint64 expires(int id) const { return m_records.at(id).expires; }
+    inline const QString &domain(int id) const { return m_strings.at(m_records.at(id).domain); }
+    inline const QString &path(int id) const { return m_strings.at(m_records.at(id).path); }
+
+    // Same domain, path and name
+    bool matches(int id, const QNetworkCookie &cookie) const;
+
+    QNetworkCookie cookie(int id) const;
+    QList<QNetworkCookie> cookies(const QList<int> &ids) const;
+
+    // Bytes held by the store, excluding what the containers keep for bookkeeping
+    int memoryUsage() const;
+
+    static qint64 toMSecs(const QDateTime &dateTime);
+
+private:
+    int intern(const QString &string);
+    void release(int string);
+    void compactArena();
+
+    QVector<NetworkCookieRecord> m_records;
+    QVector<int> m_freeRecords;
+
+    QByteArray m_arena;
+    int m_unusedBytes;
+
+    QVector<QString> m_strings;
+    QVector<int> m_stringRefs;
+    QVector<int> m_freeStrings;
+    QHash<QString, int> m_stringIds;
+};
+
+#endif // NETWORKCOOKIESTORE_P_H
@@ -0,0 +1,215 @@
+/*
+   Copyright (C) 2009, Arora Developers. All rights reserved.
+*/
+
+/* ***** BEGIN LICENSE BLOCK *****
+ * Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ *
+ * The contents of this file are subject to the Mozilla Public License Version
+ * 1.1 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+ * for the specific language governing rights and limitations under the
+ * License.
+ *
+ * Alternatively, the contents of this file may be used under the terms of
+ * either the GNU General Public License Version 2 or later (the "GPL"), or
+ * the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+ * in which case the provisions of the GPL or the LGPL are applicable instead
+ * of those above. If you wish to allow use of your version of this file only
+ * under the terms of either the GPL or the LGPL, and not to allow others to
+ * use your version of this file under the terms of the MPL, indicate your
+ * decision by deleting the provisions above and replace them with the notice
+ * and other provisions required by the GPL or the LGPL. If you do not delete
+ * the provisions above, a recipient may use your version of this file under
+ * the terms of any one of the MPL, the GPL or the LGPL.
+ *
+ * ***** END LICENSE BLOCK ***** */
+
+#include "publicsuffix.h"
+
+#include <qurl.h>
+
+struct PublicSuffixRule {
+    const char *domain;
+    int flags;
+};
+
+enum PublicSuffixFlags {
+    PublicSuffixRuleFlag = 1,
+    WildcardRuleFlag = 2,
+    ExceptionRuleFlag = 4
+};
+
+#include "publicsuffixlist_p.h"
+
+static const int publicSuffixRuleCount = sizeof(publicSuffixRules) / sizeof(publicSuffixRules[0]);
+
+// Compares a rule with the \a length characters at \a domain like strcmp
+static int compareRule(const char *rule, const QChar *domain, int length)
+{
+    int i = 0;
+    for (; i < length && rule[i]; ++i) {
+        int difference = int(uchar(rule[i])) - int(domain[i].unicode());
+        if (difference != 0)
+            return difference;
+    }
+    if (rule[i])
+        return 1;
+    return i < length ? -1 : 0;
+}
+
+// The flags of the rule for the \a length characters at \a domain
+static int ruleFlags(const QChar *domain, int length)
+{
+    int begin = 0;
+    int end = publicSuffixRuleCount;
+    while (begin < end) {
+        int middle = (begin + end) / 2;
+        int comparison = compareRule(publicSuffixRules[middle].domain, domain, length);
+        if (comparison == 0)
+            return publicSuffixRules[middle].flags;
+        if (comparison < 0)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return 0;
+}
+
+// Compares a rule with the \a labels from \a first on joined by dots like strcmp
+static int compareRule(const char *rule, const QStringList &labels, int first)
+{
+    int r = 0;
+    for (int i = first; i < labels.count(); ++i) {
+        if (i > first) {
+            if (!rule[r])
+                return -1;
+            int difference = int(uchar(rule[r])) - int('.');
+            if (difference != 0)
+                return difference;
+            ++r;
+        }
+        const QString &label = labels.at(i);
+        const QChar *data = label.constData();
+        for (int j = 0; j < label.length(); ++j, ++r) {
+            if (!rule[r])
+                return -1;
+            int difference = int(uchar(rule[r])) - int(data[j].unicode());
+            if (difference != 0)
+                return difference;
+        }
+    }
+    return rule[r] ? 1 : 0;
+}
+
+// The flags of the rule for the \a labels from \a first on
+static int ruleFlags(const QStringList &labels, int first)
+{
+    int begin = 0;
+    int end = publicSuffixRuleCount;
+    while (begin < end) {
+        int middle = (begin + end) / 2;
+        int comparison = compareRule(publicSuffixRules[middle].domain, labels, first);
+        if (comparison == 0)
+            return publicSuffixRules[middle].flags;
+        if (comparison < 0)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return 0;
+}
+
+/*
+    Tries the suffixes of the domain from the longest one down, so the
+    first rule that matches is the one that applies.  When none does the
+    last label is the public suffix.
+  */
+int PublicSuffix::suffixLabels(const QString &domain)
+{
+    const int length = domain.length();
+    if (length == 0)
+        return 0;
+
+    const QChar *data = domain.constData();
+    int labels = 1;
+    for (int i = 0; i < length; ++i) {
+        ushort c = data[i].unicode();
+        if (c == '.')
+            ++labels;
+        else if (c > 0x7f)
+            return suffixLabels(QString::fromLatin1(QUrl::toAce(domain)));
+    }
+
+    int start = 0;
+    int flags = ruleFlags(data, length);
+    while (true) {
+        if (flags & ExceptionRuleFlag)
+            return labels - 1;
+        if (flags & PublicSuffixRuleFlag)
+            return labels;
+        int dot = domain.indexOf(QLatin1Char('.'), start);
+        if (dot == -1)
+            return 1;
+        int parentFlags = ruleFlags(data + dot + 1, length - dot - 1);
+        if (parentFlags & WildcardRuleFlag)
+            return labels;
+        flags = parentFlags;
+        start = dot + 1;
+        --labels;
+    }
+}
+
+int PublicSuffix::suffixLabels(const QStringList &labels)
+{
+    const int count = labels.count();
+    if (count == 0)
+        return 0;
+
+    for (int i = 0; i < count; ++i) {
+        const QString &label = labels.at(i);
+        const QChar *data = label.constData();
+        for (int j = 0; j < label.length(); ++j) {
+            if (data[j].unicode() > 0x7f)
+                return suffixLabels(labels.join(QLatin1String(".")));
+        }
+    }
+
+    int first = 0;
+    int flags = ruleFlags(labels, first);
+    while (true) {
+        if (flags & ExceptionRuleFlag)
+            return count - first - 1;
+        if (flags & PublicSuffixRuleFlag)
+            return count - first;
+        if (first + 1 == count)
+            return 1;
+        int parentFlags = ruleFlags(labels, first + 1);
+        if (parentFlags & WildcardRuleFlag)
+            return count - first;
+        flags = parentFlags;
+        ++first;
+    }
+}
+
+bool PublicSuffix::isPublicSuffix(const QString &domain)
+{
+    return !domain.isEmpty() && suffixLabels(domain) == domain.count(QLatin1Char('.')) + 1;
+}
+
+QString PublicSuffix::registrableDomain(const QString &domain)
+{
+    int labels = suffixLabels(domain) + 1;
+    int start = domain.length();
+    while (labels > 0 && start > 0) {
+        start = domain.lastIndexOf(QLatin1Char('.'), start - 1);
+        if (start == -1)
+            return labels == 1 ? domain : QString();
+        --labels;
+    }
+    return labels == 0 ? domain.mid(start + 1) : QString();
+}
@@ -1,5 +1,5 @@
 /*
-   Copyright (C) 2009, Torch Mobile Inc. and Linden Research, Inc. All rights reserved.
+   Copyright (C) 2009, Arora Developers. All rights reserved.
 */
 
 /* ***** BEGIN LICENSE BLOCK *****
@@ -15,11 +15,6 @@
  * for the specific language governing rights and limitations under the
  * License.
  *
- * The Original Code is Torch Mobile Inc. (http://www.torchmobile.com/) code
- *
- * The Initial Developer of the Original Code is:
- *   Benjamin Meyer (benjamin.meyer@torchmobile.com)
- *
  * Alternatively, the contents of this file may be used under the terms of
  * either the GNU General Public License Version 2 or later (the "GPL"), or
  * the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
@@ -34,70 +29,34 @@
  *
  * ***** END LICENSE BLOCK ***** */
 
-// Updated from https://wiki.mozilla.org/TLD_List#External_Links
-// To set a custom list use NetworkCookieJar::setSecondLevelDomains()
-static const char *const twoLevelDomains[] = {
-    "ao",
-    "ar",
-    "arpa",
-    "bd",
-    "bn",
-    "br",
-    "co",
-    "cr",
-    "cy",
-    "do",
-    "eg",
-    "et",
-    "fj",
-    "fk",
-    "gh",
-    "gn",
-    "gu",
-    "id",
-    "il",
-    "jm",
-    "ke",
-    "kh",
-    "ki",
-    "kw",
-    "kz",
-    "lb",
-    "lc",
-    "lr",
-    "ls",
-    "ml",
-    "mm",
-    "mv",
-    "mw",
-    "mx",
-    "my",
-    "ng",
-    "ni",
-    "np",
-    "nz",
-    "om",
-    "pa",
-    "pe",
-    "pg",
-    "pw",
-    "py",
-    "qa",
-    "sa",
-    "sb",
-    "sv",
-    "sy",
-    "th",
-    "tn",
-    "tz",
-    "uk",
-    "uy",
-    "va",
-    "ve",
-    "ye",
-    "yu",
-    "za",
-    "zm",
-    "zw",
-    0
+#ifndef PUBLICSUFFIX_H
+#define PUBLICSUFFIX_H
+
+#include <qstring.h>
+#include <qstringlist.h>
+
+/*
+    Answers which part of a domain is a public suffix, a domain such as
+    "com" or "co.uk" under which anyone can register a name, using the
+    Public Suffix List compiled into publicsuffixlist_p.h.
+
+    Domains are expected to be lower case without leading or trailing dots.
+    Lookups do not allocate unless the domain has non ascii characters.
+*/
+class PublicSuffix
+{
+public:
+    // The number of labels at the end of \a domain that are its public suffix
+    static int suffixLabels(const QString &domain);
+    // The same for a domain that is already split into its \a labels
+    static int suffixLabels(const QStringList &labels);
+
+    static bool isPublicSuffix(const QString &domain);
+
+    // The public suffix of \a domain and the label in front of it, empty
+    // when \a domain is a public suffix
+    static QString registrableDomain(const QString &domain);
 };
+
+#endif // PUBLICSUFFIX_H
+
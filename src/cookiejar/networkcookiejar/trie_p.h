@@ -39,7 +39,10 @@
 
 //#define TRIE_DEBUG
 
+#include <qhash.h>
+#include <qmap.h>
 #include <qstringlist.h>
+#include <qvector.h>
 
 #if defined(TRIE_DEBUG)
 #include <qdebug.h>
@@ -251,5 +254,410 @@ Trie<T>* Trie<T>::walkTo(const QStringList &key, bool create) {
     return node;
 }
 
+/*
+    A Trie with the same interface and stream format as Trie, laid out
+    flat so that a lookup touches a few contiguous arrays instead of
+    chasing a heap allocated node per level.
+
+    Labels are interned and compared by id.  Nodes live in one vector and
+    the children of a node are a contiguous range of the edge vectors
+    (compressed sparse row style) sorted by label id, so finding a child
+    is a binary search over integers.  A range that is full is moved to
+    the end of the edge vectors with room to grow and the edge vectors are
+    compacted once more than half of them are unused.  The values of each
+    node are kept in a pool of value lists and removed nodes and value
+    lists are reused.
+
+    Interned labels are only dropped by clear().
+*/
+template<class T>
+class FlatTrie {
+public:
+    FlatTrie();
+
+    void clear();
+    void insert(const QStringList &key, const T &value);
+    bool remove(const QStringList &key, const T &value);
+    QList<T> find(const QStringList &key) const;
+    QList<T> all() const;
+
+    inline bool contains(const QStringList &key) const { return walkTo(key) != -1; }
+    inline bool isEmpty() const
+        { return m_nodes.at(0).childCount == 0 && m_nodes.at(0).values == -1; }
+
+    // Bytes held by the trie, excluding what the containers keep for bookkeeping
+    int memoryUsage() const;
+
+private:
+    struct Node {
+        Node() : label(-1), parent(-1), firstChild(0), childCount(0), childCapacity(0), values(-1) {}
+        int label;
+        int parent;
+        int firstChild;
+        int childCount;
+        int childCapacity;
+        int values;
+    };
+
+    int walkTo(const QStringList &key) const;
+    int walkTo(const QStringList &key, bool create);
+    int childEdge(int node, int label) const;
+    int addChild(int node, int label);
+    void removeChild(int node, int child);
+    void compactEdges();
+    int internLabel(const QString &label);
+    QList<int> sortedChildren(int node) const;
+    void appendAll(int node, QList<T> &all) const;
+    void write(QDataStream &out, int node) const;
+    void read(QDataStream &in, int node);
+
+    template<class T1> friend QDataStream &operator<<(QDataStream &, const FlatTrie<T1>&);
+    template<class T1> friend QDataStream &operator>>(QDataStream &, FlatTrie<T1>&);
+
+    // Node 0 is the root
+    QVector<Node> m_nodes;
+    QVector<int> m_freeNodes;
+
+    // The child ranges, m_edgeLabels is what is searched
+    QVector<int> m_edgeLabels;
+    QVector<int> m_edgeNodes;
+    int m_unusedEdges;
+
+    QVector<QList<T> > m_values;
+    QVector<int> m_freeValues;
+
+    QHash<QString, int> m_labelIds;
+    QStringList m_labels;
+};
+
+template<class T>
+FlatTrie<T>::FlatTrie()
+    : m_nodes(1)
+    , m_unusedEdges(0)
+{
+}
+
+template<class T>
+void FlatTrie<T>::clear() {
+#if defined(TRIE_DEBUG)
+    qDebug() << "FlatTrie::" << __FUNCTION__;
+#endif
+    m_nodes.clear();
+    m_nodes.append(Node());
+    m_freeNodes.clear();
+    m_edgeLabels.clear();
+    m_edgeNodes.clear();
+    m_unusedEdges = 0;
+    m_values.clear();
+    m_freeValues.clear();
+    m_labelIds.clear();
+    m_labels.clear();
+}
+
+template<class T>
+void FlatTrie<T>::insert(const QStringList &key, const T &value) {
+#if defined(TRIE_DEBUG)
+    qDebug() << "FlatTrie::" << __FUNCTION__ << key << value;
+#endif
+    int node = walkTo(key, true);
+    int slot = m_nodes.at(node).values;
+    if (slot == -1) {
+        if (m_freeValues.isEmpty()) {
+            slot = m_values.count();
+            m_values.append(QList<T>());
+        } else {
+            slot = m_freeValues.last();
+            m_freeValues.pop_back();
+        }
+        m_nodes[node].values = slot;
+    }
+    m_values[slot].append(value);
+}
+
+template<class T>
+bool FlatTrie<T>::remove(const QStringList &key, const T &value) {
+#if defined(TRIE_DEBUG)
+    qDebug() << "FlatTrie::" << __FUNCTION__ << key << value;
+#endif
+    int node = walkTo(key);
+    if (node == -1)
+        return false;
+    int slot = m_nodes.at(node).values;
+    if (slot == -1 || !m_values[slot].removeOne(value))
+        return false;
+
+    if (m_values.at(slot).isEmpty()) {
+        m_freeValues.append(slot);
+        m_nodes[node].values = -1;
+    }
+
+    // Remove the nodes that are left without values or children
+    while (node != 0
+           && m_nodes.at(node).values == -1
+           && m_nodes.at(node).childCount == 0) {
+        int parent = m_nodes.at(node).parent;
+        removeChild(parent, node);
+        node = parent;
+    }
+    return true;
+}
+
+template<class T>
+QList<T> FlatTrie<T>::find(const QStringList &key) const {
+#if defined(TRIE_DEBUG)
+    qDebug() << "FlatTrie::" << __FUNCTION__ << key;
+#endif
+    int node = walkTo(key);
+    if (node == -1 || m_nodes.at(node).values == -1)
+        return QList<T>();
+    return m_values.at(m_nodes.at(node).values);
+}
+
+// In the same order as Trie::all()
+template<class T>
+QList<T> FlatTrie<T>::all() const {
+#if defined(TRIE_DEBUG)
+    qDebug() << "FlatTrie::" << __FUNCTION__;
+#endif
+    QList<T> all;
+    appendAll(0, all);
+    return all;
+}
+
+// Written in the format of Trie so either can read what the other wrote
+template<class T>
+QDataStream &operator<<(QDataStream &out, const FlatTrie<T> &trie) {
+    trie.write(out, 0);
+    return out;
+}
+
+template<class T>
+QDataStream &operator>>(QDataStream &in, FlatTrie<T> &trie) {
+    trie.clear();
+    trie.read(in, 0);
+    return in;
+}
+
+template<class T>
+int FlatTrie<T>::walkTo(const QStringList &key) const {
+    int node = 0;
+    int depth = key.count() - 1;
+    while (depth >= 0) {
+        QHash<QString, int>::const_iterator label = m_labelIds.constFind(key.at(depth--));
+        if (label == m_labelIds.constEnd())
+            return -1;
+        int edge = childEdge(node, label.value());
+        if (edge == -1)
+            return -1;
+        node = m_edgeNodes.at(edge);
+    }
+    return node;
+}
+
+template<class T>
+int FlatTrie<T>::walkTo(const QStringList &key, bool create) {
+    int node = 0;
+    int depth = key.count() - 1;
+    while (depth >= 0) {
+        int label = internLabel(key.at(depth--));
+        int edge = childEdge(node, label);
+        if (edge != -1) {
+            node = m_edgeNodes.at(edge);
+            continue;
+        }
+        if (!create)
+            return -1;
+        node = addChild(node, label);
+    }
+    return node;
+}
+
+template<class T>
+int FlatTrie<T>::childEdge(int node, int label) const {
+    const Node &n = m_nodes.at(node);
+    const int *begin = m_edgeLabels.constData() + n.firstChild;
+    const int *end = begin + n.childCount;
+    const int *edge = qBinaryFind(begin, end, label);
+    if (edge == end)
+        return -1;
+    return n.firstChild + (edge - begin);
+}
+
+template<class T>
+int FlatTrie<T>::addChild(int node, int label) {
+    int child;
+    if (m_freeNodes.isEmpty()) {
+        child = m_nodes.count();
+        m_nodes.append(Node());
+    } else {
+        child = m_freeNodes.last();
+        m_freeNodes.pop_back();
+        m_nodes[child] = Node();
+    }
+    m_nodes[child].label = label;
+    m_nodes[child].parent = node;
+
+    // Move a full range to the end with room to grow
+    if (m_nodes.at(node).childCount == m_nodes.at(node).childCapacity) {
+        Node &n = m_nodes[node];
+        int capacity = qMax(2, n.childCapacity * 2);
+        int first = m_edgeLabels.count();
+        m_edgeLabels.resize(first + capacity);
+        m_edgeNodes.resize(first + capacity);
+        for (int i = 0; i < n.childCount; ++i) {
+            m_edgeLabels[first + i] = m_edgeLabels.at(n.firstChild + i);
+            m_edgeNodes[first + i] = m_edgeNodes.at(n.firstChild + i);
+        }
+        m_unusedEdges += n.childCapacity;
+        n.firstChild = first;
+        n.childCapacity = capacity;
+        if (m_unusedEdges > 1024 && m_unusedEdges > m_edgeLabels.count() / 2)
+            compactEdges();
+    }
+
+    Node &n = m_nodes[node];
+    int *begin = m_edgeLabels.data() + n.firstChild;
+    int position = qLowerBound(begin, begin + n.childCount, label) - begin;
+    for (int i = n.childCount; i > position; --i) {
+        m_edgeLabels[n.firstChild + i] = m_edgeLabels.at(n.firstChild + i - 1);
+        m_edgeNodes[n.firstChild + i] = m_edgeNodes.at(n.firstChild + i - 1);
+    }
+    m_edgeLabels[n.firstChild + position] = label;
+    m_edgeNodes[n.firstChild + position] = child;
+    ++n.childCount;
+    return child;
+}
+
+template<class T>
+void FlatTrie<T>::removeChild(int node, int child) {
+    Node &n = m_nodes[node];
+    int edge = childEdge(node, m_nodes.at(child).label);
+    Q_ASSERT(edge != -1 && m_edgeNodes.at(edge) == child);
+    int last = n.firstChild + n.childCount - 1;
+    for (int i = edge; i < last; ++i) {
+        m_edgeLabels[i] = m_edgeLabels.at(i + 1);
+        m_edgeNodes[i] = m_edgeNodes.at(i + 1);
+    }
+    --n.childCount;
+
+    Node &c = m_nodes[child];
+    m_unusedEdges += c.childCapacity;
+    c = Node();
+    m_freeNodes.append(child);
+}
+
+template<class T>
+void FlatTrie<T>::compactEdges() {
+    QVector<int> labels;
+    QVector<int> nodes;
+    labels.reserve(m_edgeLabels.count() - m_unusedEdges);
+    nodes.reserve(labels.capacity());
+    for (int i = 0; i < m_nodes.count(); ++i) {
+        Node &n = m_nodes[i];
+        int first = labels.count();
+        for (int j = 0; j < n.childCapacity; ++j) {
+            labels.append(j < n.childCount ? m_edgeLabels.at(n.firstChild + j) : -1);
+            nodes.append(j < n.childCount ? m_edgeNodes.at(n.firstChild + j) : -1);
+        }
+        n.firstChild = first;
+    }
+    m_edgeLabels = labels;
+    m_edgeNodes = nodes;
+    m_unusedEdges = 0;
+}
+
+template<class T>
+int FlatTrie<T>::internLabel(const QString &label) {
+    QHash<QString, int>::const_iterator it = m_labelIds.constFind(label);
+    if (it != m_labelIds.constEnd())
+        return it.value();
+    int id = m_labels.count();
+    m_labels.append(label);
+    m_labelIds.insert(label, id);
+    return id;
+}
+
+template<class T>
+int FlatTrie<T>::memoryUsage() const {
+    int bytes = sizeof(FlatTrie<T>);
+    bytes += m_nodes.capacity() * sizeof(Node);
+    bytes += (m_freeNodes.capacity() + m_edgeLabels.capacity()
+              + m_edgeNodes.capacity() + m_freeValues.capacity()) * sizeof(int);
+    bytes += m_values.capacity() * sizeof(QList<T>);
+    // A QList holds a pointer to a copy of each value that doesn't fit in one
+    int valueSize = sizeof(void*);
+    if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic)
+        valueSize += sizeof(T);
+    foreach (const QList<T> &values, m_values)
+        bytes += values.count() * valueSize;
+    // Each label is shared by the list and the hash
+    bytes += m_labels.count() * (2 * sizeof(QString) + sizeof(int) + sizeof(void*) + sizeof(uint));
+    foreach (const QString &label, m_labels)
+        bytes += label.capacity() * sizeof(QChar);
+    return bytes;
+}
+
+// The children of \a node ordered by their label like the children of a Trie
+template<class T>
+QList<int> FlatTrie<T>::sortedChildren(int node) const {
+    const Node &n = m_nodes.at(node);
+    QMap<QString, int> children;
+    for (int i = 0; i < n.childCount; ++i) {
+        int edge = n.firstChild + i;
+        children.insert(m_labels.at(m_edgeLabels.at(edge)), m_edgeNodes.at(edge));
+    }
+    return children.values();
+}
+
+template<class T>
+void FlatTrie<T>::appendAll(int node, QList<T> &all) const {
+    if (m_nodes.at(node).values != -1)
+        all += m_values.at(m_nodes.at(node).values);
+    foreach (int child, sortedChildren(node))
+        appendAll(child, all);
+}
+
+template<class T>
+void FlatTrie<T>::write(QDataStream &out, int node) const {
+    const Node &n = m_nodes.at(node);
+    out << (n.values == -1 ? QList<T>() : m_values.at(n.values));
+    QList<int> children = sortedChildren(node);
+    QStringList keys;
+    foreach (int child, children)
+        keys.append(m_labels.at(m_nodes.at(child).label));
+    out << keys;
+    out << quint32(children.count());
+    foreach (int child, children)
+        write(out, child);
+}
+
+template<class T>
+void FlatTrie<T>::read(QDataStream &in, int node) {
+    QList<T> values;
+    QStringList keys;
+    quint32 count;
+    in >> values;
+    in >> keys;
+    in >> count;
+    Q_ASSERT(int(count) == keys.count());
+    if (in.status() != QDataStream::Ok)
+        return;
+
+    if (!values.isEmpty()) {
+        if (m_nodes.at(node).values == -1) {
+            m_nodes[node].values = m_values.count();
+            m_values.append(values);
+        } else {
+            m_values[m_nodes.at(node).values] += values;
+        }
+    }
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        int label = internLabel(keys.value(i));
+        int edge = childEdge(node, label);
+        int child = edge == -1 ? addChild(node, label) : m_edgeNodes.at(edge);
+        read(in, child);
+    }
+}
+
 #endif
 
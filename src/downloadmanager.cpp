@@ -66,6 +66,7 @@
 #include "autosaver.h"
 #include "browserapplication.h"
 #include "networkaccessmanager.h"
+#include "requestscheduler.h"
 
 #include <math.h>
 
@@ -129,6 +130,7 @@ void DownloadItem::init()
     // attach to the m_reply
     m_url = m_reply->url();
     m_reply->setParent(this);
+    BrowserApplication::networkAccessManager()->requestScheduler()->detach(m_reply);
     connect(m_reply, SIGNAL(readyRead()), this, SLOT(downloadReadyRead()));
     connect(m_reply, SIGNAL(error(QNetworkReply::NetworkError)),
             this, SLOT(error(QNetworkReply::NetworkError)));
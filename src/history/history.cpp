@@ -65,6 +65,7 @@
 #include "autosaver.h"
 #include "browserapplication.h"
 #include "historymanager.h"
+#include "historysearchindex.h"
 
 #include <qbuffer.h>
 #include <qclipboard.h>
@@ -88,15 +89,24 @@
 HistoryModel::HistoryModel(HistoryManager *history, QObject *parent)
     : QAbstractTableModel(parent)
     , m_history(history)
+    , m_removingRow(false)
 {
     Q_ASSERT(m_history);
     connect(m_history, SIGNAL(historyReset()),
             this, SLOT(historyReset()));
+    connect(m_history, SIGNAL(entryAboutToBeRemoved(int)),
+            this, SLOT(entryAboutToBeRemoved(int)));
     connect(m_history, SIGNAL(entryRemoved(const HistoryEntry &)),
-            this, SLOT(historyReset()));
+            this, SLOT(entryRemoved()));
+    connect(m_history, SIGNAL(entriesAboutToBeRemoved(int, int)),
+            this, SLOT(entriesAboutToBeRemoved(int, int)));
+    connect(m_history, SIGNAL(entriesRemoved(int, const QList<HistoryEntry> &)),
+            this, SLOT(entryRemoved()));
 
     connect(m_history, SIGNAL(entryAdded(const HistoryEntry &)),
             this, SLOT(entryAdded()));
+    connect(m_history, SIGNAL(entriesLoaded(int, int)),
+            this, SLOT(entriesLoaded(int, int)));
     connect(m_history, SIGNAL(entryUpdated(int)),
             this, SLOT(entryUpdated(int)));
 }
@@ -112,6 +122,32 @@ void HistoryModel::entryAdded()
     endInsertRows();
 }
 
+void HistoryModel::entriesLoaded(int offset, int count)
+{
+    beginInsertRows(QModelIndex(), offset, offset + count - 1);
+    endInsertRows();
+}
+
+void HistoryModel::entryAboutToBeRemoved(int offset)
+{
+    beginRemoveRows(QModelIndex(), offset, offset);
+    m_removingRow = true;
+}
+
+void HistoryModel::entriesAboutToBeRemoved(int offset, int count)
+{
+    beginRemoveRows(QModelIndex(), offset, offset + count - 1);
+    m_removingRow = true;
+}
+
+void HistoryModel::entryRemoved()
+{
+    if (!m_removingRow)
+        return;
+    m_removingRow = false;
+    endRemoveRows();
+}
+
 void HistoryModel::entryUpdated(int offset)
 {
     QModelIndex idx = index(offset, 0);
@@ -177,20 +213,138 @@ int HistoryModel::rowCount(const QModelIndex &parent) const
 
 bool HistoryModel::removeRows(int row, int count, const QModelIndex &parent)
 {
-    if (parent.isValid())
+    if (parent.isValid() || row < 0 || count <= 0 || row + count > rowCount())
         return false;
-    int lastRow = row + count - 1;
-    beginRemoveRows(parent, row, lastRow);
-    QList<HistoryEntry> lst = m_history->history();
-    for (int i = lastRow; i >= row; --i)
-        lst.removeAt(i);
-    disconnect(m_history, SIGNAL(historyReset()), this, SLOT(historyReset()));
-    m_history->setHistory(lst);
-    connect(m_history, SIGNAL(historyReset()), this, SLOT(historyReset()));
-    endRemoveRows();
+    // The rows go away when the manager says they were removed
+    m_history->removeHistoryEntries(row, count);
     return true;
 }
 
+HistoryUrlModel::HistoryUrlModel(HistoryManager *history, QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_history(history)
+    , m_removingRow(false)
+{
+    Q_ASSERT(m_history);
+    connect(m_history, SIGNAL(urlEntriesReset()),
+            this, SLOT(urlEntriesReset()));
+    connect(m_history, SIGNAL(urlEntryAdded(int)),
+            this, SLOT(urlEntryAdded(int)));
+    connect(m_history, SIGNAL(urlEntriesAdded(int, int)),
+            this, SLOT(urlEntriesAdded(int, int)));
+    connect(m_history, SIGNAL(urlEntryAboutToBeRemoved(int)),
+            this, SLOT(urlEntryAboutToBeRemoved(int)));
+    connect(m_history, SIGNAL(urlEntryRemoved(int)),
+            this, SLOT(urlEntryRemoved()));
+    connect(m_history, SIGNAL(urlEntryUpdated(int)),
+            this, SLOT(urlEntryUpdated(int)));
+}
+
+void HistoryUrlModel::urlEntriesReset()
+{
+    reset();
+}
+
+void HistoryUrlModel::urlEntryAdded(int row)
+{
+    beginInsertRows(QModelIndex(), row, row);
+    endInsertRows();
+}
+
+void HistoryUrlModel::urlEntriesAdded(int row, int count)
+{
+    beginInsertRows(QModelIndex(), row, row + count - 1);
+    endInsertRows();
+}
+
+void HistoryUrlModel::urlEntryAboutToBeRemoved(int row)
+{
+    beginRemoveRows(QModelIndex(), row, row);
+    m_removingRow = true;
+}
+
+void HistoryUrlModel::urlEntryRemoved()
+{
+    if (!m_removingRow)
+        return;
+    m_removingRow = false;
+    endRemoveRows();
+}
+
+void HistoryUrlModel::urlEntryUpdated(int row)
+{
+    emit dataChanged(index(row, 0), index(row, columnCount() - 1));
+}
+
+QVariant HistoryUrlModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal
+        && role == Qt::DisplayRole) {
+        switch (section) {
+        case 0: return tr("Title");
+        case 1: return tr("Address");
+        case 2: return tr("Visits");
+        case 3: return tr("Last Visited");
+        }
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+QVariant HistoryUrlModel::data(const QModelIndex &index, int role) const
+{
+    if (index.row() < 0 || index.row() >= m_history->urlEntryCount())
+        return QVariant();
+
+    HistoryUrlEntry entry = m_history->urlEntryAt(index.row());
+    switch (role) {
+    case VisitCountRole:
+        return entry.visitCount;
+    case TypedCountRole:
+        return entry.typedCount;
+    case FirstVisitRole:
+        return entry.firstVisit;
+    case LastVisitRole:
+    case HistoryModel::DateTimeRole:
+        return entry.lastVisit;
+    case HistoryModel::DateRole:
+        return entry.lastVisit.date();
+    case HistoryModel::UrlRole:
+        return QUrl(entry.url);
+    case HistoryModel::UrlStringRole:
+        return entry.url;
+    case HistoryModel::TitleRole:
+        return HistoryEntry(entry.url, entry.lastVisit, entry.title).userTitle();
+    case Qt::DisplayRole:
+    case Qt::EditRole: {
+        switch (index.column()) {
+        case 0:
+            return HistoryEntry(entry.url, entry.lastVisit, entry.title).userTitle();
+        case 1:
+            return entry.url;
+        case 2:
+            return entry.visitCount;
+        case 3:
+            return entry.lastVisit;
+        }
+        break;
+    }
+    case Qt::DecorationRole:
+        if (index.column() == 0)
+            return BrowserApplication::instance()->icon(entry.url);
+    }
+    return QVariant();
+}
+
+int HistoryUrlModel::columnCount(const QModelIndex &parent) const
+{
+    return (parent.isValid()) ? 0 : 4;
+}
+
+int HistoryUrlModel::rowCount(const QModelIndex &parent) const
+{
+    return (parent.isValid()) ? 0 : m_history->urlEntryCount();
+}
+
 #define MOVEDROWS 15
 
 /*
@@ -410,6 +564,364 @@ bool TreeProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_
     return QSortFilterProxyModel::filterAcceptsRow(source_row, source_parent);
 }
 
+HistoryProxyModel::HistoryProxyModel(HistoryManager *history, QObject *parent)
+    : QAbstractProxyModel(parent)
+    , m_history(history)
+    , m_searchIndex(new HistorySearchIndex(history, this))
+    , m_removingDate(-1)
+    , m_removingFirst(0)
+    , m_removingLast(0)
+    , m_removingRows(false)
+{
+}
+
+HistorySearchIndex *HistoryProxyModel::searchIndex() const
+{
+    return m_searchIndex;
+}
+
+void HistoryProxyModel::setSourceModel(QAbstractItemModel *newSourceModel)
+{
+    if (sourceModel()) {
+        disconnect(sourceModel(), SIGNAL(modelReset()), this, SLOT(sourceReset()));
+        disconnect(sourceModel(), SIGNAL(layoutChanged()), this, SLOT(sourceReset()));
+        disconnect(sourceModel(), SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &)),
+                   this, SLOT(sourceDataChanged(const QModelIndex &, const QModelIndex &)));
+        disconnect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
+                   this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        disconnect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                   this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
+        disconnect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
+                   this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
+    }
+
+    QAbstractProxyModel::setSourceModel(newSourceModel);
+
+    if (sourceModel()) {
+        connect(sourceModel(), SIGNAL(modelReset()), this, SLOT(sourceReset()));
+        connect(sourceModel(), SIGNAL(layoutChanged()), this, SLOT(sourceReset()));
+        connect(sourceModel(), SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &)),
+                this, SLOT(sourceDataChanged(const QModelIndex &, const QModelIndex &)));
+        connect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
+                this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        connect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
+        connect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
+                this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
+    }
+    sourceReset();
+}
+
+/*
+    Only the pages change, the pages that are still shown keep their
+    selection and the dates stay expanded.
+  */
+void HistoryProxyModel::setSearchText(const QString &text)
+{
+    if (text.toLower() == m_searchIndex->query())
+        return;
+    emit layoutAboutToBeChanged();
+    QModelIndexList oldIndexes = persistentIndexList();
+    QModelIndexList sourceIndexes;
+    foreach (const QModelIndex &idx, oldIndexes)
+        sourceIndexes.append(mapToSource(idx));
+
+    m_searchIndex->setQuery(text);
+    loadMatches();
+
+    QModelIndexList newIndexes;
+    foreach (const QModelIndex &idx, sourceIndexes)
+        newIndexes.append(mapFromSource(idx));
+    changePersistentIndexList(oldIndexes, newIndexes);
+    emit layoutChanged();
+}
+
+// Without a query every page is shown and the rows are the same as in the source
+bool HistoryProxyModel::filtering() const
+{
+    return !m_searchIndex->query().isEmpty();
+}
+
+/*
+    Looks the urls that match up in the history models to find their
+    pages, that is a few hash and tree lookups for each match instead of
+    checking every page.
+  */
+void HistoryProxyModel::loadMatches()
+{
+    m_pages.clear();
+    if (!sourceModel() || !filtering())
+        return;
+    int dates = sourceModel()->rowCount();
+    for (int i = 0; i < dates; ++i)
+        m_pages.append(QList<int>());
+
+    HistoryTreeModel *treeModel = qobject_cast<HistoryTreeModel*>(sourceModel());
+    HistoryFilterModel *filterModel = m_history->historyFilterModel();
+    if (!treeModel || treeModel->sourceModel() != filterModel) {
+        for (int i = 0; i < dates; ++i)
+            m_pages[i] = matchingPages(i);
+        return;
+    }
+
+    QAbstractItemModel *historyModel = filterModel->sourceModel();
+    foreach (const QString &url, m_searchIndex->matchingUrls()) {
+        if (!filterModel->historyContains(url))
+            continue;
+        QModelIndex idx = historyModel->index(filterModel->historyLocation(url), 0);
+        idx = treeModel->mapFromSource(filterModel->mapFromSource(idx));
+        if (idx.isValid() && idx.parent().row() < dates)
+            m_pages[idx.parent().row()].append(idx.row());
+    }
+    for (int i = 0; i < dates; ++i)
+        qSort(m_pages[i]);
+}
+
+QList<int> HistoryProxyModel::matchingPages(int date) const
+{
+    QList<int> pages;
+    QModelIndex parent = sourceModel()->index(date, 0);
+    int count = sourceModel()->rowCount(parent);
+    for (int i = 0; i < count; ++i) {
+        if (pageMatches(sourceModel()->index(i, 0, parent)))
+            pages.append(i);
+    }
+    return pages;
+}
+
+bool HistoryProxyModel::pageMatches(const QModelIndex &sourceIndex) const
+{
+    return m_searchIndex->matches(sourceIndex.data(HistoryModel::UrlStringRole).toString());
+}
+
+QModelIndex HistoryProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid())
+        return QModelIndex();
+    QModelIndex sourceParent = sourceIndex.parent();
+    if (!sourceParent.isValid())
+        return createIndex(sourceIndex.row(), sourceIndex.column(), 0);
+
+    int date = sourceParent.row();
+    int row = sourceIndex.row();
+    if (filtering()) {
+        if (date >= m_pages.count())
+            return QModelIndex();
+        const QList<int> &pages = m_pages.at(date);
+        QList<int>::const_iterator it = qBinaryFind(pages.constBegin(), pages.constEnd(), row);
+        if (it == pages.constEnd())
+            return QModelIndex();
+        row = it - pages.constBegin();
+    }
+    return createIndex(row, sourceIndex.column(), date + 1);
+}
+
+QModelIndex HistoryProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (!proxyIndex.isValid() || !sourceModel())
+        return QModelIndex();
+    int date = int(proxyIndex.internalId()) - 1;
+    if (date < 0)
+        return sourceModel()->index(proxyIndex.row(), proxyIndex.column());
+
+    int row = proxyIndex.row();
+    if (filtering()) {
+        if (date >= m_pages.count() || row >= m_pages.at(date).count())
+            return QModelIndex();
+        row = m_pages.at(date).at(row);
+    }
+    return sourceModel()->index(row, proxyIndex.column(), sourceModel()->index(date, 0));
+}
+
+int HistoryProxyModel::rowCount(const QModelIndex &parent) const
+{
+    if (!sourceModel() || parent.column() > 0)
+        return 0;
+    if (!parent.isValid())
+        return sourceModel()->rowCount();
+    if (parent.internalId() != 0)
+        return 0;
+    if (filtering())
+        return m_pages.value(parent.row()).count();
+    return sourceModel()->rowCount(mapToSource(parent));
+}
+
+int HistoryProxyModel::columnCount(const QModelIndex &parent) const
+{
+    if (!sourceModel())
+        return 0;
+    return sourceModel()->columnCount(mapToSource(parent));
+}
+
+QModelIndex HistoryProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (row < 0 || row >= rowCount(parent)
+        || column < 0 || column >= columnCount(parent))
+        return QModelIndex();
+    if (!parent.isValid())
+        return createIndex(row, column, 0);
+    return createIndex(row, column, parent.row() + 1);
+}
+
+QModelIndex HistoryProxyModel::parent(const QModelIndex &index) const
+{
+    int date = int(index.internalId()) - 1;
+    if (!index.isValid() || date < 0)
+        return QModelIndex();
+    return createIndex(date, 0, 0);
+}
+
+// Dates always have children, like in TreeProxyModel
+bool HistoryProxyModel::hasChildren(const QModelIndex &parent) const
+{
+    return !parent.isValid() || parent.internalId() == 0;
+}
+
+bool HistoryProxyModel::removeRows(int row, int count, const QModelIndex &parent)
+{
+    if (!sourceModel() || row < 0 || count <= 0 || row + count > rowCount(parent))
+        return false;
+    if (!parent.isValid() || !filtering())
+        return sourceModel()->removeRows(row, count, mapToSource(parent));
+
+    // The pages that are shown don't have to be next to each other in the source
+    QModelIndex sourceParent = mapToSource(parent);
+    for (int i = row + count - 1; i >= row; --i) {
+        int sourceRow = m_pages.at(parent.row()).at(i);
+        if (!sourceModel()->removeRows(sourceRow, 1, sourceParent))
+            return false;
+    }
+    return true;
+}
+
+void HistoryProxyModel::sourceReset()
+{
+    loadMatches();
+    reset();
+}
+
+void HistoryProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    QModelIndex sourceParent = topLeft.parent();
+    if (!filtering() || !sourceParent.isValid()) {
+        emit dataChanged(mapFromSource(topLeft), mapFromSource(bottomRight));
+        return;
+    }
+
+    // A page can start or stop matching when its title changes
+    int date = sourceParent.row();
+    if (date >= m_pages.count())
+        return;
+    QModelIndex parent = index(date, 0);
+    for (int i = topLeft.row(); i <= bottomRight.row(); ++i) {
+        QList<int> &pages = m_pages[date];
+        int row = qLowerBound(pages.begin(), pages.end(), i) - pages.begin();
+        bool shown = row < pages.count() && pages.at(row) == i;
+        bool matches = pageMatches(sourceModel()->index(i, 0, sourceParent));
+        if (shown && matches) {
+            emit dataChanged(index(row, topLeft.column(), parent),
+                             index(row, bottomRight.column(), parent));
+        } else if (matches) {
+            beginInsertRows(parent, row, row);
+            pages.insert(row, i);
+            endInsertRows();
+        } else if (shown) {
+            beginRemoveRows(parent, row, row);
+            pages.removeAt(row);
+            endRemoveRows();
+        }
+    }
+}
+
+void HistoryProxyModel::sourceRowsInserted(const QModelIndex &parent, int start, int end)
+{
+    if (!filtering()) {
+        beginInsertRows(mapFromSource(parent), start, end);
+        endInsertRows();
+        return;
+    }
+
+    // New dates only show the pages that match
+    if (!parent.isValid()) {
+        beginInsertRows(QModelIndex(), start, end);
+        for (int i = start; i <= end; ++i)
+            m_pages.insert(i, matchingPages(i));
+        endInsertRows();
+        return;
+    }
+
+    int date = parent.row();
+    if (date >= m_pages.count())
+        return;
+    QList<int> &pages = m_pages[date];
+    int first = qLowerBound(pages.begin(), pages.end(), start) - pages.begin();
+    // The pages after the new ones move down in the source
+    int count = end - start + 1;
+    for (int i = first; i < pages.count(); ++i)
+        pages[i] += count;
+
+    QList<int> matches;
+    for (int i = start; i <= end; ++i) {
+        if (pageMatches(sourceModel()->index(i, 0, parent)))
+            matches.append(i);
+    }
+    if (matches.isEmpty())
+        return;
+    beginInsertRows(index(date, 0), first, first + matches.count() - 1);
+    for (int i = 0; i < matches.count(); ++i)
+        pages.insert(first + i, matches.at(i));
+    endInsertRows();
+}
+
+void HistoryProxyModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end)
+{
+    m_removingRows = false;
+    m_removingDate = -1;
+    if (!parent.isValid()) {
+        beginRemoveRows(QModelIndex(), start, end);
+        m_removingRows = true;
+        return;
+    }
+
+    m_removingDate = parent.row();
+    if (!filtering()) {
+        beginRemoveRows(mapFromSource(parent), start, end);
+        m_removingRows = true;
+        return;
+    }
+    if (m_removingDate >= m_pages.count())
+        return;
+    const QList<int> &pages = m_pages.at(m_removingDate);
+    m_removingFirst = qLowerBound(pages.begin(), pages.end(), start) - pages.begin();
+    m_removingLast = qLowerBound(pages.begin(), pages.end(), end + 1) - pages.begin() - 1;
+    if (m_removingFirst <= m_removingLast) {
+        beginRemoveRows(index(m_removingDate, 0), m_removingFirst, m_removingLast);
+        m_removingRows = true;
+    }
+}
+
+void HistoryProxyModel::sourceRowsRemoved(const QModelIndex &parent, int start, int end)
+{
+    if (filtering()) {
+        if (!parent.isValid()) {
+            for (int i = qMin(end, m_pages.count() - 1); i >= start; --i)
+                m_pages.removeAt(i);
+        } else if (m_removingDate >= 0 && m_removingDate < m_pages.count()) {
+            QList<int> &pages = m_pages[m_removingDate];
+            if (m_removingRows)
+                pages.erase(pages.begin() + m_removingFirst, pages.begin() + m_removingLast + 1);
+            int count = end - start + 1;
+            for (int i = m_removingFirst; i < pages.count(); ++i)
+                pages[i] -= count;
+        }
+    }
+    m_removingDate = -1;
+    if (m_removingRows) {
+        m_removingRows = false;
+        endRemoveRows();
+    }
+}
+
 HistoryDialog::HistoryDialog(QWidget *parent, HistoryManager *setHistory) : QDialog(parent)
 {
     HistoryManager *history = setHistory;
@@ -421,10 +933,9 @@ HistoryDialog::HistoryDialog(QWidget *parent, HistoryManager *setHistory) : QDia
     tree->setSelectionMode(QAbstractItemView::ExtendedSelection);
     tree->setTextElideMode(Qt::ElideMiddle);
     QAbstractItemModel *model = history->historyTreeModel();
-    TreeProxyModel *proxyModel = new TreeProxyModel(this);
-    proxyModel->setFilterKeyColumn(-1);
+    HistoryProxyModel *proxyModel = new HistoryProxyModel(history, this);
     connect(search, SIGNAL(textChanged(QString)),
-            proxyModel, SLOT(setFilterFixedString(QString)));
+            proxyModel, SLOT(setSearchText(QString)));
     connect(removeButton, SIGNAL(clicked()), tree, SLOT(removeSelected()));
     connect(removeAllButton, SIGNAL(clicked()), history, SLOT(clear()));
     proxyModel->setSourceModel(model);
@@ -478,9 +989,12 @@ void HistoryDialog::copy()
     clipboard->setText(url);
 }
 
+static const int MAXIMUM_UNCOVERED_INSERTS = 64;
+
 HistoryFilterModel::HistoryFilterModel(QAbstractItemModel *sourceModel, QObject *parent)
     : QAbstractProxyModel(parent)
     , m_loaded(false)
+    , m_removingRows(false)
 {
     setSourceModel(sourceModel);
 }
@@ -490,7 +1004,7 @@ int HistoryFilterModel::historyLocation(const QString &url) const
     load();
     if (!m_historyHash.contains(url))
         return 0;
-    return sourceModel()->rowCount() - m_historyHash.value(url);
+    return sourceRowForSequence(m_historyHash.value(url));
 }
 
 QVariant HistoryFilterModel::data(const QModelIndex &index, int role) const
@@ -503,9 +1017,11 @@ void HistoryFilterModel::setSourceModel(QAbstractItemModel *newSourceModel)
     if (sourceModel()) {
         disconnect(sourceModel(), SIGNAL(modelReset()), this, SLOT(sourceReset()));
         disconnect(sourceModel(), SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &)),
-                   this, SLOT(dataChanged(const QModelIndex &, const QModelIndex &)));
+                   this, SLOT(sourceDataChanged(const QModelIndex &, const QModelIndex &)));
         disconnect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
                    this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        disconnect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                   this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
         disconnect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
                    this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
     }
@@ -519,6 +1035,8 @@ void HistoryFilterModel::setSourceModel(QAbstractItemModel *newSourceModel)
                 this, SLOT(sourceDataChanged(const QModelIndex &, const QModelIndex &)));
         connect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
                 this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        connect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
         connect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
                 this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
     }
@@ -545,7 +1063,7 @@ int HistoryFilterModel::rowCount(const QModelIndex &parent) const
     load();
     if (parent.isValid())
         return 0;
-    return m_historyHash.count();
+    return m_filteredRows.total();
 }
 
 int HistoryFilterModel::columnCount(const QModelIndex &parent) const
@@ -553,37 +1071,40 @@ int HistoryFilterModel::columnCount(const QModelIndex &parent) const
     return (parent.isValid()) ? 0 : 2;
 }
 
+int HistoryFilterModel::sequenceForSourceRow(int row) const
+{
+    return m_sourceRows.find(row);
+}
+
+int HistoryFilterModel::sourceRowForSequence(int sequence) const
+{
+    return m_sourceRows.row(sequence);
+}
+
 QModelIndex HistoryFilterModel::mapToSource(const QModelIndex &proxyIndex) const
 {
     load();
-    int sourceRow = sourceModel()->rowCount() - proxyIndex.internalId();
-    return sourceModel()->index(sourceRow, proxyIndex.column());
+    int sequence = proxyIndex.internalId();
+    if (!proxyIndex.isValid()
+        || !m_sourceRows.contains(sequence)
+        || m_sourceRows.value(sequence) == 0)
+        return QModelIndex();
+    return sourceModel()->index(sourceRowForSequence(sequence), proxyIndex.column());
 }
 
 QModelIndex HistoryFilterModel::mapFromSource(const QModelIndex &sourceIndex) const
 {
     load();
-    QString url = sourceIndex.data(HistoryModel::UrlStringRole).toString();
-    if (!m_historyHash.contains(url))
+    if (!sourceIndex.isValid()
+        || sourceIndex.row() >= m_sourceRows.total())
         return QModelIndex();
 
-    // This can be done in a binary search, but we can't use qBinary find
-    // because it can't take: qBinaryFind(m_sourceRow.end(), m_sourceRow.begin(), v);
-    // so if this is a performance bottlneck then convert to binary search, until then
-    // the cleaner/easier to read code wins the day.
-    int realRow = -1;
-    int sourceModelRow = sourceModel()->rowCount() - sourceIndex.row();
-
-    for (int i = 0; i < m_sourceRow.count(); ++i) {
-        if (m_sourceRow.at(i) == sourceModelRow) {
-            realRow = i;
-            break;
-        }
-    }
-    if (realRow == -1)
+    int sequence = sequenceForSourceRow(sourceIndex.row());
+    if (m_filteredRows.value(sequence) == 0)
         return QModelIndex();
 
-    return createIndex(realRow, sourceIndex.column(), sourceModel()->rowCount() - sourceIndex.row());
+    int realRow = m_filteredRows.row(sequence);
+    return createIndex(realRow, sourceIndex.column(), sequence);
 }
 
 QModelIndex HistoryFilterModel::index(int row, int column, const QModelIndex &parent) const
@@ -593,7 +1114,8 @@ QModelIndex HistoryFilterModel::index(int row, int column, const QModelIndex &pa
         || column < 0 || column >= columnCount(parent))
         return QModelIndex();
 
-    return createIndex(row, column, m_sourceRow[row]);
+    int sequence = m_filteredRows.find(row);
+    return createIndex(row, column, sequence);
 }
 
 QModelIndex HistoryFilterModel::parent(const QModelIndex &) const
@@ -601,171 +1123,247 @@ QModelIndex HistoryFilterModel::parent(const QModelIndex &) const
     return QModelIndex();
 }
 
+void HistoryFilterModel::growOccurrences(int sequence) const
+{
+    int slot = HistoryRankDeque::slot(sequence);
+    while (m_newerOccurrence.count() <= slot) {
+        m_newerOccurrence.append(0);
+        m_olderOccurrence.append(0);
+    }
+}
+
+/*
+    Links \a sequence in between the newest and the oldest entry of the
+    url whose newest entry is \a newest, which makes it either the newest
+    or the oldest entry depending on where it is in the source.
+  */
+void HistoryFilterModel::linkOccurrence(int newest, int sequence) const
+{
+    int oldest = newerOccurrence(newest);
+    newerOccurrence(newest) = sequence;
+    olderOccurrence(sequence) = newest;
+    newerOccurrence(sequence) = oldest;
+    olderOccurrence(oldest) = sequence;
+}
+
 void HistoryFilterModel::load() const
 {
     if (m_loaded)
         return;
-    m_sourceRow.clear();
     m_historyHash.clear();
-    m_historyHash.reserve(sourceModel()->rowCount());
-    for (int i = 0; i < sourceModel()->rowCount(); ++i) {
+    m_sourceRows.clear();
+    m_filteredRows.clear();
+    m_newerOccurrence.clear();
+    m_olderOccurrence.clear();
+
+    int count = sourceModel()->rowCount();
+    m_historyHash.reserve(count);
+    // Walk from the oldest entry, the newest entry of each url is visible
+    for (int i = count - 1; i >= 0; --i) {
         QModelIndex idx = sourceModel()->index(i, 0);
         QString url = idx.data(HistoryModel::UrlStringRole).toString();
-        if (!m_historyHash.contains(url)) {
-            m_sourceRow.append(sourceModel()->rowCount() - i);
-            m_historyHash[url] = sourceModel()->rowCount() - i;
+        int sequence = m_sourceRows.pushFront(1);
+        m_filteredRows.pushFront(0);
+        growOccurrences(sequence);
+        QHash<QString, int>::iterator it = m_historyHash.find(url);
+        if (it != m_historyHash.end()) {
+            linkOccurrence(it.value(), sequence);
+            it.value() = sequence;
+        } else {
+            newerOccurrence(sequence) = sequence;
+            olderOccurrence(sequence) = sequence;
+            m_historyHash.insert(url, sequence);
         }
     }
+    QHash<QString, int>::const_iterator it = m_historyHash.constBegin();
+    for (; it != m_historyHash.constEnd(); ++it)
+        m_filteredRows.add(it.value(), 1);
     m_loaded = true;
 }
 
 void HistoryFilterModel::sourceRowsInserted(const QModelIndex &parent, int start, int end)
 {
-    Q_ASSERT(start == end && start == 0);
-    Q_UNUSED(end);
-    if (!m_loaded)
+    if (!m_loaded || parent.isValid())
         return;
-    QModelIndex idx = sourceModel()->index(start, 0, parent);
-    QString url = idx.data(HistoryModel::UrlStringRole).toString();
-    if (m_historyHash.contains(url)) {
-        int sourceRow = sourceModel()->rowCount() - m_historyHash[url];
-        int realRow = mapFromSource(sourceModel()->index(sourceRow, 0)).row();
-        beginRemoveRows(QModelIndex(), realRow, realRow);
-        m_sourceRow.removeAt(realRow);
-        m_historyHash.remove(url);
-        endRemoveRows();
-    }
-    beginInsertRows(QModelIndex(), 0, 0);
-    m_historyHash.insert(url, sourceModel()->rowCount() - start);
-    m_sourceRow.insert(0, sourceModel()->rowCount());
-    endInsertRows();
+    // New entries come in at the top and the ones that are loaded in
+    // the background at the bottom
+    if (start == m_sourceRows.total())
+        appendOlderRows(start, end);
+    else if (start == 0)
+        insertNewerRows(start, end);
+    else
+        sourceReset();
 }
 
-void HistoryFilterModel::sourceRowsRemoved(const QModelIndex &, int start, int end)
+// The new entries hide older entries of the same url
+void HistoryFilterModel::insertNewerRows(int start, int end)
 {
-    Q_UNUSED(start);
-    Q_UNUSED(end);
-    sourceReset();
-}
-
-/*
-    Removing a continuous block of rows will remove filtered rows too as this is
-    the users intention.
-*/
-bool HistoryFilterModel::removeRows(int row, int count, const QModelIndex &parent)
-{
-    if (row < 0 || count <= 0 || row + count > rowCount(parent) || parent.isValid())
-        return false;
-    int lastRow = row + count - 1;
-    disconnect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
-               this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
-    beginRemoveRows(parent, row, lastRow);
-    int oldCount = rowCount();
-    int start = sourceModel()->rowCount() - m_sourceRow.value(row);
-    int end = sourceModel()->rowCount() - m_sourceRow.value(lastRow);
-    sourceModel()->removeRows(start, end - start + 1);
-    endRemoveRows();
-    connect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
-            this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
-    m_loaded = false;
-    if (oldCount - count != rowCount())
-        reset();
-    return true;
-}
+    // Account for the new source rows first so existing rows still map correctly
+    int oldest = m_sourceRows.pushFront(1);
+    m_filteredRows.pushFront(0);
+    for (int i = start; i < end; ++i) {
+        m_sourceRows.pushFront(1);
+        m_filteredRows.pushFront(0);
+    }
+    growOccurrences(oldest + end - start);
 
-HistoryCompletionModel::HistoryCompletionModel(QObject *parent)
-    : QAbstractProxyModel(parent)
-{
+    int sequence = oldest;
+    for (int i = end; i >= start; --i, ++sequence) {
+        QModelIndex idx = sourceModel()->index(i, 0);
+        QString url = idx.data(HistoryModel::UrlStringRole).toString();
+        if (m_historyHash.contains(url)) {
+            int older = m_historyHash.value(url);
+            if (m_filteredRows.value(older)) {
+                int realRow = m_filteredRows.row(older);
+                beginRemoveRows(QModelIndex(), realRow, realRow);
+                m_filteredRows.add(older, -1);
+                endRemoveRows();
+            }
+            linkOccurrence(older, sequence);
+        } else {
+            newerOccurrence(sequence) = sequence;
+            olderOccurrence(sequence) = sequence;
+        }
+        beginInsertRows(QModelIndex(), 0, 0);
+        m_filteredRows.add(sequence, 1);
+        m_historyHash.insert(url, sequence);
+        endInsertRows();
+    }
 }
 
-QVariant HistoryCompletionModel::data(const QModelIndex &index, int role) const
+/*
+    Older entries are hidden by anything that is already there, the
+    urls that are new show up together at the end.
+  */
+void HistoryFilterModel::appendOlderRows(int start, int end)
 {
-    if (sourceModel()
-        && (role == Qt::EditRole || role == Qt::DisplayRole)
-        && index.isValid()) {
-        QModelIndex idx = mapToSource(index);
-        idx = idx.sibling(idx.row(), 1);
-        QString urlString = idx.data(HistoryModel::UrlStringRole).toString();
-        if (index.row() % 2) {
-            QUrl url = urlString;
-            QString s = url.toString(QUrl::RemoveScheme
-                                     | QUrl::RemoveUserInfo
-                                     | QUrl::StripTrailingSlash);
-            return s.mid(2);  // strip // from the front
+    QList<int> visible;
+    for (int i = start; i <= end; ++i) {
+        QModelIndex idx = sourceModel()->index(i, 0);
+        QString url = idx.data(HistoryModel::UrlStringRole).toString();
+        int sequence = m_sourceRows.pushBack(1);
+        m_filteredRows.pushBack(0);
+        growOccurrences(sequence);
+        QHash<QString, int>::const_iterator it = m_historyHash.constFind(url);
+        if (it != m_historyHash.constEnd()) {
+            linkOccurrence(it.value(), sequence);
+        } else {
+            newerOccurrence(sequence) = sequence;
+            olderOccurrence(sequence) = sequence;
+            m_historyHash.insert(url, sequence);
+            visible.append(sequence);
         }
-        return urlString;
     }
-    return QAbstractProxyModel::data(index, role);
-}
+    if (visible.isEmpty())
+        return;
 
-int HistoryCompletionModel::rowCount(const QModelIndex &parent) const
-{
-    return (parent.isValid() || !sourceModel()) ? 0 : sourceModel()->rowCount(parent) * 2;
+    int first = m_filteredRows.total();
+    beginInsertRows(QModelIndex(), first, first + visible.count() - 1);
+    foreach (int sequence, visible)
+        m_filteredRows.add(sequence, 1);
+    endInsertRows();
 }
 
-int HistoryCompletionModel::columnCount(const QModelIndex &parent) const
+void HistoryFilterModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end)
 {
-    return (parent.isValid()) ? 0 : 1;
-}
+    if (!m_loaded || parent.isValid())
+        return;
 
-QModelIndex HistoryCompletionModel::mapFromSource(const QModelIndex &sourceIndex) const
-{
-    int row = sourceIndex.row() * 2;
-    return index(row, sourceIndex.column());
-}
+    m_removing.clear();
+    for (int i = start; i <= end; ++i) {
+        QString url = sourceModel()->index(i, 0).data(HistoryModel::UrlStringRole).toString();
+        m_removing.append(qMakePair(sequenceForSourceRow(i), url));
+    }
 
-QModelIndex HistoryCompletionModel::mapToSource(const QModelIndex &proxyIndex) const
-{
-    if (!sourceModel())
-        return QModelIndex();
-    int row = proxyIndex.row() / 2;
-    return sourceModel()->index(row, proxyIndex.column());
+    // The visible rows of a continuous block of source rows are continuous
+    int newest = m_removing.first().first;
+    int oldest = m_removing.last().first;
+    int first = m_filteredRows.row(newest);
+    int count = m_filteredRows.row(oldest) + m_filteredRows.value(oldest) - first;
+    if (count > 0) {
+        beginRemoveRows(QModelIndex(), first, first + count - 1);
+        m_removingRows = true;
+    }
 }
 
-QModelIndex HistoryCompletionModel::index(int row, int column, const QModelIndex &parent) const
+void HistoryFilterModel::sourceRowsRemoved(const QModelIndex &parent, int start, int end)
 {
-    if (row < 0 || row >= rowCount(parent)
-        || column < 0 || column >= columnCount(parent))
-        return QModelIndex();
-    return createIndex(row, column, 0);
-}
+    Q_UNUSED(start);
+    Q_UNUSED(end);
+    if (!m_loaded || parent.isValid())
+        return;
 
-QModelIndex HistoryCompletionModel::parent(const QModelIndex &) const
-{
-    return QModelIndex();
-}
+    QStringList uncovered;
+    for (int i = 0; i < m_removing.count(); ++i) {
+        int sequence = m_removing.at(i).first;
+        const QString &url = m_removing.at(i).second;
+        m_sourceRows.add(sequence, -1);
+        if (m_filteredRows.value(sequence)) {
+            m_filteredRows.add(sequence, -1);
+            uncovered.append(url);
+        }
 
-void HistoryCompletionModel::setSourceModel(QAbstractItemModel *newSourceModel)
-{
-    if (sourceModel()) {
-        disconnect(sourceModel(), SIGNAL(modelReset()), this, SLOT(sourceReset()));
-        disconnect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
-                   this, SLOT(sourceReset()));
-        disconnect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
-                   this, SLOT(sourceReset()));
+        int newer = newerOccurrence(sequence);
+        int older = olderOccurrence(sequence);
+        if (newer == sequence) {
+            m_historyHash.remove(url);
+        } else {
+            olderOccurrence(newer) = older;
+            newerOccurrence(older) = newer;
+            if (m_historyHash.value(url) == sequence)
+                m_historyHash.insert(url, older);
+        }
+        newerOccurrence(sequence) = 0;
+        olderOccurrence(sequence) = 0;
     }
+    m_removing.clear();
 
-    QAbstractProxyModel::setSourceModel(newSourceModel);
-
-    if (newSourceModel) {
-        connect(newSourceModel, SIGNAL(modelReset()), this, SLOT(sourceReset()));
-        connect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
-                this, SLOT(sourceReset()));
-        connect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
-                this, SLOT(sourceReset()));
+    if (m_removingRows) {
+        m_removingRows = false;
+        endRemoveRows();
     }
 
-    reset();
+    // An older entry of a removed url is no longer a duplicate, when
+    // a big block was removed it is cheaper to start over than to
+    // insert them one at a time
+    QList<int> shown;
+    foreach (const QString &url, uncovered) {
+        QHash<QString, int>::const_iterator it = m_historyHash.constFind(url);
+        if (it != m_historyHash.constEnd() && !m_filteredRows.value(it.value()))
+            shown.append(it.value());
+    }
+    if (shown.count() > MAXIMUM_UNCOVERED_INSERTS) {
+        sourceReset();
+        return;
+    }
+    foreach (int sequence, shown) {
+        int realRow = m_filteredRows.row(sequence);
+        beginInsertRows(QModelIndex(), realRow, realRow);
+        m_filteredRows.add(sequence, 1);
+        endInsertRows();
+    }
 }
 
-void HistoryCompletionModel::sourceReset()
+/*
+    Removing a continuous block of rows will remove filtered rows too as this is
+    the users intention.
+*/
+bool HistoryFilterModel::removeRows(int row, int count, const QModelIndex &parent)
 {
-    reset();
+    if (row < 0 || count <= 0 || row + count > rowCount(parent) || parent.isValid())
+        return false;
+    int lastRow = row + count - 1;
+    int start = sourceRowForSequence(index(row, 0).internalId());
+    int end = sourceRowForSequence(index(lastRow, 0).internalId());
+    return sourceModel()->removeRows(start, end - start + 1);
 }
 
 HistoryTreeModel::HistoryTreeModel(QAbstractItemModel *sourceModel, QObject *parent)
     : QAbstractProxyModel(parent)
-    , removingDown(false)
+    , m_removing(NotRemoving)
+    , m_removingFirst(0)
+    , m_holeStart(0)
+    , m_holeEnd(0)
 {
     setSourceModel(sourceModel);
 }
@@ -782,10 +1380,8 @@ QVariant HistoryTreeModel::data(const QModelIndex &index, int role) const
     case Qt::EditRole: {
         int start = index.internalId();
         if (start == 0) {
-            int offset = sourceDateRow(index.row());
             if (index.column() == 0) {
-                QModelIndex idx = sourceModel()->index(offset, 0);
-                QDate date = idx.data(HistoryModel::DateRole).toDate();
+                QDate date = sourceDate(index.row());
                 if (date == QDate::currentDate())
                     return tr("Earlier Today");
                 return date.toString(QLatin1String("dddd, MMMM d, yyyy"));
@@ -800,11 +1396,8 @@ QVariant HistoryTreeModel::data(const QModelIndex &index, int role) const
             return QIcon(QLatin1String(":graphics/history.png"));
     }
     case HistoryModel::DateRole: {
-        if (index.column() == 0 && index.internalId() == 0) {
-            int offset = sourceDateRow(index.row());
-            QModelIndex idx = sourceModel()->index(offset, 0);
-            return idx.data(HistoryModel::DateRole);
-        }
+        if (index.column() == 0 && index.internalId() == 0)
+            return sourceDate(index.row());
     }
     }
 
@@ -824,46 +1417,99 @@ int HistoryTreeModel::rowCount(const QModelIndex &parent) const
         return 0;
 
     // row count OF dates
-    if (!parent.isValid()) {
-        if (!m_sourceRowCache.isEmpty())
-            return m_sourceRowCache.count();
-        QDate currentDate;
-        int rows = 0;
-        int totalRows = sourceModel()->rowCount();
-
-        for (int i = 0; i < totalRows; ++i) {
-            QDate rowDate = sourceModel()->index(i, 0).data(HistoryModel::DateRole).toDate();
-            if (rowDate != currentDate) {
-                m_sourceRowCache.append(i);
-                currentDate = rowDate;
-                ++rows;
-            }
+    if (!parent.isValid())
+        return m_days.total();
+
+    // row count FOR a date
+    if (parent.row() >= m_days.total())
+        return 0;
+    return m_dayRows.value(dayId(parent.row()));
+}
+
+/*
+    Find where each day starts in the source, the source is sorted by date
+    so every day after the first is found with a binary search.
+  */
+void HistoryTreeModel::load()
+{
+    m_days.clear();
+    m_dayRows.clear();
+    m_dayDates.clear();
+    m_dayIds.clear();
+    m_holeStart = 0;
+    m_holeEnd = 0;
+    if (!sourceModel())
+        return;
+
+    int totalRows = sourceModel()->rowCount();
+    int row = 0;
+    while (row < totalRows) {
+        QDate date = sourceModel()->index(row, 0).data(HistoryModel::DateRole).toDate();
+        int low = row + 1;
+        int high = totalRows;
+        while (low < high) {
+            int middle = low + (high - low) / 2;
+            QDate middleDate = sourceModel()->index(middle, 0).data(HistoryModel::DateRole).toDate();
+            if (middleDate < date)
+                high = middle;
+            else
+                low = middle + 1;
         }
-        Q_ASSERT(m_sourceRowCache.count() == rows);
-        return rows;
+        addDay(date, low - row, false);
+        row = low;
     }
+}
 
-    // row count FOR a date
-    int start = sourceDateRow(parent.row());
-    int end = sourceDateRow(parent.row() + 1);
-    return (end - start);
+// The id of the date at the top level \a row
+int HistoryTreeModel::dayId(int row) const
+{
+    return m_days.find(row);
+}
+
+// The source row at \a offset in m_dayRows, past the rows being removed
+int HistoryTreeModel::sourceRow(int offset) const
+{
+    if (offset < m_holeStart)
+        return offset;
+    return offset + m_holeEnd - m_holeStart;
 }
 
 // Translate the top level date row into the offset where that date starts
 int HistoryTreeModel::sourceDateRow(int row) const
 {
-    if (row <= 0)
-        return 0;
+    if (row >= m_days.total())
+        return sourceRow(m_dayRows.total());
+    return sourceRow(m_dayRows.row(dayId(qMax(0, row))));
+}
 
-    if (m_sourceRowCache.isEmpty())
-        rowCount(QModelIndex());
+// Where the date ends in the source, it can't reach into rows being removed
+int HistoryTreeModel::sourceDateEnd(int row) const
+{
+    int id = dayId(row);
+    int end = m_dayRows.row(id) + m_dayRows.value(id);
+    if (end <= m_holeStart)
+        return end;
+    return end + m_holeEnd - m_holeStart;
+}
 
-    if (row >= m_sourceRowCache.count()) {
-        if (!sourceModel())
-            return 0;
-        return sourceModel()->rowCount();
-    }
-    return m_sourceRowCache.at(row);
+QDate HistoryTreeModel::sourceDate(int row) const
+{
+    if (row < 0 || row >= m_days.total())
+        return QDate();
+    return m_dayDates.at(HistoryRankDeque::slot(dayId(row)));
+}
+
+// The top level date row that the source row is in, -1 if there is none
+int HistoryTreeModel::dateRow(int sourceRow) const
+{
+    if (sourceRow >= m_holeStart && sourceRow < m_holeEnd)
+        return -1;
+    int offset = sourceRow;
+    if (sourceRow >= m_holeEnd)
+        offset -= m_holeEnd - m_holeStart;
+    if (offset < 0 || offset >= m_dayRows.total())
+        return -1;
+    return m_days.row(m_dayRows.find(offset));
 }
 
 QModelIndex HistoryTreeModel::mapToSource(const QModelIndex &proxyIndex) const
@@ -917,6 +1563,8 @@ void HistoryTreeModel::setSourceModel(QAbstractItemModel *newSourceModel)
         disconnect(sourceModel(), SIGNAL(layoutChanged()), this, SLOT(sourceReset()));
         disconnect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
                    this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        disconnect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                   this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
         disconnect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
                    this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
     }
@@ -928,16 +1576,19 @@ void HistoryTreeModel::setSourceModel(QAbstractItemModel *newSourceModel)
         connect(sourceModel(), SIGNAL(layoutChanged()), this, SLOT(sourceReset()));
         connect(sourceModel(), SIGNAL(rowsInserted(const QModelIndex &, int, int)),
                 this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+        connect(sourceModel(), SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+                this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
         connect(sourceModel(), SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
                 this, SLOT(sourceRowsRemoved(const QModelIndex &, int, int)));
     }
 
+    load();
     reset();
 }
 
 void HistoryTreeModel::sourceReset()
 {
-    m_sourceRowCache.clear();
+    load();
     reset();
 }
 
@@ -945,22 +1596,85 @@ void HistoryTreeModel::sourceRowsInserted(const QModelIndex &parent, int start,
 {
     Q_UNUSED(parent); // Avoid warnings when compiling release
     Q_ASSERT(!parent.isValid());
-    if (start != 0 || start != end) {
-        m_sourceRowCache.clear();
-        reset();
-        return;
+
+    // Runs of rows from the same date are added together, in order so
+    // that the rows before each run are then the same as in the source.
+    int runStart = start;
+    QDate runDate = sourceModel()->index(start, 0).data(HistoryModel::DateRole).toDate();
+    for (int i = start + 1; i <= end; ++i) {
+        QDate date = sourceModel()->index(i, 0).data(HistoryModel::DateRole).toDate();
+        if (date == runDate)
+            continue;
+        if (!insertRun(runStart, i - 1, runDate))
+            return;
+        runStart = i;
+        runDate = date;
+    }
+    insertRun(runStart, end, runDate);
+}
+
+// Gives \a date an id in front of or behind every other date
+int HistoryTreeModel::addDay(const QDate &date, int count, bool front)
+{
+    int id;
+    if (front) {
+        id = m_days.pushFront(1);
+        m_dayRows.pushFront(count);
+    } else {
+        id = m_days.pushBack(1);
+        m_dayRows.pushBack(count);
     }
+    int slot = HistoryRankDeque::slot(id);
+    if (slot >= m_dayDates.count())
+        m_dayDates.resize(qMax(slot + 1, 2 * m_dayDates.count()));
+    m_dayDates[slot] = date;
+    m_dayIds.insert(date, id);
+    return id;
+}
 
-    m_sourceRowCache.clear();
-    QModelIndex treeIndex = mapFromSource(sourceModel()->index(start, 0));
-    QModelIndex treeParent = treeIndex.parent();
-    if (rowCount(treeParent) == 1) {
+/*
+    A date that is newer or older than every date seen so far, or that was
+    seen before, is added in place.  One in between can't be given an id
+    in the right place and the dates are found again, false is returned
+    as the rows that are left have been read in as well.
+  */
+bool HistoryTreeModel::insertRun(int start, int end, const QDate &date)
+{
+    int count = end - start + 1;
+    QMap<QDate, int>::const_iterator it = m_dayIds.constFind(date);
+    if (it != m_dayIds.constEnd()) {
+        int id = it.value();
+        int row = m_days.row(id);
+        if (m_days.value(id)) {
+            int offset = m_dayRows.row(id);
+            beginInsertRows(index(row, 0), start - offset, end - offset);
+            m_dayRows.add(id, count);
+        } else {
+            beginInsertRows(QModelIndex(), row, row);
+            m_days.add(id, 1);
+            m_dayRows.add(id, count);
+        }
+        endInsertRows();
+        return true;
+    }
+
+    if (m_dayIds.isEmpty() || date > (m_dayIds.constEnd() - 1).key()) {
         beginInsertRows(QModelIndex(), 0, 0);
+        addDay(date, count, true);
         endInsertRows();
-    } else {
-        beginInsertRows(treeParent, treeIndex.row(), treeIndex.row());
+        return true;
+    }
+    if (date < m_dayIds.constBegin().key()) {
+        int row = m_days.total();
+        beginInsertRows(QModelIndex(), row, row);
+        addDay(date, count, false);
         endInsertRows();
+        return true;
     }
+
+    load();
+    reset();
+    return false;
 }
 
 QModelIndex HistoryTreeModel::mapFromSource(const QModelIndex &sourceIndex) const
@@ -968,16 +1682,10 @@ QModelIndex HistoryTreeModel::mapFromSource(const QModelIndex &sourceIndex) cons
     if (!sourceIndex.isValid())
         return QModelIndex();
 
-    if (m_sourceRowCache.isEmpty())
-        rowCount(QModelIndex());
-
-    QList<int>::iterator it;
-    it = qLowerBound(m_sourceRowCache.begin(), m_sourceRowCache.end(), sourceIndex.row());
-    if (*it != sourceIndex.row())
-        --it;
-    int dateRow = qMax(0, it - m_sourceRowCache.begin());
-    int row = sourceIndex.row() - m_sourceRowCache.at(dateRow);
-    return createIndex(row, sourceIndex.column(), dateRow + 1);
+    int row = dateRow(sourceIndex.row());
+    if (row < 0)
+        return QModelIndex();
+    return createIndex(sourceIndex.row() - sourceDateRow(row), sourceIndex.column(), row + 1);
 }
 
 bool HistoryTreeModel::removeRows(int row, int count, const QModelIndex &parent)
@@ -985,60 +1693,98 @@ bool HistoryTreeModel::removeRows(int row, int count, const QModelIndex &parent)
     if (row < 0 || count <= 0 || row + count > rowCount(parent))
         return false;
 
-    removingDown = true;
-    if (parent.isValid() && rowCount(parent) == count - row)
-        beginRemoveRows(QModelIndex(), parent.row(), parent.row());
-    else
-        beginRemoveRows(parent, row, row + count - 1);
+    // Our rows go away when the source tells us they were removed
     if (parent.isValid()) {
         // removing pages
         int offset = sourceDateRow(parent.row());
         return sourceModel()->removeRows(offset + row, count);
-    } else {
-        // removing whole dates
-        for (int i = row + count - 1; i >= row; --i) {
-            QModelIndex dateParent = index(i, 0);
-            int offset = sourceDateRow(dateParent.row());
-            if (!sourceModel()->removeRows(offset, rowCount(dateParent)))
-                return false;
-        }
     }
-    return true;
+    // removing whole dates
+    int start = sourceDateRow(row);
+    int end = sourceDateRow(row + count);
+    return sourceModel()->removeRows(start, end - start);
 }
 
-void HistoryTreeModel::sourceRowsRemoved(const QModelIndex &parent, int start, int end)
+/*
+    A range of source rows that is inside one date is removed from that
+    date.  A range over several dates is removed in up to three steps
+    while the source still has the rows: the top of the last date, the
+    dates that go completely and the bottom of the first date.  Until the
+    source is done the removed rows are a hole that no date covers.
+  */
+void HistoryTreeModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end)
 {
-    if (!removingDown) {
-        reset();
-        m_sourceRowCache.clear();
-        return;
-    }
     Q_UNUSED(parent); // Avoid warnings when compiling release
     Q_ASSERT(!parent.isValid());
-    if (!m_sourceRowCache.isEmpty())
-    for (int i = end; i >= start;) {
-        QList<int>::iterator it;
-        it = qLowerBound(m_sourceRowCache.begin(), m_sourceRowCache.end(), i);
-        if (*it != i)
-            --it;
-        int row = qMax(0, it - m_sourceRowCache.begin());
-        int offset = m_sourceRowCache[row];
-        QModelIndex dateParent = index(row, 0);
-        // If we can remove all the rows in the date do that and skip over them
-        int rc = rowCount(dateParent);
-        if (i - rc + 1 == offset && start <= i - rc + 1) {
-            m_sourceRowCache.removeAt(row);
-            i -= rc + 1;
-        } else {
-            ++row;
-            --i;
+    m_removing = NotRemoving;
+
+    int first = dateRow(start);
+    int last = dateRow(end);
+    if (first < 0 || last < 0)
+        return;
+    int firstStart = sourceDateRow(first);
+    int lastEnd = sourceDateEnd(last);
+    if (first == last && (start != firstStart || end != lastEnd - 1)) {
+        m_removing = RemovingPages;
+        m_removingFirst = first;
+        beginRemoveRows(index(first, 0), start - firstStart, end - firstStart);
+        return;
+    }
+
+    m_removing = RemovingDates;
+    m_holeStart = end + 1;
+    m_holeEnd = end + 1;
+    int lastStart = sourceDateRow(last);
+    if (end != lastEnd - 1) {
+        beginRemoveRows(index(last, 0), 0, end - lastStart);
+        m_dayRows.add(dayId(last), lastStart - end - 1);
+        m_holeStart = lastStart;
+        endRemoveRows();
+        --last;
+    }
+    if (start != firstStart)
+        ++first;
+    if (first <= last) {
+        beginRemoveRows(QModelIndex(), first, last);
+        int holeStart = sourceDateRow(first);
+        QList<int> ids;
+        for (int i = first; i <= last; ++i)
+            ids.append(dayId(i));
+        foreach (int id, ids) {
+            m_dayRows.add(id, -m_dayRows.value(id));
+            m_days.add(id, -1);
         }
-        for (int j = row; j < m_sourceRowCache.count(); ++j)
-            --m_sourceRowCache[j];
+        m_holeStart = holeStart;
+        endRemoveRows();
+    }
+    if (start != firstStart) {
+        int dateEnd = sourceDateEnd(first - 1);
+        beginRemoveRows(index(first - 1, 0), start - firstStart, dateEnd - firstStart - 1);
+        m_dayRows.add(dayId(first - 1), start - dateEnd);
+        m_holeStart = start;
+        endRemoveRows();
     }
-    if (removingDown) {
+}
+
+void HistoryTreeModel::sourceRowsRemoved(const QModelIndex &parent, int start, int end)
+{
+    Q_UNUSED(parent); // Avoid warnings when compiling release
+    Q_ASSERT(!parent.isValid());
+    RemovingState removing = m_removing;
+    m_removing = NotRemoving;
+
+    switch (removing) {
+    case NotRemoving:
+        break;
+    case RemovingDates:
+        // The dates left the rows out as they were taken away
+        m_holeStart = 0;
+        m_holeEnd = 0;
+        break;
+    case RemovingPages:
+        m_dayRows.add(dayId(m_removingFirst), start - end - 1);
         endRemoveRows();
-        removingDown = false;
+        break;
     }
 }
 
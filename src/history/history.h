@@ -63,14 +63,17 @@
 #ifndef HISTORY_H
 #define HISTORY_H
 
+#include "historymanager.h"
 #include "modelmenu.h"
 
 #include <qdatetime.h>
 #include <qhash.h>
+#include <qmap.h>
 #include <qobject.h>
 #include <qsortfilterproxymodel.h>
 #include <qtimer.h>
 #include <qurl.h>
+#include <qvector.h>
 
 #include <qwebhistoryinterface.h>
 
@@ -82,6 +85,10 @@ class HistoryModel : public QAbstractTableModel
 public slots:
     void historyReset();
     void entryAdded();
+    void entriesLoaded(int offset, int count);
+    void entryAboutToBeRemoved(int offset);
+    void entriesAboutToBeRemoved(int offset, int count);
+    void entryRemoved();
     void entryUpdated(int offset);
 
 public:
@@ -102,12 +109,54 @@ public:
 
 private:
     HistoryManager *m_history;
+    bool m_removingRow;
+};
+
+/*
+    One row per url in the history with how often and when it was visited,
+    rows are in the order the urls were first visited.  Sort on
+    VisitCountRole or TypedCountRole for the most visited pages.
+  */
+class HistoryUrlModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public slots:
+    void urlEntriesReset();
+    void urlEntryAdded(int row);
+    void urlEntriesAdded(int row, int count);
+    void urlEntryAboutToBeRemoved(int row);
+    void urlEntryRemoved();
+    void urlEntryUpdated(int row);
+
+public:
+    enum Roles {
+        VisitCountRole = HistoryModel::TitleRole + 1,
+        TypedCountRole = HistoryModel::TitleRole + 2,
+        FirstVisitRole = HistoryModel::TitleRole + 3,
+        LastVisitRole = HistoryModel::TitleRole + 4
+    };
+
+    HistoryUrlModel(HistoryManager *history, QObject *parent = 0);
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+private:
+    HistoryManager *m_history;
+    bool m_removingRow;
 };
 
 /*!
     Proxy model that will remove any duplicate entries.
-    Both m_sourceRow and m_historyHash store their offsets not from
-    the front of the list, but as offsets from the back.
+
+    Every source row is given a sequence number when it is added, the oldest
+    entry has the lowest number.  Sequence numbers never change so they are
+    used as the internal id of our indexes.  m_sourceRows counts the sequence
+    numbers that are still in the source model and m_filteredRows the ones
+    that are not hidden duplicates, which lets us map rows in both directions
+    and handle inserts and removals without walking the source model.
   */
 class HistoryFilterModel : public QAbstractProxyModel
 {
@@ -135,14 +184,35 @@ private slots:
     void sourceReset();
     void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
     void sourceRowsInserted(const QModelIndex &parent, int start, int end);
-    void sourceRowsRemoved(const QModelIndex &, int, int);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end);
+    void sourceRowsRemoved(const QModelIndex &parent, int start, int end);
 
 private:
     void load() const;
-
-    mutable QList<int> m_sourceRow;
+    void insertNewerRows(int start, int end);
+    void appendOlderRows(int start, int end);
+    int sequenceForSourceRow(int row) const;
+    int sourceRowForSequence(int sequence) const;
+    void linkOccurrence(int newest, int sequence) const;
+    void growOccurrences(int sequence) const;
+    int &newerOccurrence(int sequence) const
+        { return m_newerOccurrence[HistoryRankDeque::slot(sequence)]; }
+    int &olderOccurrence(int sequence) const
+        { return m_olderOccurrence[HistoryRankDeque::slot(sequence)]; }
+
+    // Newer source rows are pushed to the front, older ones that are
+    // loaded later to the back
+    mutable HistoryRankDeque m_sourceRows;
+    mutable HistoryRankDeque m_filteredRows;
+    // Links between the entries of the same url, newer and older.  They
+    // wrap around so the newer link of the newest entry is the oldest one.
+    mutable QVector<int> m_newerOccurrence;
+    mutable QVector<int> m_olderOccurrence;
+    // url to the sequence number of its newest entry
     mutable QHash<QString, int> m_historyHash;
     mutable bool m_loaded;
+    QList<QPair<int, QString> > m_removing;
+    bool m_removingRows;
 };
 
 /*
@@ -201,30 +271,10 @@ private:
     QList<QAction*> m_initialActions;
 };
 
-// proxy model for the history model that
-// exposes each url http://www.foo.com and it url starting at the host www.foo.com
-class HistoryCompletionModel : public QAbstractProxyModel
-{
-    Q_OBJECT
-
-public:
-    HistoryCompletionModel(QObject *parent = 0);
-    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
-    int rowCount(const QModelIndex &parent = QModelIndex()) const;
-    int columnCount(const QModelIndex &parent = QModelIndex()) const;
-    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const;
-    QModelIndex mapToSource(const QModelIndex &proxyIndex) const;
-    QModelIndex index(int, int, const QModelIndex &parent = QModelIndex()) const;
-    QModelIndex parent(const QModelIndex &index = QModelIndex()) const;
-    void setSourceModel(QAbstractItemModel *sourceModel);
-
-private slots:
-    void sourceReset();
-
-};
-
 // proxy model for the history model that converts the list
 // into a tree, one top level node per day.
+// The days are found when the source is set or reset and then kept up to
+// date as rows come and go.
 // Used in the HistoryDialog.
 class HistoryTreeModel : public QAbstractProxyModel
 {
@@ -249,12 +299,42 @@ public:
 private slots:
     void sourceReset();
     void sourceRowsInserted(const QModelIndex &parent, int start, int end);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end);
     void sourceRowsRemoved(const QModelIndex &parent, int start, int end);
 
 private:
+    enum RemovingState {
+        NotRemoving,
+        RemovingPages,
+        RemovingDates
+    };
+
+    void load();
+    int dayId(int row) const;
+    int sourceRow(int offset) const;
     int sourceDateRow(int row) const;
-    mutable QList<int> m_sourceRowCache;
-    bool removingDown;
+    int sourceDateEnd(int row) const;
+    QDate sourceDate(int row) const;
+    int dateRow(int sourceRow) const;
+    int addDay(const QDate &date, int count, bool front);
+    bool insertRun(int start, int end, const QDate &date);
+
+    // Every date that was seen has an id in both deques, newer dates at
+    // the front.  m_days counts the dates that are shown and m_dayRows
+    // the source rows of each date, so top level rows and source rows
+    // are mapped in O(log n).  Dates that go away keep their id and count
+    // nothing until they come back.
+    HistoryRankDeque m_days;
+    HistoryRankDeque m_dayRows;
+    // The date of each id, by HistoryRankDeque::slot()
+    QVector<QDate> m_dayDates;
+    QMap<QDate, int> m_dayIds;
+    RemovingState m_removing;
+    int m_removingFirst;
+    // Source rows that are about to be removed and no date covers anymore,
+    // m_dayRows already leaves them out
+    int m_holeStart;
+    int m_holeEnd;
 
 };
 
@@ -272,6 +352,60 @@ protected:
     bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const;
 };
 
+class HistorySearchIndex;
+
+/*
+    Filters the pages of a HistoryTreeModel for the HistoryDialog, every
+    date is kept like in TreeProxyModel.  The pages that are shown come
+    from looking up the matches of a HistorySearchIndex in the history
+    instead of from checking every row.
+  */
+class HistoryProxyModel : public QAbstractProxyModel
+{
+    Q_OBJECT
+
+public:
+    HistoryProxyModel(HistoryManager *history, QObject *parent = 0);
+
+    HistorySearchIndex *searchIndex() const;
+
+    void setSourceModel(QAbstractItemModel *sourceModel);
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const;
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const;
+    QModelIndex parent(const QModelIndex &index) const;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex());
+
+public slots:
+    void setSearchText(const QString &text);
+
+private slots:
+    void sourceReset();
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+    void sourceRowsInserted(const QModelIndex &parent, int start, int end);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int start, int end);
+    void sourceRowsRemoved(const QModelIndex &parent, int start, int end);
+
+private:
+    bool filtering() const;
+    void loadMatches();
+    QList<int> matchingPages(int date) const;
+    bool pageMatches(const QModelIndex &sourceIndex) const;
+
+    HistoryManager *m_history;
+    HistorySearchIndex *m_searchIndex;
+    // The source rows of the pages that are shown for each date, sorted
+    QList<QList<int> > m_pages;
+    // What is being removed between the two remove signals of the source
+    int m_removingDate;
+    int m_removingFirst;
+    int m_removingLast;
+    bool m_removingRows;
+};
+
 #include "ui_history.h"
 
 class HistoryDialog : public QDialog, public Ui_HistoryDialog
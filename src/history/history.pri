@@ -3,11 +3,15 @@ DEPENDPATH += $$PWD
 
 HEADERS += \
   history.h \
-  historymanager.h
+  historymanager.h \
+  historysearchindex.h \
+  historystore.h
 
 SOURCES += \
   history.cpp \
-  historymanager.cpp
+  historymanager.cpp \
+  historysearchindex.cpp \
+  historystore.cpp
 
 FORMS += \
     history.ui
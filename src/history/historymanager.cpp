@@ -64,13 +64,14 @@
 
 #include "autosaver.h"
 #include "history.h"
+#include "historystore.h"
 
 #include <qbuffer.h>
 #include <qdesktopservices.h>
 #include <qdir.h>
 #include <qfile.h>
+#include <qset.h>
 #include <qsettings.h>
-#include <qtemporaryfile.h>
 #include <qwebhistoryinterface.h>
 #include <qwebsettings.h>
 
@@ -89,27 +90,278 @@ QString HistoryEntry::userTitle() const
 }
 
 static const unsigned int HISTORY_VERSION = 23;
+// Entries the loader has read are added to the history in batches, one per
+// pass of the event loop, growing so that the models don't get too many
+static const int FIRST_LOAD_BATCH = 1000;
+static const int MAXIMUM_LOAD_BATCH = 16000;
 
-HistoryManager::HistoryManager(QObject *parent)
+// Urls are kept in the history without a password and with a lower case host
+static QString historyUrl(const QUrl &url)
+{
+    QUrl cleanUrl(url);
+    cleanUrl.setPassword(QString());
+    cleanUrl.setHost(cleanUrl.host().toLower());
+    return cleanUrl.toString();
+}
+
+static QString dataDirectory()
+{
+    QString directory = QDesktopServices::storageLocation(QDesktopServices::DataLocation);
+    if (directory.isEmpty())
+        directory = QDir::homePath() + QLatin1String("/.") + QCoreApplication::applicationName();
+    return directory;
+}
+
+void HistoryRankTree::clear()
+{
+    m_tree.resize(1);
+    m_tree[0] = 0;
+    m_total = 0;
+}
+
+void HistoryRankTree::append(int value)
+{
+    int index = m_tree.count();
+    // The new node covers (index - lowbit(index), index]
+    int lowBit = index & -index;
+    m_tree.append(value + prefix(index - 1) - prefix(index - lowBit));
+    m_total += value;
+}
+
+void HistoryRankTree::add(int index, int delta)
+{
+    int count = size();
+    for (; index <= count && index > 0; index += index & -index)
+        m_tree[index] += delta;
+    m_total += delta;
+}
+
+int HistoryRankTree::value(int index) const
+{
+    return prefix(index) - prefix(index - 1);
+}
+
+int HistoryRankTree::prefix(int index) const
+{
+    int sum = 0;
+    for (index = qMin(index, size()); index > 0; index -= index & -index)
+        sum += m_tree.at(index);
+    return sum;
+}
+
+// Returns the smallest index whose prefix sum is at least n
+int HistoryRankTree::find(int n) const
+{
+    int count = size();
+    int bit = 1;
+    while (bit * 2 <= count)
+        bit *= 2;
+    int index = 0;
+    for (; bit > 0; bit /= 2) {
+        int next = index + bit;
+        if (next <= count && m_tree.at(next) < n) {
+            index = next;
+            n -= m_tree.at(next);
+        }
+    }
+    return index + 1;
+}
+
+void HistoryRankDeque::clear()
+{
+    m_front.clear();
+    m_back.clear();
+}
+
+bool HistoryRankDeque::contains(int id) const
+{
+    if (id > 0)
+        return id <= m_front.size();
+    return id < 0 && -id <= m_back.size();
+}
+
+int HistoryRankDeque::pushFront(int value)
+{
+    m_front.append(value);
+    return m_front.size();
+}
+
+int HistoryRankDeque::pushBack(int value)
+{
+    m_back.append(value);
+    return -m_back.size();
+}
+
+void HistoryRankDeque::add(int id, int delta)
+{
+    if (id > 0)
+        m_front.add(id, delta);
+    else
+        m_back.add(-id, delta);
+}
+
+int HistoryRankDeque::value(int id) const
+{
+    if (id > 0)
+        return m_front.value(id);
+    return m_back.value(-id);
+}
+
+// The front tree counts from the oldest and the back tree from the newest
+int HistoryRankDeque::row(int id) const
+{
+    if (id > 0)
+        return m_front.total() - m_front.prefix(id);
+    return m_front.total() + m_back.prefix(-id - 1);
+}
+
+int HistoryRankDeque::find(int row) const
+{
+    if (row < m_front.total())
+        return m_front.find(m_front.total() - row);
+    return -m_back.find(row - m_front.total() + 1);
+}
+
+HistoryUrlTable::HistoryUrlTable()
+    : m_entries(1)
+{
+}
+
+void HistoryUrlTable::clear()
+{
+    m_entries.resize(1);
+    m_ids.clear();
+    m_rows.clear();
+}
+
+int HistoryUrlTable::count() const
+{
+    return m_rows.total();
+}
+
+int HistoryUrlTable::row(const QString &url) const
+{
+    int id = m_ids.value(url);
+    if (!id)
+        return -1;
+    return m_rows.prefix(id) - 1;
+}
+
+const HistoryUrlEntry &HistoryUrlTable::at(int row) const
+{
+    return m_entries.at(m_rows.find(row + 1));
+}
+
+/*
+    Visits can be counted in any order, the dates are widened to include
+    \a item and the title of the newest visit that has one is kept.
+  */
+int HistoryUrlTable::addVisit(const HistoryEntry &item, int typed, bool *added)
+{
+    int id = m_ids.value(item.url);
+    if (added)
+        *added = !id;
+    if (!id) {
+        HistoryUrlEntry entry;
+        entry.url = item.url;
+        entry.title = item.title;
+        entry.visitCount = 1;
+        entry.typedCount = typed;
+        entry.firstVisit = item.dateTime;
+        entry.lastVisit = item.dateTime;
+        return append(entry);
+    }
+
+    HistoryUrlEntry &entry = m_entries[id];
+    ++entry.visitCount;
+    entry.typedCount += typed;
+    if (item.dateTime < entry.firstVisit)
+        entry.firstVisit = item.dateTime;
+    if (item.dateTime >= entry.lastVisit) {
+        entry.lastVisit = item.dateTime;
+        if (!item.title.isEmpty())
+            entry.title = item.title;
+    } else if (entry.title.isEmpty()) {
+        entry.title = item.title;
+    }
+    return m_rows.prefix(id) - 1;
+}
+
+// New urls always go at the end
+int HistoryUrlTable::append(const HistoryUrlEntry &entry)
+{
+    m_entries.append(entry);
+    m_rows.append(1);
+    m_ids.insert(entry.url, m_entries.count() - 1);
+    return m_rows.total() - 1;
+}
+
+void HistoryUrlTable::replace(int row, const HistoryUrlEntry &entry)
+{
+    m_entries[m_rows.find(row + 1)] = entry;
+}
+
+void HistoryUrlTable::remove(const QString &url)
+{
+    int id = m_ids.take(url);
+    if (!id)
+        return;
+    m_rows.add(id, -1);
+    m_entries[id] = HistoryUrlEntry();
+    if (m_rows.size() > 2 * m_rows.total() + 1024)
+        compact();
+}
+
+// Drop the holes left by removed urls, rows don't change
+void HistoryUrlTable::compact()
+{
+    QList<HistoryUrlEntry> entries;
+    for (int i = 1; i < m_entries.count(); ++i) {
+        if (m_rows.value(i))
+            entries.append(m_entries.at(i));
+    }
+    clear();
+    m_entries.reserve(entries.count() + 1);
+    foreach (const HistoryUrlEntry &entry, entries)
+        append(entry);
+}
+
+HistoryManager::HistoryManager(QObject *parent, LoadMode mode)
     : QWebHistoryInterface(parent)
     , m_saveTimer(new AutoSaver(this))
     , m_daysToExpire(30)
+    , m_urlsChanged(false)
+    , m_store(new HistoryStore)
+    , m_compactOnSave(false)
+    , m_unsavedEntries(0)
+    , m_expiredSinceSave(false)
+    , m_loader(0)
+    , m_loading(false)
+    , m_loadedOffset(0)
+    , m_loadBatchSize(FIRST_LOAD_BATCH)
+    , m_loadedNeedToSort(false)
     , m_historyModel(0)
     , m_historyFilterModel(0)
     , m_historyTreeModel(0)
+    , m_historyUrlModel(0)
 {
     m_expiredTimer.setSingleShot(true);
     connect(&m_expiredTimer, SIGNAL(timeout()),
             this, SLOT(checkForExpired()));
+    m_loadTimer.setSingleShot(true);
+    m_loadTimer.setInterval(0);
+    connect(&m_loadTimer, SIGNAL(timeout()),
+            this, SLOT(loadNextBatch()));
     connect(this, SIGNAL(entryAdded(const HistoryEntry &)),
             m_saveTimer, SLOT(changeOccurred()));
     connect(this, SIGNAL(entryRemoved(const HistoryEntry &)),
             m_saveTimer, SLOT(changeOccurred()));
-    load();
+    load(mode);
 
     m_historyModel = new HistoryModel(this, this);
     m_historyFilterModel = new HistoryFilterModel(m_historyModel, this);
     m_historyTreeModel = new HistoryTreeModel(m_historyFilterModel, this);
+    m_historyUrlModel = new HistoryUrlModel(this, this);
 
     // QWebHistoryInterface will delete the history manager
     QWebHistoryInterface::setDefaultInterface(this);
@@ -117,10 +369,12 @@ HistoryManager::HistoryManager(QObject *parent)
 
 HistoryManager::~HistoryManager()
 {
+    finishLoading(true);
     // remove history items on application exit
     if (m_daysToExpire == -2)
         clear();
     m_saveTimer->saveIfNeccessary();
+    delete m_store;
 }
 
 QList<HistoryEntry> HistoryManager::history() const
@@ -130,35 +384,106 @@ QList<HistoryEntry> HistoryManager::history() const
 
 bool HistoryManager::historyContains(const QString &url) const
 {
-    return m_historyFilterModel->historyContains(url);
+    if (m_historyFilterModel->historyContains(url))
+        return true;
+    // WebKit asks for every link, while loading the url table read by
+    // the loader answers for the visits that are not added yet
+    if (m_loading) {
+        int row = m_loadedUrls.row(url);
+        if (row != -1 && m_loadedUrls.at(row).lastVisit >= m_loadedSince)
+            return true;
+    }
+    return false;
+}
+
+bool HistoryManager::isLoading() const
+{
+    return m_loading;
+}
+
+/*
+    Blocks until a background load is done and adds everything that
+    it read to the history.
+  */
+void HistoryManager::waitForLoaded()
+{
+    finishLoading(true);
 }
 
 void HistoryManager::addHistoryEntry(const QString &url)
 {
-    QUrl cleanUrl(url);
-    cleanUrl.setPassword(QString());
-    cleanUrl.setHost(cleanUrl.host().toLower());
-    HistoryEntry item(atomicString(cleanUrl.toString()), QDateTime::currentDateTime());
+    HistoryEntry item(atomicString(historyUrl(QUrl(url))), QDateTime::currentDateTime());
     addHistoryEntry(item);
 }
 
+/*
+    Only the next visit is counted as typed so that a url that was
+    typed but never loaded doesn't count the visit after it.
+  */
+void HistoryManager::setTypedUrl(const QUrl &url)
+{
+    m_typedUrl = historyUrl(url);
+}
+
+int HistoryManager::urlEntryCount() const
+{
+    return m_urls.count();
+}
+
+HistoryUrlEntry HistoryManager::urlEntryAt(int row) const
+{
+    return m_urls.at(row);
+}
+
+HistoryUrlEntry HistoryManager::urlEntry(const QString &url) const
+{
+    int row = m_urls.row(url);
+    if (row < 0)
+        return HistoryUrlEntry();
+    return m_urls.at(row);
+}
+
+HistoryEntry HistoryManager::newestEntry(const QString &url) const
+{
+    int position = newestPosition(url);
+    if (position == -1)
+        return HistoryEntry();
+    return m_history.at(position);
+}
+
+int HistoryManager::newestPosition(const QString &url) const
+{
+    int sequence = m_urlIndex.value(url);
+    if (!sequence)
+        return -1;
+    return positionForSequence(sequence);
+}
+
 void HistoryManager::setHistory(const QList<HistoryEntry> &history, bool loadedAndSorted)
 {
+    finishLoading(false);
     m_history = history;
 
     // verify that it is sorted by date
     if (!loadedAndSorted)
         qSort(m_history.begin(), m_history.end());
 
+    rebuildUrlIndex();
+    rebuildUrlTable();
     checkForExpired();
 
+    m_unsavedEntries = 0;
+    m_unsavedTitles.clear();
+    m_unsavedRemovals.clear();
+    m_unsavedRangeRemovals.clear();
     if (loadedAndSorted) {
-        m_lastSavedUrl = m_history.value(0).url;
+        m_compactOnSave = false;
     } else {
-        m_lastSavedUrl.clear();
+        m_compactOnSave = true;
         m_saveTimer->changeOccurred();
     }
     emit historyReset();
+    emit urlEntriesReset();
 }
 
 HistoryModel *HistoryManager::historyModel() const
@@ -176,33 +501,38 @@ HistoryTreeModel *HistoryManager::historyTreeModel() const
     return m_historyTreeModel;
 }
 
+HistoryUrlModel *HistoryManager::historyUrlModel() const
+{
+    return m_historyUrlModel;
+}
+
 void HistoryManager::checkForExpired()
 {
     if (m_daysToExpire < 0 || m_history.isEmpty())
         return;
 
     QDateTime now = QDateTime::currentDateTime();
-    int nextTimeout = 0;
+    QDateTime expired = now;
+    expired.setDate(expired.date().addDays(-m_daysToExpire));
+    removeEntriesBetween(QDateTime(), expired.addMSecs(1));
 
-    while (!m_history.isEmpty()) {
+    if (!m_history.isEmpty()) {
         QDateTime checkForExpired = m_history.last().dateTime;
         checkForExpired.setDate(checkForExpired.date().addDays(m_daysToExpire));
+        int nextTimeout;
         if (now.daysTo(checkForExpired) > 7) {
             // check at most in a week to prevent int overflows on the timer
             nextTimeout = 7 * 86400;
         } else {
-            nextTimeout = now.secsTo(checkForExpired);
+            nextTimeout = qMax(1, now.secsTo(checkForExpired));
         }
-        if (nextTimeout > 0)
-            break;
-        HistoryEntry item = m_history.takeLast();
-        // remove from saved file also
-        m_lastSavedUrl.clear();
-        emit entryRemoved(item);
+        m_expiredTimer.start(nextTimeout * 1000);
     }
 
-    if (nextTimeout > 0)
-        m_expiredTimer.start(nextTimeout * 1000);
+    // Don't let the sequence numbers of expired entries pile up forever,
+    // loaded entries still need the chains to be as they are
+    if (!isLoading() && m_liveEntries.size() > 2 * m_history.count() + 1024)
+        rebuildUrlIndex();
 }
 
 void HistoryManager::addHistoryEntry(const HistoryEntry &item)
@@ -212,6 +542,23 @@ void HistoryManager::addHistoryEntry(const HistoryEntry &item)
         return;
 
     m_history.prepend(item);
+    indexEntry(item.url);
+    ++m_unsavedEntries;
+
+    // The url table goes first so that the models can already use it
+    int typed = 0;
+    if (!m_typedUrl.isEmpty() && m_typedUrl == item.url) {
+        typed = 1;
+        m_typedUrl.clear();
+        m_urlsChanged = true;
+    }
+    bool added;
+    int row = m_urls.addVisit(item, typed, &added);
+    if (added)
+        emit urlEntryAdded(row);
+    else
+        emit urlEntryUpdated(row);
+
     emit entryAdded(item);
     if (m_history.count() == 1)
         checkForExpired();
@@ -219,34 +566,177 @@ void HistoryManager::addHistoryEntry(const HistoryEntry &item)
 
 void HistoryManager::updateHistoryEntry(const QUrl &url, const QString &title)
 {
-    for (int i = 0; i < m_history.count(); ++i) {
-        if (url == m_history.at(i).url) {
-            m_history[i].title = atomicString(title);
-            m_saveTimer->changeOccurred();
-            if (m_lastSavedUrl.isEmpty())
-                m_lastSavedUrl = m_history.at(i).url;
-            emit entryUpdated(i);
-            break;
-        }
+    int i = newestPosition(url.toString());
+    if (i == -1) {
+        // The newest visit could still be on its way from the loader
+        if (isLoading())
+            m_pendingTitles.insert(url.toString(), atomicString(title));
+        return;
     }
+    m_history[i].title = atomicString(title);
+    if (i >= m_unsavedEntries)
+        m_unsavedTitles.append(m_history.at(i));
+    m_saveTimer->changeOccurred();
+
+    int row = m_urls.row(m_history.at(i).url);
+    HistoryUrlEntry entry = m_urls.at(row);
+    entry.title = m_history.at(i).title;
+    m_urls.replace(row, entry);
+    emit urlEntryUpdated(row);
+
+    emit entryUpdated(i);
 }
 
 void HistoryManager::removeHistoryEntry(const HistoryEntry &item)
 {
-    m_lastSavedUrl.clear();
-    m_history.removeOne(item);
+    int sequence = m_urlIndex.value(item.url);
+    for (; sequence; sequence = olderEntry(sequence)) {
+        int position = positionForSequence(sequence);
+        if (m_history.at(position) == item) {
+            emit entryAboutToBeRemoved(position);
+            int newer = newerEntry(sequence);
+            unindexEntry(sequence, item.url);
+            m_history.removeAt(position);
+            removeUrlVisits(item.url, 1, newer);
+            if (position < m_unsavedEntries)
+                --m_unsavedEntries;
+            else
+                m_unsavedRemovals.append(item);
+            break;
+        }
+    }
+    if (!sequence && isLoading())
+        m_pendingRemovals.append(item);
     emit entryRemoved(item);
 }
 
+/*
+    Removes the newest visit to \a url, with \a title if that is given.
+  */
 void HistoryManager::removeHistoryEntry(const QUrl &url, const QString &title)
 {
-    for (int i = 0; i < m_history.count(); ++i) {
-        if (url == m_history.at(i).url
-            && (title.isEmpty() || title == m_history.at(i).title)) {
-            removeHistoryEntry(m_history.at(i));
-            break;
+    QString urlString = url.toString();
+    int sequence = m_urlIndex.value(urlString);
+    for (; sequence; sequence = olderEntry(sequence)) {
+        int position = positionForSequence(sequence);
+        if (title.isEmpty() || title == m_history.at(position).title) {
+            HistoryEntry item = m_history.at(position);
+            removeHistoryEntry(item);
+            return;
+        }
+    }
+    // An invalid date matches any visit when the loaded entries are added
+    if (isLoading())
+        m_pendingRemovals.append(HistoryEntry(urlString, QDateTime(), title));
+}
+
+/*
+    Removes every entry from \a from up to but not including \a to as one
+    block, models see a single removal instead of one per entry.  An invalid
+    \a from or \a to leaves that end of the range open.
+  */
+/*
+    Removes the entries from \a from up to \a to as asked for by the user,
+    they are not just hidden but also taken out of the files on the next
+    save.
+  */
+void HistoryManager::removeHistoryEntries(const QDateTime &from, const QDateTime &to)
+{
+    removeEntriesBetween(from, to);
+    m_compactOnSave = true;
+    m_saveTimer->changeOccurred();
+}
+
+void HistoryManager::removeEntriesBetween(const QDateTime &from, const QDateTime &to)
+{
+    // Entries that are still being loaded could be in the range too
+    if (isLoading())
+        m_pendingRangeRemovals.append(qMakePair(from, to));
+
+    // History is sorted newest first so the range is one run of entries
+    QList<HistoryEntry>::iterator begin = m_history.begin();
+    if (to.isValid())
+        begin = qUpperBound(m_history.begin(), m_history.end(), HistoryEntry(QString(), to));
+    QList<HistoryEntry>::iterator end = m_history.end();
+    if (from.isValid())
+        end = qUpperBound(begin, m_history.end(), HistoryEntry(QString(), from));
+    removeEntries(begin - m_history.begin(), end - begin);
+}
+
+/*
+    Removes the \a count entries from \a offset on, counting from the newest,
+    as one block.  Used when rows are removed from the history model.
+  */
+void HistoryManager::removeHistoryEntries(int offset, int count)
+{
+    if (offset < 0 || count <= 0 || offset + count > m_history.count())
+        return;
+    removeEntries(offset, count);
+}
+
+void HistoryManager::removeEntries(int first, int count)
+{
+    if (count <= 0)
+        return;
+
+    emit entriesAboutToBeRemoved(first, count);
+    // Oldest first, taking out an older entry doesn't move the newer ones.
+    // For every url remember how many visits went and the visit right
+    // after the block, which is the oldest one left if none are older.
+    QStringList urls;
+    QHash<QString, QPair<int, int> > removedVisits;
+    for (int i = first + count - 1; i >= first; --i) {
+        int sequence = sequenceForPosition(i);
+        const QString &url = m_history.at(i).url;
+        QHash<QString, QPair<int, int> >::iterator it = removedVisits.find(url);
+        if (it == removedVisits.end()) {
+            urls.append(url);
+            it = removedVisits.insert(url, qMakePair(0, 0));
+        }
+        ++it.value().first;
+        it.value().second = newerEntry(sequence);
+        unindexEntry(sequence, url);
+    }
+    QList<HistoryEntry> items = m_history.mid(first, count);
+    m_history.erase(m_history.begin() + first, m_history.begin() + first + count);
+
+    foreach (const QString &url, urls) {
+        QPair<int, int> removed = removedVisits.value(url);
+        removeUrlVisits(url, removed.first, removed.second);
+    }
+
+    // The store removes by date, that only works when none of the entries
+    // that are kept have the same date as the newest or oldest removed one
+    QDateTime newer;
+    if (first > 0)
+        newer = m_history.at(first - 1).dateTime;
+    QDateTime older;
+    if (first < m_history.count())
+        older = m_history.at(first).dateTime;
+    else if (isLoading())
+        older = items.last().dateTime;
+    bool oldest = !older.isValid();
+    bool newest = (!newer.isValid() && older != items.last().dateTime);
+
+    int savedFrom = qMax(0, m_unsavedEntries - first);
+    m_unsavedEntries -= qMin(savedFrom, count);
+    if (savedFrom < count) {
+        if (oldest && newer != items.first().dateTime) {
+            // Like expired entries, the store skips these when loading
+            if (m_expiredBefore <= items.first().dateTime)
+                m_expiredBefore = items.first().dateTime.addMSecs(1);
+            m_expiredSinceSave = true;
+        } else if (newest) {
+            // Everything in the store from the oldest of them on is gone
+            m_unsavedRangeRemovals.append(items.last().dateTime);
+        } else {
+            for (int i = savedFrom; i < count; ++i)
+                m_unsavedRemovals.append(items.at(i));
         }
     }
+    m_saveTimer->changeOccurred();
+
+    emit entriesRemoved(first, items);
 }
 
 int HistoryManager::daysToExpire() const
@@ -265,12 +755,21 @@ void HistoryManager::setDaysToExpire(int limit)
 
 void HistoryManager::clear()
 {
+    finishLoading(false);
     m_history.clear();
+    rebuildUrlIndex();
+    rebuildUrlTable();
+    m_typedUrl.clear();
     m_atomicStringHash.clear();
-    m_lastSavedUrl.clear();
+    m_compactOnSave = true;
+    m_unsavedEntries = 0;
+    m_unsavedTitles.clear();
+    m_unsavedRemovals.clear();
+    m_unsavedRangeRemovals.clear();
     m_saveTimer->changeOccurred();
     m_saveTimer->saveIfNeccessary();
     emit historyReset();
+    emit urlEntriesReset();
     emit historyCleared();
 }
 
@@ -282,12 +781,303 @@ void HistoryManager::loadSettings()
     m_daysToExpire = settings.value(QLatin1String("historyLimit"), 30).toInt();
 }
 
-void HistoryManager::load()
+void HistoryManager::load(LoadMode mode)
 {
     loadSettings();
 
-    QFile historyFile(QDesktopServices::storageLocation(QDesktopServices::DataLocation)
-                      + QLatin1String("/history"));
+    QSettings settings;
+    settings.beginGroup(QLatin1String("history"));
+    m_expiredBefore = settings.value(QLatin1String("expiredBefore")).toDateTime();
+
+    QString directory = dataDirectory();
+    m_store->setDirectory(directory + QLatin1String("/historystore"));
+    if (m_store->isEmpty()) {
+        loadLegacy(directory + QLatin1String("/history"));
+        return;
+    }
+
+    // Only the entries that will be shown are read in
+    QDateTime since = m_expiredBefore;
+    if (m_daysToExpire >= 0) {
+        QDateTime expired = QDateTime::currentDateTime();
+        expired.setDate(expired.date().addDays(-m_daysToExpire));
+        if (!since.isValid() || since < expired)
+            since = expired;
+    }
+
+    if (mode == LoadInBackground) {
+        m_loading = true;
+        m_loadBatchSize = FIRST_LOAD_BATCH;
+        m_loadedSince = since;
+        m_loader = new HistoryLoader(m_store, since, this);
+        connect(m_loader, SIGNAL(urlsLoaded()),
+                this, SLOT(takeLoadedUrls()));
+        connect(m_loader, SIGNAL(entriesLoaded()),
+                this, SLOT(takeLoadedEntries()));
+        connect(m_loader, SIGNAL(finished()),
+                this, SLOT(loaderFinished()));
+        m_loader->start(QThread::LowPriority);
+        return;
+    }
+
+    bool needToSort = false;
+    QList<HistoryEntry> list = m_store->load(since, &needToSort);
+    for (int i = 0; i < list.count(); ++i) {
+        HistoryEntry &item = list[i];
+        item.url = atomicString(item.url);
+        item.title = atomicString(item.title);
+    }
+
+    setHistory(list, true);
+    restoreTypedCounts(m_store->loadUrls());
+
+    // If we had to sort or most of the store is garbage re-write it
+    if (needToSort || m_store->needsCompaction()) {
+        m_compactOnSave = true;
+        m_saveTimer->changeOccurred();
+    }
+}
+
+void HistoryManager::takeLoadedUrls()
+{
+    if (!m_loader)
+        return;
+    m_loadedUrls = m_loader->urls();
+    // Links that were shown before are now known to be visited
+    refreshVisitedLinks();
+}
+
+// Picks up what the loader has read so far
+void HistoryManager::takeLoadedEntries()
+{
+    if (!m_loader)
+        return;
+    m_loadedEntries += m_loader->takeEntries();
+    m_loadedNeedToSort = m_loader->needToSort();
+    if (!m_loadTimer.isActive())
+        loadNextBatch();
+}
+
+void HistoryManager::loaderFinished()
+{
+    if (!m_loader)
+        return;
+    m_loader->wait();
+    m_loadedEntries += m_loader->takeEntries();
+    m_loadedNeedToSort = m_loader->needToSort();
+    m_loadedUrls = m_loader->urls();
+    m_loader->deleteLater();
+    m_loader = 0;
+    loadNextBatch();
+}
+
+// Add the next and older part of what the loader read to the history
+void HistoryManager::loadNextBatch()
+{
+    appendLoadedEntries(m_loadBatchSize);
+    m_loadBatchSize = qMin(m_loadBatchSize * 2, MAXIMUM_LOAD_BATCH);
+    if (m_loadedOffset < m_loadedEntries.count() && !m_loadedNeedToSort)
+        m_loadTimer.start();
+}
+
+/*
+    With \a keepEntries everything the loader read is added to the history
+    at once, otherwise it is thrown away because the history is replaced.
+  */
+void HistoryManager::finishLoading(bool keepEntries)
+{
+    if (!keepEntries) {
+        if (m_loader) {
+            m_loader->wait();
+            m_loader->deleteLater();
+            m_loader = 0;
+        }
+        m_loading = false;
+        m_loadTimer.stop();
+        m_loadedEntries.clear();
+        m_loadedOffset = 0;
+        m_loadedUrls.clear();
+        m_oldestEntry.clear();
+        m_pendingTitles.clear();
+        m_pendingRemovals.clear();
+        m_pendingRangeRemovals.clear();
+        return;
+    }
+    loaderFinished();
+    appendLoadedEntries(m_loadedEntries.count() - m_loadedOffset);
+}
+
+/*
+    The loaded entries are older than anything added to the history
+    while they were being read, so they go at the end.  Once the loader
+    is done and everything is added the history is checked like after
+    loading it in one go.
+  */
+void HistoryManager::appendLoadedEntries(int count)
+{
+    if (!m_loading)
+        return;
+
+    // The models expect the history to be sorted, an unsorted store
+    // is added in one go once it has been read completely
+    if (m_loadedNeedToSort) {
+        if (!m_loader)
+            sortLoadedEntries();
+        return;
+    }
+
+    count = qMin(count, m_loadedEntries.count() - m_loadedOffset);
+    if (count > 0) {
+        int offset = m_history.count();
+        int urlCount = m_urls.count();
+        QList<int> updatedUrls;
+        QSet<int> updated;
+        int end = m_loadedOffset + count;
+        for (; m_loadedOffset < end; ++m_loadedOffset) {
+            HistoryEntry item = m_loadedEntries.at(m_loadedOffset);
+            if (!applyPendingEdits(item))
+                continue;
+            item.url = atomicString(item.url);
+            item.title = atomicString(item.title);
+            m_history.append(item);
+            indexLoadedEntry(item.url);
+            int row = m_urls.addVisit(item);
+            if (row < urlCount && !updated.contains(row)) {
+                updated.insert(row);
+                updatedUrls.append(row);
+            }
+        }
+        if (m_history.count() > offset)
+            emit entriesLoaded(offset, m_history.count() - offset);
+        if (m_urls.count() > urlCount)
+            emit urlEntriesAdded(urlCount, m_urls.count() - urlCount);
+        foreach (int row, updatedUrls)
+            emit urlEntryUpdated(row);
+    }
+
+    if (m_loader || m_loadedOffset < m_loadedEntries.count())
+        return;
+
+    m_loading = false;
+    m_loadedEntries.clear();
+    m_loadedOffset = 0;
+    m_oldestEntry.clear();
+    m_pendingTitles.clear();
+    m_pendingRemovals.clear();
+    m_pendingRangeRemovals.clear();
+    restoreTypedCounts(m_loadedUrls, true);
+    m_loadedUrls.clear();
+    // Removals made while loading may have been answered from the url table
+    refreshVisitedLinks();
+    checkForExpired();
+    // If most of the store is garbage re-write it
+    if (m_store->needsCompaction()) {
+        m_compactOnSave = true;
+        m_saveTimer->changeOccurred();
+    }
+}
+
+/*
+    The store wasn't sorted, so the loaded entries can't simply go at the
+    end.  Everything is sorted and the models start over, the store is
+    rewritten sorted on the next save.
+  */
+void HistoryManager::sortLoadedEntries()
+{
+    for (int i = m_loadedOffset; i < m_loadedEntries.count(); ++i) {
+        HistoryEntry item = m_loadedEntries.at(i);
+        if (!applyPendingEdits(item))
+            continue;
+        item.url = atomicString(item.url);
+        item.title = atomicString(item.title);
+        m_history.append(item);
+    }
+    qStableSort(m_history.begin(), m_history.end());
+
+    m_loading = false;
+    m_loadedEntries.clear();
+    m_loadedOffset = 0;
+    m_pendingTitles.clear();
+    m_pendingRemovals.clear();
+    m_pendingRangeRemovals.clear();
+    rebuildUrlIndex();
+    rebuildUrlTable();
+    restoreTypedCounts(m_loadedUrls);
+    m_loadedUrls.clear();
+    refreshVisitedLinks();
+    m_compactOnSave = true;
+    m_saveTimer->changeOccurred();
+    emit historyReset();
+    emit urlEntriesReset();
+    checkForExpired();
+}
+
+/*
+    WebKit remembers what historyContains() said about every link, setting
+    the interface again makes it forget and ask again when repainting.
+  */
+void HistoryManager::refreshVisitedLinks()
+{
+    if (QWebHistoryInterface::defaultInterface() != this)
+        return;
+    // QWebHistoryInterface deletes the interface it replaces unless it has a parent
+    QObject guard;
+    bool hasParent = parent();
+    if (!hasParent)
+        setParent(&guard);
+    QWebHistoryInterface::setDefaultInterface(0);
+    QWebHistoryInterface::setDefaultInterface(this);
+    if (!hasParent)
+        setParent(0);
+}
+
+/*
+    Applies the changes that were made to the history while \a item was
+    still being loaded, returns false if it has been removed.  Whatever
+    happens to it has to be saved as it is already in the store.
+  */
+bool HistoryManager::applyPendingEdits(HistoryEntry &item)
+{
+    for (int i = 0; i < m_pendingRangeRemovals.count(); ++i) {
+        const QPair<QDateTime, QDateTime> &range = m_pendingRangeRemovals.at(i);
+        if ((!range.first.isValid() || item.dateTime >= range.first)
+            && (!range.second.isValid() || item.dateTime < range.second)) {
+            m_unsavedRemovals.append(item);
+            m_saveTimer->changeOccurred();
+            return false;
+        }
+    }
+    for (int i = 0; i < m_pendingRemovals.count(); ++i) {
+        const HistoryEntry &removal = m_pendingRemovals.at(i);
+        if (removal.url == item.url
+            && (!removal.dateTime.isValid() || removal.dateTime == item.dateTime)
+            && (removal.title.isEmpty() || removal.title == item.title)) {
+            m_pendingRemovals.removeAt(i);
+            m_unsavedRemovals.append(item);
+            m_saveTimer->changeOccurred();
+            return false;
+        }
+    }
+    if (!m_pendingTitles.isEmpty()) {
+        QHash<QString, QString>::iterator it = m_pendingTitles.find(item.url);
+        // Only the newest visit of a url gets the title
+        if (it != m_pendingTitles.end()) {
+            item.title = it.value();
+            m_pendingTitles.erase(it);
+            m_unsavedTitles.append(item);
+            m_saveTimer->changeOccurred();
+        }
+    }
+    return true;
+}
+
+/*
+    Read the history file used before the history store existed,
+    it is converted to the store on the next save.
+  */
+void HistoryManager::loadLegacy(const QString &fileName)
+{
+    QFile historyFile(fileName);
     if (!historyFile.exists())
         return;
     if (!historyFile.open(QFile::ReadOnly)) {
@@ -341,13 +1131,168 @@ void HistoryManager::load()
 
     setHistory(list, true);
 
-    // If we had to sort re-write the whole history sorted
-    if (needToSort) {
-        m_lastSavedUrl.clear();
-        m_saveTimer->changeOccurred();
+    m_compactOnSave = true;
+    m_saveTimer->changeOccurred();
+}
+
+/*
+    Recreate the url index from m_history, sequence numbers start over.
+  */
+void HistoryManager::rebuildUrlIndex()
+{
+    m_liveEntries.clear();
+    m_urlIndex.clear();
+    m_oldestEntry.clear();
+    m_newerEntry.clear();
+    m_olderEntry.clear();
+    m_newerEntry.reserve(2 * m_history.count() + 2);
+    m_olderEntry.reserve(2 * m_history.count() + 2);
+    for (int i = m_history.count() - 1; i >= 0; --i)
+        indexEntry(m_history.at(i).url);
+}
+
+void HistoryManager::growLinks(int sequence)
+{
+    int slot = HistoryRankDeque::slot(sequence);
+    while (m_newerEntry.count() <= slot) {
+        m_newerEntry.append(0);
+        m_olderEntry.append(0);
+    }
+}
+
+// Gives the entry that was just prepended to m_history the next sequence number
+void HistoryManager::indexEntry(const QString &url)
+{
+    int sequence = m_liveEntries.pushFront(1);
+    growLinks(sequence);
+    int older = m_urlIndex.value(url);
+    olderEntry(sequence) = older;
+    if (older)
+        newerEntry(older) = sequence;
+    else if (isLoading())
+        m_oldestEntry.insert(url, sequence);
+    m_urlIndex.insert(url, sequence);
+}
+
+// Gives the entry that was just appended to m_history by the loader a number
+void HistoryManager::indexLoadedEntry(const QString &url)
+{
+    int sequence = m_liveEntries.pushBack(1);
+    growLinks(sequence);
+    QHash<QString, int>::iterator it = m_oldestEntry.find(url);
+    if (it == m_oldestEntry.end()) {
+        m_oldestEntry.insert(url, sequence);
+        m_urlIndex.insert(url, sequence);
+        return;
+    }
+    newerEntry(sequence) = it.value();
+    olderEntry(it.value()) = sequence;
+    it.value() = sequence;
+}
+
+void HistoryManager::unindexEntry(int sequence, const QString &url)
+{
+    m_liveEntries.add(sequence, -1);
+    int newer = newerEntry(sequence);
+    int older = olderEntry(sequence);
+    if (older)
+        newerEntry(older) = newer;
+    if (newer)
+        olderEntry(newer) = older;
+    else if (older)
+        m_urlIndex.insert(url, older);
+    else
+        m_urlIndex.remove(url);
+    if (!older && !m_oldestEntry.isEmpty()) {
+        if (newer)
+            m_oldestEntry.insert(url, newer);
+        else
+            m_oldestEntry.remove(url);
+    }
+    newerEntry(sequence) = 0;
+    olderEntry(sequence) = 0;
+}
+
+/*
+    Recreate the url table from m_history, the typed counts of urls
+    that are still in the history are kept.
+  */
+void HistoryManager::rebuildUrlTable()
+{
+    HistoryUrlTable typed;
+    for (int row = 0; row < m_urls.count(); ++row) {
+        if (m_urls.at(row).typedCount > 0)
+            typed.append(m_urls.at(row));
+    }
+    m_urls.clear();
+    for (int i = m_history.count() - 1; i >= 0; --i)
+        m_urls.addVisit(m_history.at(i));
+    restoreTypedCounts(typed);
+}
+
+/*
+    Typed counts can't be worked out from the visits so they come from
+    \a saved, with \a notify the rows that change are reported.
+  */
+void HistoryManager::restoreTypedCounts(const HistoryUrlTable &saved, bool notify)
+{
+    for (int i = 0; i < saved.count(); ++i) {
+        const HistoryUrlEntry &savedEntry = saved.at(i);
+        int row = m_urls.row(savedEntry.url);
+        if (row < 0 || savedEntry.typedCount <= 0)
+            continue;
+        HistoryUrlEntry entry = m_urls.at(row);
+        entry.typedCount = qMin(entry.typedCount + savedEntry.typedCount, entry.visitCount);
+        m_urls.replace(row, entry);
+        if (notify)
+            emit urlEntryUpdated(row);
     }
 }
 
+/*
+    Updates the url table after \a count visits to \a url that were next
+    to each other in the history have been unindexed.  \a newer is the
+    visit that came right after them, 0 if they were the newest.
+  */
+void HistoryManager::removeUrlVisits(const QString &url, int count, int newer)
+{
+    int row = m_urls.row(url);
+    if (row < 0)
+        return;
+
+    int newest = m_urlIndex.value(url);
+    if (!newest) {
+        emit urlEntryAboutToBeRemoved(row);
+        m_urls.remove(url);
+        emit urlEntryRemoved(row);
+        return;
+    }
+
+    HistoryUrlEntry entry = m_urls.at(row);
+    entry.visitCount = qMax(1, entry.visitCount - count);
+    entry.typedCount = qMin(entry.typedCount, entry.visitCount);
+    if (newer && !olderEntry(newer))
+        entry.firstVisit = m_history.at(positionForSequence(newer)).dateTime;
+    if (!newer) {
+        const HistoryEntry &previous = m_history.at(positionForSequence(newest));
+        entry.lastVisit = previous.dateTime;
+        if (!previous.title.isEmpty())
+            entry.title = previous.title;
+    }
+    m_urls.replace(row, entry);
+    emit urlEntryUpdated(row);
+}
+
+int HistoryManager::positionForSequence(int sequence) const
+{
+    return m_liveEntries.row(sequence);
+}
+
+int HistoryManager::sequenceForPosition(int position) const
+{
+    return m_liveEntries.find(position);
+}
+
 QString HistoryManager::atomicString(const QString &string) {
     QHash<QString, int>::const_iterator it = m_atomicStringHash.constFind(string);
     if (it == m_atomicStringHash.constEnd()) {
@@ -359,66 +1304,65 @@ QString HistoryManager::atomicString(const QString &string) {
 
 void HistoryManager::save()
 {
+    // The store belongs to the loader and a compaction now would lose
+    // the entries that are not in m_history yet
+    if (isLoading()) {
+        m_saveTimer->changeOccurred();
+        return;
+    }
+
     QSettings settings;
     settings.beginGroup(QLatin1String("history"));
     settings.setValue(QLatin1String("historyLimit"), m_daysToExpire);
+    settings.setValue(QLatin1String("expiredBefore"), m_expiredBefore);
 
-    bool saveAll = m_lastSavedUrl.isEmpty();
-    int first = m_history.count() - 1;
-    if (!saveAll) {
-        // find the first one to save
-        for (int i = 0; i < m_history.count(); ++i) {
-            if (m_history.at(i).url == m_lastSavedUrl) {
-                first = i - 1;
-                break;
-            }
-        }
-    }
-    if (first == m_history.count() - 1)
-        saveAll = true;
-
-    QString directory = QDesktopServices::storageLocation(QDesktopServices::DataLocation);
-    if (directory.isEmpty())
-        directory = QDir::homePath() + QLatin1String("/.") + QCoreApplication::applicationName();
+    QString directory = dataDirectory();
     if (!QFile::exists(directory)) {
         QDir dir;
         dir.mkpath(directory);
     }
 
-    QFile historyFile(directory + QLatin1String("/history"));
-    // When saving everything use a temporary file to prevent possible data loss.
-    QTemporaryFile tempFile;
-    tempFile.setAutoRemove(false);
-    bool open = false;
-    if (saveAll) {
-        open = tempFile.open();
+    if (m_compactOnSave || m_store->needsCompaction()) {
+        if (!m_store->compact(m_history)) {
+            qWarning() << "History: error compacting history in" << m_store->directory();
+            return;
+        }
+        m_compactOnSave = false;
+        m_urlsChanged = true;
+        // The old history file has been converted
+        QFile historyFile(directory + QLatin1String("/history"));
+        if (historyFile.exists() && !historyFile.remove())
+            qWarning() << "History: error removing old history." << historyFile.errorString();
     } else {
-        open = historyFile.open(QFile::Append);
-    }
-
-    if (!open) {
-        qWarning() << "Unable to open history file for saving"
-                   << (saveAll ? tempFile.fileName() : historyFile.fileName());
-        return;
-    }
-
-    QDataStream out(saveAll ? &tempFile : &historyFile);
-    for (int i = first; i >= 0; --i) {
-        QByteArray data;
-        QDataStream stream(&data, QIODevice::WriteOnly);
-        HistoryEntry item = m_history.at(i);
-        stream << HISTORY_VERSION << item.url << item.dateTime << item.title;
-        out << data;
+        // Whole segments that have expired can go without being rewritten
+        if (m_expiredSinceSave)
+            m_store->removeExpired(m_expiredBefore);
+        // Range removals only cover what is already in the store, so
+        // they go before the new entries
+        foreach (const QDateTime &dateTime, m_unsavedRangeRemovals)
+            m_store->append(HistoryStore::RangeRemovalRecord, HistoryEntry(QString(), dateTime));
+        // Only append what changed since the last save
+        QList<HistoryEntry> entries;
+        for (int i = m_unsavedEntries - 1; i >= 0; --i)
+            entries.append(m_history.at(i));
+        m_store->append(entries);
+        foreach (const HistoryEntry &item, m_unsavedTitles)
+            m_store->append(HistoryStore::TitleRecord, item);
+        foreach (const HistoryEntry &item, m_unsavedRemovals)
+            m_store->append(HistoryStore::RemovalRecord, item);
     }
-    tempFile.close();
+    m_unsavedEntries = 0;
+    m_unsavedTitles.clear();
+    m_unsavedRemovals.clear();
+    m_unsavedRangeRemovals.clear();
+    m_expiredSinceSave = false;
 
-    if (saveAll) {
-        if (historyFile.exists() && !historyFile.remove())
-            qWarning() << "History: error removing old history." << historyFile.errorString();
-        if (!tempFile.rename(historyFile.fileName()))
-            qWarning() << "History: error moving new history over old." << tempFile.errorString() << historyFile.fileName();
+    // Visit counts can be recomputed from the store, only write the
+    // table again when typed counts change or the store was rewritten
+    if (m_urlsChanged) {
+        if (m_store->saveUrls(m_urls))
+            m_urlsChanged = false;
+        else
+            qWarning() << "History: error saving the url table in" << m_store->directory();
     }
-    m_lastSavedUrl = m_history.value(0).url;
 }
-
-
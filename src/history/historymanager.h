@@ -67,6 +67,7 @@
 #include <qhash.h>
 #include <qtimer.h>
 #include <qurl.h>
+#include <qvector.h>
 #include <qwebhistoryinterface.h>
 
 class HistoryEntry
@@ -93,10 +94,116 @@ public:
     QDateTime dateTime;
 };
 
+/*
+    Binary indexed (Fenwick) tree over a list of counts.
+    Prefix sums, updates and finding the n'th counted item are O(log n).
+    Indexes are 1 based.
+  */
+class HistoryRankTree
+{
+public:
+    HistoryRankTree() : m_tree(1, 0), m_total(0) {}
+
+    void clear();
+    int size() const { return m_tree.count() - 1; }
+    int total() const { return m_total; }
+
+    void append(int value);
+    void add(int index, int delta);
+    int value(int index) const;
+    int prefix(int index) const;
+    int find(int n) const;
+
+private:
+    QVector<int> m_tree;
+    int m_total;
+};
+
+/*
+    A HistoryRankTree for a list that grows at both ends, new items are
+    pushed to the front and older items that are loaded later to the back.
+    Items are numbered from the oldest to the newest, the ones at the back
+    are negative, and their numbers don't change when others come or go.
+    Rows count from the front and only include items with a value.
+  */
+class HistoryRankDeque
+{
+public:
+    void clear();
+    int size() const { return m_front.size() + m_back.size(); }
+    int total() const { return m_front.total() + m_back.total(); }
+    bool contains(int id) const;
+
+    int pushFront(int value);
+    int pushBack(int value);
+    void add(int id, int delta);
+    int value(int id) const;
+    // The number of counted items in front of \a id
+    int row(int id) const;
+    // The counted item at \a row
+    int find(int row) const;
+
+    // Where \a id goes in a table that is kept next to the deque
+    static int slot(int id) { return id > 0 ? 2 * id : 1 - 2 * id; }
+
+private:
+    HistoryRankTree m_front;
+    HistoryRankTree m_back;
+};
+
+/*
+    Everything the history knows about one url, summed up over its visits.
+  */
+class HistoryUrlEntry
+{
+public:
+    HistoryUrlEntry() : visitCount(0), typedCount(0) {}
+
+    QString url;
+    QString title;
+    int visitCount;
+    int typedCount;
+    QDateTime firstVisit;
+    QDateTime lastVisit;
+};
+
+/*
+    The HistoryUrlEntry of every url in the history in the order the urls
+    were first seen.  Removed urls leave a hole that is skipped using a
+    HistoryRankTree, so rows can be found, added and removed in O(log n)
+    while the rows of the other urls keep their order.
+  */
+class HistoryUrlTable
+{
+public:
+    HistoryUrlTable();
+
+    void clear();
+    int count() const;
+    int row(const QString &url) const;
+    const HistoryUrlEntry &at(int row) const;
+
+    // Counts a visit to the url of \a item, returns the row of the url
+    int addVisit(const HistoryEntry &item, int typed = 0, bool *added = 0);
+    int append(const HistoryUrlEntry &entry);
+    void replace(int row, const HistoryUrlEntry &entry);
+    void remove(const QString &url);
+
+private:
+    void compact();
+
+    QVector<HistoryUrlEntry> m_entries;
+    QHash<QString, int> m_ids;
+    HistoryRankTree m_rows;
+};
+
 class AutoSaver;
+class HistoryLoader;
+class HistoryStore;
 class HistoryModel;
 class HistoryFilterModel;
 class HistoryTreeModel;
+class HistoryUrlModel;
 class HistoryManager : public QWebHistoryInterface
 {
     Q_OBJECT
@@ -106,17 +213,46 @@ signals:
     void historyCleared();
     void historyReset();
     void entryAdded(const HistoryEntry &item);
+    void entryAboutToBeRemoved(int offset);
     void entryRemoved(const HistoryEntry &item);
+    void entriesAboutToBeRemoved(int offset, int count);
+    void entriesRemoved(int offset, const QList<HistoryEntry> &items);
     void entryUpdated(int offset);
+    void entriesLoaded(int offset, int count);
+    void urlEntryAdded(int row);
+    void urlEntriesAdded(int row, int count);
+    void urlEntryAboutToBeRemoved(int row);
+    void urlEntryRemoved(int row);
+    void urlEntryUpdated(int row);
+    void urlEntriesReset();
 
 public:
-    HistoryManager(QObject *parent = 0);
+    enum LoadMode {
+        LoadNow,
+        LoadInBackground
+    };
+
+    HistoryManager(QObject *parent = 0, LoadMode mode = LoadNow);
     ~HistoryManager();
 
+    bool isLoading() const;
+    void waitForLoaded();
+
     bool historyContains(const QString &url) const;
     void addHistoryEntry(const QString &url);
     void updateHistoryEntry(const QUrl &url, const QString &title);
     void removeHistoryEntry(const QUrl &url, const QString &title = QString());
+    void removeHistoryEntries(const QDateTime &from, const QDateTime &to = QDateTime());
+    void removeHistoryEntries(int offset, int count);
+
+    // The next visit to \a url was typed in by the user
+    void setTypedUrl(const QUrl &url);
+
+    int urlEntryCount() const;
+    HistoryUrlEntry urlEntryAt(int row) const;
+    HistoryUrlEntry urlEntry(const QString &url) const;
+    // The newest visit to \a url, the one the history models show
+    HistoryEntry newestEntry(const QString &url) const;
 
     int daysToExpire() const;
     void setDaysToExpire(int limit);
@@ -128,6 +264,7 @@ public:
     HistoryModel *historyModel() const;
     HistoryFilterModel *historyFilterModel() const;
     HistoryTreeModel *historyTreeModel() const;
+    HistoryUrlModel *historyUrlModel() const;
 
 public slots:
     void clear();
@@ -136,25 +273,96 @@ public slots:
 private slots:
     void save();
     void checkForExpired();
+    void takeLoadedUrls();
+    void takeLoadedEntries();
+    void loaderFinished();
+    void loadNextBatch();
 
 protected:
     void addHistoryEntry(const HistoryEntry &item);
     void removeHistoryEntry(const HistoryEntry &item);
 
 private:
-    void load();
+    // Position in history() of the newest visit to \a url or -1
+    int newestPosition(const QString &url) const;
+    void load(LoadMode mode);
+    void finishLoading(bool keepEntries);
+    void appendLoadedEntries(int count);
+    void sortLoadedEntries();
+    bool applyPendingEdits(HistoryEntry &item);
+    void refreshVisitedLinks();
+    void restoreTypedCounts(const HistoryUrlTable &saved, bool notify = false);
+    void loadLegacy(const QString &fileName);
+    void removeEntriesBetween(const QDateTime &from, const QDateTime &to);
+    void removeEntries(int first, int count);
     QString atomicString(const QString &string);
 
+    void rebuildUrlIndex();
+    void indexEntry(const QString &url);
+    void indexLoadedEntry(const QString &url);
+    void growLinks(int sequence);
+    void unindexEntry(int sequence, const QString &url);
+    int &newerEntry(int sequence) { return m_newerEntry[HistoryRankDeque::slot(sequence)]; }
+    int &olderEntry(int sequence) { return m_olderEntry[HistoryRankDeque::slot(sequence)]; }
+    int positionForSequence(int sequence) const;
+    int sequenceForPosition(int position) const;
+
+    void rebuildUrlTable();
+    void removeUrlVisits(const QString &url, int count, int newer);
+
     AutoSaver *m_saveTimer;
     int m_daysToExpire;
     QTimer m_expiredTimer;
     QHash<QString, int> m_atomicStringHash;
     QList<HistoryEntry> m_history;
-    QString m_lastSavedUrl;
+
+    // Every entry gets a sequence number when it is added to m_history, the
+    // oldest has the lowest and loaded entries get negative ones.
+    // m_liveEntries counts the ones still present so that sequence numbers
+    // can be turned into positions, m_urlIndex points at the newest entry of
+    // each url and the rest are chained from there by HistoryRankDeque::slot.
+    // While loading m_oldestEntry points at the other end of the chains.
+    HistoryRankDeque m_liveEntries;
+    QHash<QString, int> m_urlIndex;
+    QHash<QString, int> m_oldestEntry;
+    QVector<int> m_newerEntry;
+    QVector<int> m_olderEntry;
+
+    // Visit counts, dates and titles per url, kept in step with m_history
+    HistoryUrlTable m_urls;
+    QString m_typedUrl;
+    bool m_urlsChanged;
+
+    // What has changed since the last save, new entries are at the front of m_history
+    HistoryStore *m_store;
+    bool m_compactOnSave;
+    int m_unsavedEntries;
+    QList<HistoryEntry> m_unsavedTitles;
+    QList<HistoryEntry> m_unsavedRemovals;
+    QList<QDateTime> m_unsavedRangeRemovals;
+    QDateTime m_expiredBefore;
+    bool m_expiredSinceSave;
+
+    // Entries read by the loader that haven't been added to m_history yet
+    HistoryLoader *m_loader;
+    bool m_loading;
+    QDateTime m_loadedSince;
+    QTimer m_loadTimer;
+    QList<HistoryEntry> m_loadedEntries;
+    int m_loadedOffset;
+    int m_loadBatchSize;
+    bool m_loadedNeedToSort;
+    HistoryUrlTable m_loadedUrls;
+
+    // Changes to entries that were not loaded yet when they were made
+    QHash<QString, QString> m_pendingTitles;
+    QList<HistoryEntry> m_pendingRemovals;
+    QList<QPair<QDateTime, QDateTime> > m_pendingRangeRemovals;
 
     HistoryModel *m_historyModel;
     HistoryFilterModel *m_historyFilterModel;
     HistoryTreeModel *m_historyTreeModel;
+    HistoryUrlModel *m_historyUrlModel;
 };
 
 #endif // HISTORYMANAGER_H
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "historysearchindex.h"
+
+#include "historymanager.h"
+
+static quint64 trigram(const QChar *c)
+{
+    return (quint64(c[0].unicode()) << 32)
+           | (quint64(c[1].unicode()) << 16)
+           | quint64(c[2].unicode());
+}
+
+HistorySearchIndex::HistorySearchIndex(HistoryManager *history, QObject *parent)
+    : QObject(parent)
+    , m_history(history)
+    , m_loaded(false)
+    , m_stale(0)
+{
+    Q_ASSERT(m_history);
+    connect(m_history, SIGNAL(urlEntriesReset()),
+            this, SLOT(urlEntriesReset()));
+    connect(m_history, SIGNAL(urlEntryAdded(int)),
+            this, SLOT(urlEntryAdded(int)));
+    connect(m_history, SIGNAL(urlEntriesAdded(int, int)),
+            this, SLOT(urlEntriesAdded(int, int)));
+    connect(m_history, SIGNAL(urlEntryUpdated(int)),
+            this, SLOT(urlEntryUpdated(int)));
+    connect(m_history, SIGNAL(urlEntryAboutToBeRemoved(int)),
+            this, SLOT(urlEntryAboutToBeRemoved(int)));
+}
+
+QString HistorySearchIndex::query() const
+{
+    return m_query;
+}
+
+void HistorySearchIndex::setQuery(const QString &text)
+{
+    QString query = text.toLower();
+    if (query == m_query)
+        return;
+
+    bool narrow = !m_query.isEmpty() && query.contains(m_query);
+    // Start over when most of the index is stale
+    if (!m_loaded || m_stale > m_ids.count() + 1024) {
+        load();
+        narrow = false;
+    }
+    search(query, narrow);
+}
+
+bool HistorySearchIndex::matches(const QString &url) const
+{
+    if (m_query.isEmpty())
+        return true;
+    QHash<QString, int>::const_iterator it = m_ids.constFind(url);
+    return it != m_ids.constEnd() && m_matches.contains(it.value());
+}
+
+int HistorySearchIndex::matchCount() const
+{
+    if (m_query.isEmpty())
+        return m_history->urlEntryCount();
+    return m_matches.count();
+}
+
+QStringList HistorySearchIndex::matchingUrls() const
+{
+    QStringList urls;
+    foreach (int id, m_matches)
+        urls.append(m_urls.at(id));
+    return urls;
+}
+
+void HistorySearchIndex::load()
+{
+    m_ids.clear();
+    m_urls.clear();
+    m_texts.clear();
+    m_trigrams.clear();
+    m_stale = 0;
+    m_query.clear();
+    m_matches.clear();
+
+    int count = m_history->urlEntryCount();
+    m_ids.reserve(count);
+    m_urls.reserve(count);
+    m_texts.reserve(count);
+    for (int row = 0; row < count; ++row)
+        setText(m_history->urlEntryAt(row).url);
+    m_loaded = true;
+}
+
+/*
+    Indexes the new text of \a url, the trigrams of its old text stay in
+    the lists until the next rebuild.  The title is the one the history
+    models show, that of the newest visit.
+  */
+void HistorySearchIndex::setText(const QString &url)
+{
+    QString title = m_history->newestEntry(url).userTitle();
+    QString text = title.toLower() + QLatin1Char('\n') + url.toLower();
+    int id = m_ids.value(url, -1);
+    if (id == -1) {
+        id = m_texts.count();
+        m_ids.insert(url, id);
+        m_urls.append(url);
+        m_texts.append(text);
+    } else {
+        if (m_texts.at(id) == text)
+            return;
+        m_texts[id] = text;
+        ++m_stale;
+    }
+
+    QSet<quint64> seen;
+    const QChar *data = text.constData();
+    for (int i = 0; i + 3 <= text.length(); ++i) {
+        quint64 key = trigram(data + i);
+        if (seen.contains(key))
+            continue;
+        seen.insert(key);
+        m_trigrams[key].append(id);
+    }
+
+    if (!m_query.isEmpty()) {
+        if (text.contains(m_query))
+            m_matches.insert(id);
+        else
+            m_matches.remove(id);
+    }
+}
+
+void HistorySearchIndex::search(const QString &query, bool narrow)
+{
+    m_query = query;
+    if (query.isEmpty()) {
+        m_matches.clear();
+        return;
+    }
+
+    // Only what matched the shorter query can match a longer one
+    if (narrow) {
+        QSet<int> previous = m_matches;
+        m_matches.clear();
+        foreach (int id, previous) {
+            if (m_texts.at(id).contains(query))
+                m_matches.insert(id);
+        }
+        return;
+    }
+
+    m_matches.clear();
+    if (query.length() < 3) {
+        for (int id = 0; id < m_texts.count(); ++id) {
+            if (m_texts.at(id).contains(query))
+                m_matches.insert(id);
+        }
+        return;
+    }
+
+    const QVector<int> *rarest = 0;
+    const QChar *data = query.constData();
+    for (int i = 0; i + 3 <= query.length(); ++i) {
+        QHash<quint64, QVector<int> >::const_iterator it = m_trigrams.constFind(trigram(data + i));
+        if (it == m_trigrams.constEnd())
+            return;
+        if (!rarest || it.value().count() < rarest->count())
+            rarest = &it.value();
+    }
+    foreach (int id, *rarest) {
+        if (m_texts.at(id).contains(query))
+            m_matches.insert(id);
+    }
+}
+
+void HistorySearchIndex::urlEntriesReset()
+{
+    m_loaded = false;
+    m_ids.clear();
+    m_urls.clear();
+    m_texts.clear();
+    m_trigrams.clear();
+    m_matches.clear();
+    m_stale = 0;
+    // Anyone filtering with the query still needs the right answers
+    if (!m_query.isEmpty()) {
+        QString query = m_query;
+        load();
+        search(query, false);
+    }
+}
+
+void HistorySearchIndex::urlEntryAdded(int row)
+{
+    if (!m_loaded)
+        return;
+    setText(m_history->urlEntryAt(row).url);
+}
+
+void HistorySearchIndex::urlEntriesAdded(int row, int count)
+{
+    for (int i = row; i < row + count; ++i)
+        urlEntryAdded(i);
+}
+
+void HistorySearchIndex::urlEntryUpdated(int row)
+{
+    urlEntryAdded(row);
+}
+
+void HistorySearchIndex::urlEntryAboutToBeRemoved(int row)
+{
+    if (!m_loaded)
+        return;
+    QString url = m_history->urlEntryAt(row).url;
+    int id = m_ids.value(url, -1);
+    if (id == -1)
+        return;
+    m_ids.remove(url);
+    m_urls[id].clear();
+    m_texts[id].clear();
+    m_matches.remove(id);
+    ++m_stale;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef HISTORYSEARCHINDEX_H
+#define HISTORYSEARCHINDEX_H
+
+#include <qobject.h>
+
+#include <qhash.h>
+#include <qset.h>
+#include <qstring.h>
+#include <qstringlist.h>
+#include <qvector.h>
+
+class HistoryManager;
+
+/*
+    Finds the urls in the history whose title or address contains a piece
+    of text, ignoring case, the way the history dialog filters.
+
+    Every url is indexed by the trigrams of its lower cased title and
+    address.  A query of three or more characters only checks the urls
+    under its rarest trigram, and a query that grows from the previous one
+    only checks what the previous one matched.  When a title changes or a
+    url is removed its old trigrams are left behind and skipped by checking
+    the text, the index is rebuilt once most of it is stale.
+
+    The index follows the per url table of the HistoryManager and is only
+    built once there is something to search for.
+  */
+class HistorySearchIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    HistorySearchIndex(HistoryManager *history, QObject *parent = 0);
+
+    QString query() const;
+    void setQuery(const QString &text);
+
+    // Everything matches an empty query
+    bool matches(const QString &url) const;
+    int matchCount() const;
+    // The urls that match a query that isn't empty, in no particular order
+    QStringList matchingUrls() const;
+
+private slots:
+    void urlEntriesReset();
+    void urlEntryAdded(int row);
+    void urlEntriesAdded(int row, int count);
+    void urlEntryUpdated(int row);
+    void urlEntryAboutToBeRemoved(int row);
+
+private:
+    void load();
+    void setText(const QString &url);
+    void search(const QString &query, bool narrow);
+
+    HistoryManager *m_history;
+    bool m_loaded;
+
+    QHash<QString, int> m_ids;
+    QVector<QString> m_urls;
+    // The lower cased title and address of each id, empty once removed
+    QVector<QString> m_texts;
+    QHash<quint64, QVector<int> > m_trigrams;
+    int m_stale;
+
+    QString m_query;
+    QSet<int> m_matches;
+};
+
+#endif // HISTORYSEARCHINDEX_H
+
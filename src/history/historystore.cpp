@@ -0,0 +1,901 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#include "historystore.h"
+
+#include <qdatastream.h>
+#include <qdir.h>
+#include <qendian.h>
+#include <qfile.h>
+#include <qtemporaryfile.h>
+
+#include <qdebug.h>
+
+static const quint32 SEGMENT_MAGIC = 0x41485347; // AHSG
+static const quint32 INDEX_MAGIC = 0x41485349;   // AHSI
+static const quint32 RECORD_MAGIC = 0x41485252;  // AHRR
+static const quint32 URLS_MAGIC = 0x41485554;    // AHUT
+static const quint32 STORE_VERSION = 1;
+
+// segment: magic, version, replacesFrom, reserved
+static const int SEGMENT_HEADER_SIZE = 16;
+// index: magic, version
+static const int INDEX_HEADER_SIZE = 8;
+// record: magic, type, julian day, msecs, url length, title length
+static const int RECORD_HEADER_SIZE = 24;
+// index entry: offset, type, julian day, msecs
+static const int INDEX_ENTRY_SIZE = 16;
+
+static const qint64 MAXIMUM_SEGMENT_SIZE = 4 * 1024 * 1024;
+static const int WRITE_BUFFER_SIZE = 64 * 1024;
+
+static inline void putValue(QByteArray &array, quint32 value)
+{
+    uchar buffer[4];
+    qToLittleEndian<quint32>(value, buffer);
+    array.append(reinterpret_cast<const char*>(buffer), 4);
+}
+
+static inline quint32 getValue(const uchar *data, int offset)
+{
+    return qFromLittleEndian<quint32>(data + offset);
+}
+
+static inline qint32 msecsOfDay(const QTime &time)
+{
+    return QTime(0, 0).msecsTo(time);
+}
+
+static inline bool isOlder(qint32 julianDay, qint32 msecs, qint32 sinceDay, qint32 sinceMsecs)
+{
+    return julianDay < sinceDay || (julianDay == sinceDay && msecs < sinceMsecs);
+}
+
+static void writeRecord(QByteArray &data, QByteArray &index, quint32 offset,
+                        int type, const HistoryEntry &entry)
+{
+    QByteArray url = entry.url.toUtf8();
+    QByteArray title = entry.title.toUtf8();
+    qint32 julianDay = entry.dateTime.date().toJulianDay();
+    qint32 msecs = msecsOfDay(entry.dateTime.time());
+
+    putValue(data, RECORD_MAGIC);
+    putValue(data, type);
+    putValue(data, julianDay);
+    putValue(data, msecs);
+    putValue(data, url.size());
+    putValue(data, title.size());
+    data.append(url);
+    data.append(title);
+
+    putValue(index, offset);
+    putValue(index, type);
+    putValue(index, julianDay);
+    putValue(index, msecs);
+}
+
+static QByteArray segmentHeader(int replacesFrom)
+{
+    QByteArray header;
+    putValue(header, SEGMENT_MAGIC);
+    putValue(header, STORE_VERSION);
+    putValue(header, replacesFrom);
+    putValue(header, 0);
+    return header;
+}
+
+static QByteArray indexHeader()
+{
+    QByteArray header;
+    putValue(header, INDEX_MAGIC);
+    putValue(header, STORE_VERSION);
+    return header;
+}
+
+// Title and removal records find their visit by date and url
+static QByteArray recordKey(const uchar *indexEntry, const char *url, int urlLength)
+{
+    QByteArray key(reinterpret_cast<const char*>(indexEntry + 8), 8);
+    key.append(url, urlLength);
+    return key;
+}
+
+/*
+    The store is read from the newest record back.  A record only affects
+    the visits written before it, so removals and title updates are kept
+    until their visit is read and every visit is final once it is read.
+  */
+struct HistoryStore::LoadState
+{
+    LoadState()
+        : hasSince(false), sinceDay(0), sinceMsecs(0)
+        , segment(0), isOpen(false)
+        , index(0), data(0), mappedIndex(0), mappedData(0)
+        , dataSize(0), records(0), record(-1), hasRecent(false)
+        , hasCut(false), cutDay(0), cutMsecs(0), sorted(true)
+    {}
+
+    bool hasSince;
+    qint32 sinceDay;
+    qint32 sinceMsecs;
+
+    QList<Segment> segments;
+    int segment;
+    bool isOpen;
+    QFile dataFile;
+    QFile indexFile;
+    const uchar *index;
+    const uchar *data;
+    uchar *mappedIndex;
+    uchar *mappedData;
+    QByteArray indexBuffer;
+    QByteArray dataBuffer;
+    qint64 dataSize;
+    int records;
+    int record;
+    bool hasRecent;
+
+    // Visits from this date on were taken out by a range removal
+    bool hasCut;
+    qint32 cutDay;
+    qint32 cutMsecs;
+    QHash<QByteArray, int> removals;
+    QHash<QByteArray, QString> titles;
+    HistoryEntry lastVisit;
+    QDateTime lastDateTime;
+    bool sorted;
+};
+
+HistoryStore::HistoryStore()
+    : m_currentSegment(0)
+    , m_totalRecords(0)
+    , m_liveRecords(0)
+    , m_load(0)
+{
+}
+
+HistoryStore::~HistoryStore()
+{
+    endLoad();
+}
+
+QString HistoryStore::directory() const
+{
+    return m_directory;
+}
+
+void HistoryStore::setDirectory(const QString &directory)
+{
+    m_directory = directory;
+    m_currentSegment = 0;
+    m_totalRecords = 0;
+    m_liveRecords = 0;
+}
+
+QString HistoryStore::dataFileName(int number) const
+{
+    return m_directory + QString(QLatin1String("/segment-%1.log")).arg(number);
+}
+
+QString HistoryStore::indexFileName(int number) const
+{
+    return m_directory + QString(QLatin1String("/segment-%1.idx")).arg(number);
+}
+
+bool HistoryStore::isEmpty() const
+{
+    QDir dir(m_directory);
+    return dir.entryList(QStringList(QLatin1String("segment-*.log")), QDir::Files).isEmpty();
+}
+
+bool HistoryStore::needsCompaction() const
+{
+    // Rewrite once more then half of the records are expired, removed or title updates
+    return m_totalRecords > 1000 && m_liveRecords * 2 < m_totalRecords;
+}
+
+QString HistoryStore::urlsFileName() const
+{
+    return m_directory + QLatin1String("/urls.dat");
+}
+
+HistoryUrlTable HistoryStore::loadUrls() const
+{
+    HistoryUrlTable urls;
+    QFile file(urlsFileName());
+    if (!file.open(QFile::ReadOnly))
+        return urls;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_4);
+    quint32 magic;
+    quint32 version;
+    qint32 count;
+    stream >> magic >> version >> count;
+    if (magic != URLS_MAGIC || version != STORE_VERSION) {
+        qWarning() << "HistoryStore: ignoring invalid url table" << file.fileName();
+        return urls;
+    }
+    for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        HistoryUrlEntry entry;
+        qint32 visitCount;
+        qint32 typedCount;
+        stream >> entry.url >> entry.title >> visitCount >> typedCount
+               >> entry.firstVisit >> entry.lastVisit;
+        entry.visitCount = visitCount;
+        entry.typedCount = typedCount;
+        if (stream.status() == QDataStream::Ok && urls.row(entry.url) < 0)
+            urls.append(entry);
+    }
+    return urls;
+}
+
+bool HistoryStore::saveUrls(const HistoryUrlTable &urls) const
+{
+    QTemporaryFile tempFile(m_directory + QLatin1String("/urls.tmp.XXXXXX"));
+    tempFile.setAutoRemove(false);
+    if (!tempFile.open())
+        return false;
+
+    QDataStream stream(&tempFile);
+    stream.setVersion(QDataStream::Qt_4_4);
+    stream << URLS_MAGIC << STORE_VERSION << qint32(urls.count());
+    for (int i = 0; i < urls.count(); ++i) {
+        const HistoryUrlEntry &entry = urls.at(i);
+        stream << entry.url << entry.title
+               << qint32(entry.visitCount) << qint32(entry.typedCount)
+               << entry.firstVisit << entry.lastVisit;
+    }
+    tempFile.close();
+    if (stream.status() != QDataStream::Ok || tempFile.error() != QFile::NoError) {
+        tempFile.remove();
+        return false;
+    }
+    QFile::remove(urlsFileName());
+    return tempFile.rename(urlsFileName());
+}
+
+void HistoryStore::removeSegment(int number)
+{
+    QFile::remove(dataFileName(number));
+    QFile::remove(indexFileName(number));
+}
+
+/*
+    Returns the segments sorted oldest first and removes any files
+    that were left behind by an interrupted compaction.
+  */
+QList<HistoryStore::Segment> HistoryStore::segments()
+{
+    QDir dir(m_directory);
+    QStringList leftOvers;
+    leftOvers << QLatin1String("segment.tmp.*") << QLatin1String("urls.tmp.*");
+    foreach (const QString &file, dir.entryList(leftOvers, QDir::Files))
+        dir.remove(file);
+
+    QList<int> numbers;
+    foreach (const QString &file, dir.entryList(QStringList(QLatin1String("segment-*.log")), QDir::Files)) {
+        bool ok;
+        int number = file.mid(8, file.length() - 12).toInt(&ok);
+        if (ok && number > 0)
+            numbers.append(number);
+    }
+    qSort(numbers);
+
+    QList<Segment> list;
+    foreach (int number, numbers) {
+        QFile file(dataFileName(number));
+        QByteArray header;
+        if (file.open(QFile::ReadOnly))
+            header = file.read(SEGMENT_HEADER_SIZE);
+        const uchar *data = reinterpret_cast<const uchar*>(header.constData());
+        if (header.size() != SEGMENT_HEADER_SIZE
+            || getValue(data, 0) != SEGMENT_MAGIC
+            || getValue(data, 4) != STORE_VERSION) {
+            file.close();
+            qWarning() << "HistoryStore: removing invalid segment" << file.fileName();
+            removeSegment(number);
+            continue;
+        }
+        Segment segment;
+        segment.number = number;
+        segment.replacesFrom = getValue(data, 8);
+        list.append(segment);
+    }
+
+    // A compacted segment makes every segment it replaces obsolete
+    for (int i = list.count() - 1; i >= 0; --i) {
+        int replacesFrom = list.at(i).replacesFrom;
+        int number = list.at(i).number;
+        while (i > 0 && list.at(i - 1).number >= replacesFrom && list.at(i - 1).number < number) {
+            removeSegment(list.at(i - 1).number);
+            list.removeAt(i - 1);
+            --i;
+        }
+    }
+
+    foreach (const QString &file, dir.entryList(QStringList(QLatin1String("segment-*.idx")), QDir::Files)) {
+        if (!QFile::exists(dir.filePath(file.left(file.length() - 4) + QLatin1String(".log"))))
+            dir.remove(file);
+    }
+    return list;
+}
+
+/*
+    Recreate the index of a segment by walking the records of the data file,
+    dropping a partially written record at the end if there is one.
+  */
+bool HistoryStore::rebuildIndex(int number) const
+{
+    QFile file(dataFileName(number));
+    if (!file.open(QFile::ReadWrite))
+        return false;
+    QByteArray data = file.readAll();
+    const uchar *d = reinterpret_cast<const uchar*>(data.constData());
+
+    QByteArray index = indexHeader();
+    int offset = SEGMENT_HEADER_SIZE;
+    while (offset + RECORD_HEADER_SIZE <= data.size()) {
+        if (getValue(d, offset) != RECORD_MAGIC)
+            break;
+        int length = RECORD_HEADER_SIZE + getValue(d, offset + 16) + getValue(d, offset + 20);
+        if (offset + length > data.size())
+            break;
+        putValue(index, offset);
+        index.append(data.constData() + offset + 4, 12);
+        offset += length;
+    }
+    if (offset < data.size()) {
+        qWarning() << "HistoryStore: truncating damaged segment" << file.fileName() << offset;
+        file.resize(offset);
+    }
+    file.close();
+
+    QTemporaryFile tempFile(m_directory + QLatin1String("/segment.tmp.XXXXXX"));
+    tempFile.setAutoRemove(false);
+    if (!tempFile.open())
+        return false;
+    tempFile.write(index);
+    tempFile.close();
+    QFile::remove(indexFileName(number));
+    return tempFile.rename(indexFileName(number));
+}
+
+QList<HistoryEntry> HistoryStore::load(const QDateTime &since, bool *needToSort)
+{
+    beginLoad(since);
+    QList<HistoryEntry> list = loadMore(-1);
+    bool sorted = !this->needToSort();
+    endLoad();
+
+    if (!sorted)
+        qSort(list.begin(), list.end());
+    if (needToSort)
+        *needToSort = !sorted;
+    return list;
+}
+
+void HistoryStore::beginLoad(const QDateTime &since)
+{
+    endLoad();
+    m_totalRecords = 0;
+    m_liveRecords = 0;
+    m_currentSegment = 0;
+
+    m_load = new LoadState;
+    if (since.isValid()) {
+        m_load->hasSince = true;
+        m_load->sinceDay = since.date().toJulianDay();
+        m_load->sinceMsecs = msecsOfDay(since.time());
+    }
+    m_load->segments = segments();
+    m_load->segment = m_load->segments.count();
+    if (!m_load->segments.isEmpty())
+        m_currentSegment = m_load->segments.last().number;
+}
+
+bool HistoryStore::atEnd() const
+{
+    return !m_load || (m_load->segment == 0 && m_load->record < 0);
+}
+
+bool HistoryStore::needToSort() const
+{
+    return m_load && !m_load->sorted;
+}
+
+void HistoryStore::endLoad()
+{
+    if (!m_load)
+        return;
+    closeSegment();
+    delete m_load;
+    m_load = 0;
+}
+
+/*
+    Open the segment m_load->segment for reading from its last record,
+    an index that doesn't cover exactly the data file means that we were
+    interrupted while appending and is rebuilt.
+  */
+bool HistoryStore::openSegment()
+{
+    LoadState *d = m_load;
+    int number = d->segments.at(d->segment).number;
+    d->dataFile.setFileName(dataFileName(number));
+    d->indexFile.setFileName(indexFileName(number));
+    if (!d->dataFile.open(QFile::ReadOnly)) {
+        qWarning() << "HistoryStore: unable to open" << d->dataFile.fileName();
+        return false;
+    }
+
+    bool validIndex = false;
+    if (d->indexFile.open(QFile::ReadOnly)) {
+        QByteArray header = d->indexFile.read(INDEX_HEADER_SIZE);
+        qint64 entries = (d->indexFile.size() - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+        if (header.size() == INDEX_HEADER_SIZE
+            && getValue(reinterpret_cast<const uchar*>(header.constData()), 0) == INDEX_MAGIC
+            && (d->indexFile.size() - INDEX_HEADER_SIZE) % INDEX_ENTRY_SIZE == 0) {
+            if (entries == 0) {
+                validIndex = (d->dataFile.size() == SEGMENT_HEADER_SIZE);
+            } else {
+                d->indexFile.seek(INDEX_HEADER_SIZE + (entries - 1) * INDEX_ENTRY_SIZE);
+                QByteArray last = d->indexFile.read(4);
+                quint32 offset = getValue(reinterpret_cast<const uchar*>(last.constData()), 0);
+                d->dataFile.seek(offset);
+                QByteArray record = d->dataFile.read(RECORD_HEADER_SIZE);
+                const uchar *r = reinterpret_cast<const uchar*>(record.constData());
+                validIndex = record.size() == RECORD_HEADER_SIZE
+                    && getValue(r, 0) == RECORD_MAGIC
+                    && offset + RECORD_HEADER_SIZE + getValue(r, 16) + getValue(r, 20)
+                       == quint64(d->dataFile.size());
+            }
+        }
+        d->indexFile.close();
+    }
+    if (!validIndex) {
+        d->dataFile.close();
+        qWarning() << "HistoryStore: rebuilding index for" << d->dataFile.fileName();
+        if (!rebuildIndex(number) || !d->dataFile.open(QFile::ReadOnly))
+            return false;
+    }
+    if (!d->indexFile.open(QFile::ReadOnly)) {
+        d->dataFile.close();
+        return false;
+    }
+
+    qint64 indexSize = d->indexFile.size();
+    d->mappedIndex = d->indexFile.map(0, indexSize);
+    d->index = d->mappedIndex;
+    if (!d->index) {
+        d->indexBuffer = d->indexFile.readAll();
+        d->index = reinterpret_cast<const uchar*>(d->indexBuffer.constData());
+    }
+    // The data file is only read if a record turns out to be wanted
+    d->dataSize = d->dataFile.size();
+    d->mappedData = d->dataFile.map(0, d->dataSize);
+    d->data = d->mappedData;
+
+    d->isOpen = true;
+    d->hasRecent = false;
+    d->records = (indexSize - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+    d->record = d->records - 1;
+    m_totalRecords += d->records;
+    return true;
+}
+
+void HistoryStore::closeSegment()
+{
+    LoadState *d = m_load;
+    if (!d || !d->isOpen)
+        return;
+    if (d->mappedData)
+        d->dataFile.unmap(d->mappedData);
+    if (d->mappedIndex)
+        d->indexFile.unmap(d->mappedIndex);
+    d->dataFile.close();
+    d->indexFile.close();
+    d->index = 0;
+    d->data = 0;
+    d->mappedIndex = 0;
+    d->mappedData = 0;
+    d->indexBuffer.clear();
+    d->dataBuffer.clear();
+    d->isOpen = false;
+    d->record = -1;
+
+    // Everything in this segment has expired, drop it without a rewrite
+    if (!d->hasRecent && d->records > 0 && d->segment != d->segments.count() - 1) {
+        m_totalRecords -= d->records;
+        removeSegment(d->segments.at(d->segment).number);
+    }
+}
+
+/*
+    Returns up to \a count more entries, or all of them when \a count is -1,
+    older then the ones returned before.  Unless the store is not sorted,
+    see needToSort(), they are sorted with the newest entry first.
+  */
+QList<HistoryEntry> HistoryStore::loadMore(int count)
+{
+    QList<HistoryEntry> list;
+    LoadState *d = m_load;
+    if (!d)
+        return list;
+
+    while (count < 0 || list.count() < count) {
+        if (d->record < 0) {
+            closeSegment();
+            if (d->segment == 0)
+                break;
+            --d->segment;
+            if (!openSegment())
+                continue;
+        }
+
+        const uchar *entry = d->index + INDEX_HEADER_SIZE + d->record * INDEX_ENTRY_SIZE;
+        --d->record;
+        quint32 type = getValue(entry, 4);
+        qint32 julianDay = getValue(entry, 8);
+        qint32 msecs = getValue(entry, 12);
+        // A range removal can cover newer entries than its own date
+        if (d->hasSince && type != RangeRemovalRecord
+            && isOlder(julianDay, msecs, d->sinceDay, d->sinceMsecs))
+            continue;
+        d->hasRecent = true;
+
+        // Only now that we know the record is wanted touch the data file
+        if (!d->data) {
+            if (d->dataBuffer.isEmpty())
+                d->dataBuffer = d->dataFile.readAll();
+            d->data = reinterpret_cast<const uchar*>(d->dataBuffer.constData());
+        }
+        quint32 offset = getValue(entry, 0);
+        const uchar *record = d->data + offset;
+        if (offset + RECORD_HEADER_SIZE > d->dataSize || getValue(record, 0) != RECORD_MAGIC)
+            continue;
+        quint32 urlLength = getValue(record, 16);
+        quint32 titleLength = getValue(record, 20);
+        if (offset + RECORD_HEADER_SIZE + urlLength + titleLength > d->dataSize)
+            continue;
+        const char *strings = reinterpret_cast<const char*>(record + RECORD_HEADER_SIZE);
+        QDateTime dateTime(QDate::fromJulianDay(julianDay), QTime(0, 0).addMSecs(msecs));
+        if (!dateTime.isValid())
+            continue;
+
+        switch (type) {
+        case VisitRecord: {
+            HistoryEntry item(QString::fromUtf8(strings, urlLength), dateTime,
+                              QString::fromUtf8(strings + urlLength, titleLength));
+            // A visit that was written twice in a row only counts once
+            if (item == d->lastVisit)
+                continue;
+            d->lastVisit = item;
+            if (d->hasCut && !isOlder(julianDay, msecs, d->cutDay, d->cutMsecs))
+                continue;
+            if (!d->removals.isEmpty() || !d->titles.isEmpty()) {
+                QByteArray key = recordKey(entry, strings, urlLength);
+                QHash<QByteArray, int>::iterator removal = d->removals.find(key);
+                if (removal != d->removals.end()) {
+                    if (--removal.value() == 0)
+                        d->removals.erase(removal);
+                    continue;
+                }
+                QHash<QByteArray, QString>::iterator title = d->titles.find(key);
+                if (title != d->titles.end()) {
+                    item.title = title.value();
+                    d->titles.erase(title);
+                }
+            }
+            if (d->lastDateTime.isValid() && item.dateTime > d->lastDateTime)
+                d->sorted = false;
+            d->lastDateTime = item.dateTime;
+            list.append(item);
+            ++m_liveRecords;
+            break;
+        }
+        case TitleRecord: {
+            // The newest title update wins
+            QByteArray key = recordKey(entry, strings, urlLength);
+            if (!d->titles.contains(key))
+                d->titles.insert(key, QString::fromUtf8(strings + urlLength, titleLength));
+            break;
+        }
+        case RemovalRecord:
+            ++d->removals[recordKey(entry, strings, urlLength)];
+            break;
+        case RangeRemovalRecord:
+            if (!d->hasCut || isOlder(julianDay, msecs, d->cutDay, d->cutMsecs)) {
+                d->hasCut = true;
+                d->cutDay = julianDay;
+                d->cutMsecs = msecs;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return list;
+}
+
+bool HistoryStore::append(const QList<HistoryEntry> &entries)
+{
+    return appendRecords(VisitRecord, entries);
+}
+
+bool HistoryStore::append(RecordType type, const HistoryEntry &entry)
+{
+    return appendRecords(type, QList<HistoryEntry>() << entry);
+}
+
+bool HistoryStore::appendRecords(RecordType type, const QList<HistoryEntry> &entries)
+{
+    if (entries.isEmpty())
+        return true;
+
+    if (!QFile::exists(m_directory)) {
+        QDir dir;
+        dir.mkpath(m_directory);
+    }
+
+    if (m_currentSegment == 0) {
+        QList<Segment> segmentList = segments();
+        if (!segmentList.isEmpty())
+            m_currentSegment = segmentList.last().number;
+    }
+
+    QFile dataFile(dataFileName(m_currentSegment));
+    QFile indexFile(indexFileName(m_currentSegment));
+    if (m_currentSegment == 0 || dataFile.size() >= MAXIMUM_SEGMENT_SIZE) {
+        // start a new segment
+        ++m_currentSegment;
+        dataFile.setFileName(dataFileName(m_currentSegment));
+        indexFile.setFileName(indexFileName(m_currentSegment));
+        if (!indexFile.open(QFile::WriteOnly | QFile::Truncate)
+            || !dataFile.open(QFile::WriteOnly | QFile::Truncate)) {
+            qWarning() << "HistoryStore: unable to create segment" << dataFile.fileName();
+            return false;
+        }
+        indexFile.write(indexHeader());
+        dataFile.write(segmentHeader(m_currentSegment));
+        indexFile.close();
+        dataFile.close();
+    }
+
+    if (!dataFile.open(QFile::WriteOnly | QFile::Append)
+        || !indexFile.open(QFile::WriteOnly | QFile::Append)) {
+        qWarning() << "HistoryStore: unable to open segment for appending" << dataFile.fileName();
+        return false;
+    }
+
+    QByteArray data;
+    QByteArray index;
+    quint32 offset = dataFile.size();
+    foreach (const HistoryEntry &entry, entries) {
+        if (!entry.dateTime.isValid())
+            continue;
+        writeRecord(data, index, offset + data.size(), type, entry);
+        ++m_totalRecords;
+        if (type == VisitRecord)
+            ++m_liveRecords;
+        else if (type == RemovalRecord)
+            --m_liveRecords;
+    }
+
+    // The data must hit the disk before the index that refers to it
+    if (dataFile.write(data) != data.size() || !dataFile.flush()) {
+        qWarning() << "HistoryStore: error appending to" << dataFile.fileName() << dataFile.errorString();
+        return false;
+    }
+    if (indexFile.write(index) != index.size()) {
+        qWarning() << "HistoryStore: error appending to" << indexFile.fileName() << indexFile.errorString();
+        return false;
+    }
+    return true;
+}
+
+bool HistoryStore::writeSegment(int number, int replacesFrom, const QList<HistoryEntry> &entries)
+{
+    QTemporaryFile indexFile(m_directory + QLatin1String("/segment.tmp.XXXXXX"));
+    QTemporaryFile dataFile(m_directory + QLatin1String("/segment.tmp.XXXXXX"));
+    indexFile.setAutoRemove(false);
+    dataFile.setAutoRemove(false);
+    if (!indexFile.open() || !dataFile.open()) {
+        qWarning() << "HistoryStore: unable to open temporary segment for compaction";
+        indexFile.remove();
+        dataFile.remove();
+        return false;
+    }
+
+    QByteArray data = segmentHeader(replacesFrom);
+    QByteArray index = indexHeader();
+    quint32 offset = 0;
+    bool ok = true;
+    // entries is sorted newest first, segments are written oldest first
+    for (int i = entries.count() - 1; i >= 0 && ok; --i) {
+        if (!entries.at(i).dateTime.isValid())
+            continue;
+        writeRecord(data, index, offset + data.size(), VisitRecord, entries.at(i));
+        if (data.size() > WRITE_BUFFER_SIZE) {
+            offset += data.size();
+            ok = dataFile.write(data) == data.size()
+                 && indexFile.write(index) == index.size();
+            data.clear();
+            index.clear();
+        }
+    }
+    ok = ok && dataFile.write(data) == data.size()
+         && indexFile.write(index) == index.size()
+         && dataFile.flush() && indexFile.flush();
+    indexFile.close();
+    dataFile.close();
+
+    // The data file is renamed last, it is what makes the segment visible
+    if (!ok
+        || !indexFile.rename(indexFileName(number))
+        || !dataFile.rename(dataFileName(number))) {
+        qWarning() << "HistoryStore: error writing compacted segment" << dataFileName(number);
+        indexFile.remove();
+        dataFile.remove();
+        QFile::remove(indexFileName(number));
+        return false;
+    }
+    return true;
+}
+
+bool HistoryStore::compact(const QList<HistoryEntry> &history)
+{
+    if (!QFile::exists(m_directory)) {
+        QDir dir;
+        dir.mkpath(m_directory);
+    }
+
+    QList<Segment> segmentList = segments();
+    if (history.isEmpty()) {
+        clear();
+        return true;
+    }
+
+    int number = segmentList.isEmpty() ? 1 : segmentList.last().number + 1;
+    int replacesFrom = segmentList.isEmpty() ? number : segmentList.first().number;
+    if (!writeSegment(number, replacesFrom, history))
+        return false;
+
+    foreach (const Segment &segment, segmentList)
+        removeSegment(segment.number);
+    m_currentSegment = number;
+    m_totalRecords = history.count();
+    m_liveRecords = history.count();
+    return true;
+}
+
+/*
+    Drops the segments that only hold records older than \a before without
+    reading their data.  The newest segment is kept for appending to.
+  */
+void HistoryStore::removeExpired(const QDateTime &before)
+{
+    if (!before.isValid())
+        return;
+    qint32 beforeDay = before.date().toJulianDay();
+    qint32 beforeMsecs = msecsOfDay(before.time());
+
+    QList<Segment> segmentList = segments();
+    for (int s = 0; s < segmentList.count() - 1; ++s) {
+        int number = segmentList.at(s).number;
+        QFile indexFile(indexFileName(number));
+        if (!indexFile.open(QFile::ReadOnly))
+            continue;
+        QByteArray index = indexFile.readAll();
+        indexFile.close();
+        if (index.size() < INDEX_HEADER_SIZE)
+            continue;
+
+        const uchar *data = reinterpret_cast<const uchar*>(index.constData());
+        int entries = (index.size() - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+        int visits = 0;
+        bool expired = true;
+        for (int i = 0; i < entries && expired; ++i) {
+            const uchar *entry = data + INDEX_HEADER_SIZE + i * INDEX_ENTRY_SIZE;
+            quint32 type = getValue(entry, 4);
+            if (type == VisitRecord)
+                ++visits;
+            expired = type != RangeRemovalRecord
+                && isOlder(getValue(entry, 8), getValue(entry, 12), beforeDay, beforeMsecs);
+        }
+        if (!expired)
+            continue;
+        removeSegment(number);
+        m_totalRecords = qMax(0, m_totalRecords - entries);
+        m_liveRecords = qMax(0, m_liveRecords - visits);
+    }
+}
+
+void HistoryStore::clear()
+{
+    foreach (const Segment &segment, segments())
+        removeSegment(segment.number);
+    QFile::remove(urlsFileName());
+    m_currentSegment = 0;
+    m_totalRecords = 0;
+    m_liveRecords = 0;
+}
+
+// The first batch is small so that the newest entries show up quickly
+static const int FIRST_LOADER_BATCH = 1000;
+static const int MAXIMUM_LOADER_BATCH = 64000;
+
+HistoryLoader::HistoryLoader(HistoryStore *store, const QDateTime &since, QObject *parent)
+    : QThread(parent)
+    , m_store(store)
+    , m_since(since)
+    , m_needToSort(false)
+{
+}
+
+QList<HistoryEntry> HistoryLoader::takeEntries()
+{
+    QMutexLocker locker(&m_mutex);
+    QList<HistoryEntry> entries = m_entries;
+    m_entries.clear();
+    return entries;
+}
+
+bool HistoryLoader::needToSort() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_needToSort;
+}
+
+// Empty until urlsLoaded() has been emitted
+HistoryUrlTable HistoryLoader::urls() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_urls;
+}
+
+void HistoryLoader::run()
+{
+    // The urls are a lot less to read than the visits and are enough
+    // to tell which links have been visited
+    HistoryUrlTable urls = m_store->loadUrls();
+    {
+        QMutexLocker locker(&m_mutex);
+        m_urls = urls;
+    }
+    emit urlsLoaded();
+
+    m_store->beginLoad(m_since);
+    int batchSize = FIRST_LOADER_BATCH;
+    while (!m_store->atEnd()) {
+        QList<HistoryEntry> entries = m_store->loadMore(batchSize);
+        bool wasTaken;
+        {
+            QMutexLocker locker(&m_mutex);
+            wasTaken = m_entries.isEmpty();
+            m_entries += entries;
+            m_needToSort = m_store->needToSort();
+        }
+        if (wasTaken && !entries.isEmpty())
+            emit entriesLoaded();
+        batchSize = qMin(batchSize * 2, MAXIMUM_LOADER_BATCH);
+    }
+    m_store->endLoad();
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef HISTORYSTORE_H
+#define HISTORYSTORE_H
+
+#include "historymanager.h"
+
+#include <qlist.h>
+#include <qmutex.h>
+#include <qstring.h>
+#include <qthread.h>
+
+/*
+    On disk storage for the browsing history.
+
+    History is kept as a series of append-only segments in a directory.
+    Each segment is a data file (segment-N.log) of records with a fixed
+    width header followed by the utf8 url and title, and a sidecar index
+    (segment-N.idx) holding one fixed width (offset, date, type) entry per
+    record that is memory-mapped when loading.
+
+    Because every record carries the date of the visit it refers to, records
+    that are older than the expiration date can be skipped using only the
+    index and whole segments that only contain expired records are dropped
+    without being read.
+
+    Compaction writes the complete history into a new segment whose header
+    records the first segment it replaces.  The new segment only becomes
+    visible once it has been renamed into place, so if we crash before the
+    old segments are removed they are cleaned up on the next load.
+
+    Removing the newest part of the history only appends a single range
+    removal record.  Expired history is dropped a whole segment at a time,
+    what is left of a partly expired segment is skipped when loading.
+
+    Next to the segments urls.dat holds the HistoryUrlTable the history
+    had when it was last saved.
+  */
+class HistoryStore
+{
+public:
+    enum RecordType {
+        VisitRecord = 1,
+        TitleRecord = 2,
+        RemovalRecord = 3,
+        // Removes every entry read so far from the date of the record on
+        RangeRemovalRecord = 4
+    };
+
+    HistoryStore();
+    ~HistoryStore();
+
+    QString directory() const;
+    void setDirectory(const QString &directory);
+
+    bool isEmpty() const;
+
+    // Returns the history newer then \a since sorted with the newest entry first
+    QList<HistoryEntry> load(const QDateTime &since, bool *needToSort = 0);
+
+    // Reads the history newer then \a since a part at a time, newest entry first
+    void beginLoad(const QDateTime &since);
+    QList<HistoryEntry> loadMore(int count);
+    bool atEnd() const;
+    // True when the entries read so far were not sorted by date
+    bool needToSort() const;
+    void endLoad();
+
+    // \a entries is expected to be sorted oldest first
+    bool append(const QList<HistoryEntry> &entries);
+    bool append(RecordType type, const HistoryEntry &entry);
+    bool compact(const QList<HistoryEntry> &history);
+    void removeExpired(const QDateTime &before);
+    void clear();
+
+    bool needsCompaction() const;
+
+    HistoryUrlTable loadUrls() const;
+    bool saveUrls(const HistoryUrlTable &urls) const;
+
+private:
+    struct Segment {
+        Segment() : number(0), replacesFrom(0) {}
+        int number;
+        int replacesFrom;
+    };
+
+    struct LoadState;
+
+    QString dataFileName(int number) const;
+    QString indexFileName(int number) const;
+    QString urlsFileName() const;
+    QList<Segment> segments();
+    void removeSegment(int number);
+    bool rebuildIndex(int number) const;
+    bool writeSegment(int number, int replacesFrom, const QList<HistoryEntry> &entries);
+    bool appendRecords(RecordType type, const QList<HistoryEntry> &entries);
+    bool openSegment();
+    void closeSegment();
+
+    QString m_directory;
+    int m_currentSegment;
+    int m_totalRecords;
+    int m_liveRecords;
+    LoadState *m_load;
+};
+
+/*
+    Loads a history store on a worker thread so that reading and sorting
+    a large history does not hold up the user interface.  Entries are
+    handed over in batches as they are read, newest first, entriesLoaded()
+    is emitted when there is something to take after everything that was
+    read before has been taken.  The url table is read first and
+    urlsLoaded() is emitted once it is available.  The store must not be
+    used by anyone else until the thread has finished.
+  */
+class HistoryLoader : public QThread
+{
+    Q_OBJECT
+
+signals:
+    void urlsLoaded();
+    void entriesLoaded();
+
+public:
+    HistoryLoader(HistoryStore *store, const QDateTime &since, QObject *parent = 0);
+
+    QList<HistoryEntry> takeEntries();
+    bool needToSort() const;
+    HistoryUrlTable urls() const;
+
+protected:
+    void run();
+
+private:
+    HistoryStore *m_store;
+    QDateTime m_since;
+    mutable QMutex m_mutex;
+    QList<HistoryEntry> m_entries;
+    bool m_needToSort;
+    HistoryUrlTable m_urls;
+};
+
+#endif // HISTORYSTORE_H
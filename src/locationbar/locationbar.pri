@@ -4,10 +4,12 @@ DEPENDPATH += $$PWD
 HEADERS += \
   locationbar.h \
   locationbarsiteicon.h \
+  locationcompleter.h \
   privacyindicator.h
 
 SOURCES += \
   locationbar.cpp \
   locationbarsiteicon.cpp \
+  locationcompleter.cpp \
   privacyindicator.cpp
 
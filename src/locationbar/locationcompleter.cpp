@@ -0,0 +1,542 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#include "locationcompleter.h"
+
+#include "bookmarknode.h"
+#include "bookmarksmanager.h"
+#include "historymanager.h"
+
+#include <qcoreevent.h>
+#include <qdatetime.h>
+
+// Number of completions shown for each query
+static const int MAXIMUM_RESULTS = 20;
+// Milliseconds a query may take before the best matches found so far are used
+static const int LATENCY_BUDGET = 20;
+// Prefixes up to this long are looked up in the buckets sorted by score
+static const int BUCKET_PREFIX_LENGTH = 2;
+// Seconds after which the scores of a bucket are taken again as they age
+static const uint BUCKET_SORT_INTERVAL = 3600;
+
+static quint64 trigram(const QChar *c)
+{
+    return (quint64(c[0].unicode()) << 32)
+           | (quint64(c[1].unicode()) << 16)
+           | quint64(c[2].unicode());
+}
+
+// Keeps matches sorted by score, highest first, and at most maximum of them
+static void addMatch(QList<QPair<int, int> > &matches, int score, int id, int maximum)
+{
+    if (matches.count() == maximum && score <= matches.last().first)
+        return;
+    int i = 0;
+    for (; i < matches.count(); ++i)
+        if (matches.at(i).second == id)
+            return;
+    i = 0;
+    while (i < matches.count() && matches.at(i).first >= score)
+        ++i;
+    matches.insert(i, qMakePair(score, id));
+    if (matches.count() > maximum)
+        matches.removeLast();
+}
+
+LocationCompletionIndex::LocationCompletionIndex()
+    : m_removed(0)
+{
+}
+
+void LocationCompletionIndex::clear()
+{
+    m_entries.clear();
+    m_ids.clear();
+    m_prefixes.clear();
+    m_buckets.clear();
+    m_trigrams.clear();
+    m_removed = 0;
+}
+
+int LocationCompletionIndex::count() const
+{
+    return m_ids.count();
+}
+
+/*
+    The part of the url that is matched against what is typed,
+    "http://www.foo.com/" becomes "foo.com/".
+  */
+QString LocationCompletionIndex::key(const QString &url)
+{
+    QString key = url.toLower();
+    int schemeEnd = key.indexOf(QLatin1String("://"));
+    if (schemeEnd != -1)
+        key = key.mid(schemeEnd + 3);
+    if (key.startsWith(QLatin1String("www.")))
+        key = key.mid(4);
+    return key;
+}
+
+/*
+    Sets what the history knows about \a url, a url without visits is
+    dropped unless it is bookmarked.
+  */
+void LocationCompletionIndex::setVisits(const QString &url, const QString &title,
+                                        int visits, const QDateTime &lastVisit)
+{
+    int id = m_ids.value(url, -1);
+    if (id == -1) {
+        if (visits <= 0)
+            return;
+        id = entry(url);
+    }
+    Entry &item = m_entries[id];
+    visits = qMax(0, visits);
+    uint visit = lastVisit.isValid() ? lastVisit.toTime_t() : 0;
+    if (visits != item.visits || visit != item.lastVisit) {
+        item.visits = visits;
+        item.lastVisit = visit;
+        touch(id);
+    }
+    if (!title.isEmpty())
+        setTitle(id, title);
+    release(id);
+}
+
+void LocationCompletionIndex::addBookmark(const QString &url, const QString &title)
+{
+    int id = entry(url);
+    Entry &item = m_entries[id];
+    ++item.bookmarks;
+    touch(id);
+    if (item.title.isEmpty() && !title.isEmpty())
+        setTitle(id, title);
+}
+
+void LocationCompletionIndex::removeBookmark(const QString &url)
+{
+    int id = m_ids.value(url, -1);
+    if (id == -1)
+        return;
+    Entry &item = m_entries[id];
+    if (item.bookmarks > 0)
+        --item.bookmarks;
+    touch(id);
+    release(id);
+}
+
+QString LocationCompletionIndex::title(const QString &url) const
+{
+    int id = m_ids.value(url, -1);
+    if (id == -1)
+        return QString();
+    return m_entries.at(id).title;
+}
+
+/*
+    Returns the urls of the best \a maximum matches for \a text.
+
+    Urls that start with the text are found from the buckets or the sorted
+    prefixes, for longer text the rarest trigram of the longest word gives the urls that
+    might contain it.  Once \a budget milliseconds have passed the best
+    matches found so far are returned.
+  */
+QStringList LocationCompletionIndex::complete(const QString &text, int maximum, int budget) const
+{
+    QStringList results;
+    QString query = key(text.trimmed());
+    if (query.isEmpty() || maximum <= 0)
+        return results;
+
+    QStringList words = query.split(QLatin1Char(' '), QString::SkipEmptyParts);
+    uint now = QDateTime::currentDateTime().toTime_t();
+    QList<QPair<int, int> > matches;
+    QTime timer;
+    timer.start();
+    bool timedOut = false;
+    int steps = 0;
+
+    if (words.count() == 1 && query.length() <= BUCKET_PREFIX_LENGTH) {
+        // Every url in the bucket matches and the best come first
+        QVector<int> ids = bucket(query, now);
+        for (int i = 0; i < ids.count() && matches.count() < maximum; ++i) {
+            const Entry &item = m_entries.at(ids.at(i));
+            if (item.visits == 0 && item.bookmarks == 0)
+                continue;
+            addMatch(matches, score(item, now) * 4, ids.at(i), maximum);
+        }
+    } else if (words.count() == 1) {
+        QMultiMap<QString, int>::const_iterator it = m_prefixes.lowerBound(query);
+        for (; it != m_prefixes.constEnd() && it.key().startsWith(query); ++it) {
+            if ((++steps & 255) == 0 && timer.elapsed() > budget) {
+                timedOut = true;
+                break;
+            }
+            // Prefix matches are what the user most likely wants
+            addMatch(matches, score(m_entries.at(it.value()), now) * 4, it.value(), maximum);
+        }
+    }
+
+    QString longest;
+    foreach (const QString &word, words) {
+        if (word.length() > longest.length())
+            longest = word;
+    }
+
+    const QVector<int> *candidates = 0;
+    if (!timedOut && longest.length() >= 3) {
+        for (int i = 0; i + 3 <= longest.length(); ++i) {
+            QHash<quint64, QVector<int> >::const_iterator it =
+                m_trigrams.constFind(trigram(longest.constData() + i));
+            if (it == m_trigrams.constEnd()) {
+                candidates = 0;
+                break;
+            }
+            if (!candidates || it.value().count() < candidates->count())
+                candidates = &it.value();
+        }
+    }
+
+    if (candidates) {
+        for (int i = 0; i < candidates->count(); ++i) {
+            if ((++steps & 255) == 0 && timer.elapsed() > budget)
+                break;
+            int id = candidates->at(i);
+            const Entry &item = m_entries.at(id);
+            if (item.visits == 0 && item.bookmarks == 0)
+                continue;
+            if (words.count() == 1 && item.key.startsWith(query))
+                continue;
+            bool found = true;
+            foreach (const QString &word, words) {
+                if (!item.key.contains(word) && !item.lowerTitle.contains(word)) {
+                    found = false;
+                    break;
+                }
+            }
+            if (found)
+                addMatch(matches, score(item, now), id, maximum);
+        }
+    }
+
+    for (int i = 0; i < matches.count(); ++i)
+        results.append(m_entries.at(matches.at(i).second).url);
+    return results;
+}
+
+// Returns the id of the url, adding it if it isn't known
+int LocationCompletionIndex::entry(const QString &url)
+{
+    int id = m_ids.value(url, -1);
+    if (id != -1)
+        return id;
+
+    Entry item;
+    item.url = url;
+    item.key = key(url);
+    id = m_entries.count();
+    m_entries.append(item);
+    m_ids.insert(url, id);
+    m_prefixes.insert(item.key, id);
+    indexText(id, item.key);
+    for (int length = 1; length <= qMin(BUCKET_PREFIX_LENGTH, item.key.length()); ++length)
+        m_buckets[item.key.left(length)].ids.append(id);
+    return id;
+}
+
+void LocationCompletionIndex::setTitle(int id, const QString &title)
+{
+    Entry &item = m_entries[id];
+    if (title == item.title)
+        return;
+    item.title = title;
+    item.lowerTitle = title.toLower();
+    indexText(id, item.lowerTitle);
+}
+
+void LocationCompletionIndex::indexText(int id, const QString &text)
+{
+    const QChar *data = text.constData();
+    for (int i = 0; i + 3 <= text.length(); ++i) {
+        QVector<int> &ids = m_trigrams[trigram(data + i)];
+        if (ids.isEmpty() || ids.last() != id)
+            ids.append(id);
+    }
+}
+
+// The score of the url changed, its buckets have to be sorted again
+void LocationCompletionIndex::touch(int id)
+{
+    const QString &key = m_entries.at(id).key;
+    for (int length = 1; length <= qMin(BUCKET_PREFIX_LENGTH, key.length()); ++length)
+        m_buckets[key.left(length)].sorted = false;
+}
+
+/*
+    The urls with keys starting with \a prefix, best score first.  Removed
+    urls are dropped when the bucket is sorted.
+  */
+QVector<int> LocationCompletionIndex::bucket(const QString &prefix, uint now) const
+{
+    QHash<QString, Bucket>::iterator it = m_buckets.find(prefix);
+    if (it == m_buckets.end())
+        return QVector<int>();
+    Bucket &bucket = it.value();
+    if (!bucket.sorted || now - bucket.sortedAt > BUCKET_SORT_INTERVAL) {
+        QVector<QPair<int, int> > scores;
+        scores.reserve(bucket.ids.count());
+        foreach (int id, bucket.ids) {
+            const Entry &item = m_entries.at(id);
+            if (item.visits > 0 || item.bookmarks > 0)
+                scores.append(qMakePair(-score(item, now), id));
+        }
+        qSort(scores.begin(), scores.end());
+        bucket.ids.resize(scores.count());
+        for (int i = 0; i < scores.count(); ++i)
+            bucket.ids[i] = scores.at(i).second;
+        bucket.sorted = true;
+        bucket.sortedAt = now;
+    }
+    return bucket.ids;
+}
+
+// Drops the url once nothing refers to it anymore
+void LocationCompletionIndex::release(int id)
+{
+    const Entry &item = m_entries.at(id);
+    if (item.visits > 0 || item.bookmarks > 0)
+        return;
+    m_ids.remove(item.url);
+    m_prefixes.remove(item.key, id);
+    ++m_removed;
+    if (m_removed > 1024 && m_removed * 2 > m_entries.count())
+        rebuild();
+}
+
+// Renumbers the remaining urls which drops the removed ones from the trigram lists
+void LocationCompletionIndex::rebuild()
+{
+    QVector<Entry> entries = m_entries;
+    clear();
+    for (int i = 0; i < entries.count(); ++i) {
+        const Entry &item = entries.at(i);
+        if (item.visits == 0 && item.bookmarks == 0)
+            continue;
+        int id = m_entries.count();
+        m_entries.append(item);
+        m_ids.insert(item.url, id);
+        m_prefixes.insert(item.key, id);
+        for (int length = 1; length <= qMin(BUCKET_PREFIX_LENGTH, item.key.length()); ++length)
+            m_buckets[item.key.left(length)].ids.append(id);
+        indexText(id, item.key);
+        indexText(id, item.lowerTitle);
+    }
+}
+
+/*
+    Frecency, the visits weighted by how recent the last one was,
+    a bookmark counts for a few recent visits.
+  */
+int LocationCompletionIndex::score(const Entry &entry, uint now) const
+{
+    uint days = (now > entry.lastVisit) ? (now - entry.lastVisit) / 86400 : 0;
+    int weight = 10;
+    if (days <= 4)
+        weight = 100;
+    else if (days <= 14)
+        weight = 70;
+    else if (days <= 31)
+        weight = 50;
+    else if (days <= 90)
+        weight = 30;
+    return entry.visits * weight + entry.bookmarks * 150;
+}
+
+LocationCompletionModel::LocationCompletionModel(HistoryManager *history, BookmarksManager *bookmarks, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_history(history)
+    , m_bookmarks(bookmarks)
+{
+    if (m_history) {
+        connect(m_history, SIGNAL(urlEntriesReset()),
+                this, SLOT(historyUrlsReset()));
+        connect(m_history, SIGNAL(urlEntryAdded(int)),
+                this, SLOT(historyUrlAdded(int)));
+        connect(m_history, SIGNAL(urlEntriesAdded(int, int)),
+                this, SLOT(historyUrlsAdded(int, int)));
+        connect(m_history, SIGNAL(urlEntryAboutToBeRemoved(int)),
+                this, SLOT(historyUrlAboutToBeRemoved(int)));
+        connect(m_history, SIGNAL(urlEntryUpdated(int)),
+                this, SLOT(historyUrlUpdated(int)));
+    }
+    if (m_bookmarks) {
+        connect(m_bookmarks, SIGNAL(entryAdded(BookmarkNode *)),
+                this, SLOT(bookmarkAdded(BookmarkNode *)));
+        connect(m_bookmarks, SIGNAL(entryRemoved(BookmarkNode *, int, BookmarkNode *)),
+                this, SLOT(bookmarkRemoved(BookmarkNode *, int, BookmarkNode *)));
+        connect(m_bookmarks, SIGNAL(entryChanged(BookmarkNode *)),
+                this, SLOT(bookmarkChanged(BookmarkNode *)));
+    }
+    load();
+}
+
+QVariant LocationCompletionModel::data(const QModelIndex &index, int role) const
+{
+    if (index.row() < 0 || index.row() >= m_results.count() || index.parent().isValid())
+        return QVariant();
+
+    const QString &url = m_results.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+    case Qt::EditRole:
+        return url;
+    case Qt::ToolTipRole:
+        return m_index.title(url);
+    }
+    return QVariant();
+}
+
+int LocationCompletionModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_results.count();
+}
+
+QString LocationCompletionModel::query() const
+{
+    return m_query;
+}
+
+void LocationCompletionModel::setQuery(const QString &text)
+{
+    m_query = text;
+    m_refreshTimer.stop();
+    m_results = m_index.complete(text, MAXIMUM_RESULTS, LATENCY_BUDGET);
+    reset();
+}
+
+// Refreshes the results once the history that arrived in the meantime is in the index
+void LocationCompletionModel::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_refreshTimer.timerId()) {
+        QAbstractListModel::timerEvent(event);
+        return;
+    }
+    m_refreshTimer.stop();
+    setQuery(m_query);
+}
+
+/*
+    One entry for each url in the history, history that is still loading
+    is added as it comes in.
+  */
+void LocationCompletionModel::load()
+{
+    m_index.clear();
+    m_bookmarkUrls.clear();
+    if (m_history) {
+        for (int i = 0; i < m_history->urlEntryCount(); ++i)
+            updateUrl(i);
+    }
+    if (m_bookmarks)
+        addBookmarks(m_bookmarks->bookmarks());
+}
+
+void LocationCompletionModel::updateUrl(int row)
+{
+    HistoryUrlEntry entry = m_history->urlEntryAt(row);
+    m_index.setVisits(entry.url, entry.title, entry.visitCount, entry.lastVisit);
+    if (!m_query.isEmpty() && m_history->isLoading() && !m_refreshTimer.isActive())
+        m_refreshTimer.start(0, this);
+}
+
+void LocationCompletionModel::historyUrlsReset()
+{
+    load();
+    if (!m_query.isEmpty() && !m_refreshTimer.isActive())
+        m_refreshTimer.start(0, this);
+}
+
+void LocationCompletionModel::historyUrlAdded(int row)
+{
+    updateUrl(row);
+}
+
+void LocationCompletionModel::historyUrlsAdded(int row, int count)
+{
+    for (int i = row; i < row + count; ++i)
+        updateUrl(i);
+}
+
+void LocationCompletionModel::historyUrlAboutToBeRemoved(int row)
+{
+    HistoryUrlEntry entry = m_history->urlEntryAt(row);
+    m_index.setVisits(entry.url, QString(), 0, QDateTime());
+}
+
+void LocationCompletionModel::historyUrlUpdated(int row)
+{
+    updateUrl(row);
+}
+
+void LocationCompletionModel::bookmarkAdded(BookmarkNode *node)
+{
+    addBookmarks(node);
+}
+
+void LocationCompletionModel::bookmarkRemoved(BookmarkNode *parent, int row, BookmarkNode *node)
+{
+    Q_UNUSED(parent);
+    Q_UNUSED(row);
+    removeBookmarks(node);
+}
+
+void LocationCompletionModel::bookmarkChanged(BookmarkNode *node)
+{
+    if (node->type() != BookmarkNode::Bookmark)
+        return;
+    QString url = m_bookmarkUrls.value(node);
+    if (url == node->url)
+        return;
+    if (m_bookmarkUrls.contains(node))
+        m_index.removeBookmark(url);
+    m_index.addBookmark(node->url, node->title);
+    m_bookmarkUrls.insert(node, node->url);
+}
+
+void LocationCompletionModel::addBookmarks(BookmarkNode *node)
+{
+    if (!node)
+        return;
+    if (node->type() == BookmarkNode::Bookmark && !node->url.isEmpty()) {
+        m_index.addBookmark(node->url, node->title);
+        m_bookmarkUrls.insert(node, node->url);
+    }
+    foreach (BookmarkNode *child, node->children())
+        addBookmarks(child);
+}
+
+void LocationCompletionModel::removeBookmarks(BookmarkNode *node)
+{
+    if (m_bookmarkUrls.contains(node))
+        m_index.removeBookmark(m_bookmarkUrls.take(node));
+    foreach (BookmarkNode *child, node->children())
+        removeBookmarks(child);
+}
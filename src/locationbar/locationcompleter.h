@@ -0,0 +1,152 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef LOCATIONCOMPLETER_H
+#define LOCATIONCOMPLETER_H
+
+#include <qabstractitemmodel.h>
+#include <qbasictimer.h>
+#include <qdatetime.h>
+#include <qhash.h>
+#include <qmap.h>
+#include <qstringlist.h>
+#include <qvector.h>
+
+/*
+    Index of every url in the history and bookmarks used to complete what
+    is typed into the location bar.
+
+    Each url is kept once with its visit count, last visit and bookmark count
+    which make up its frecency score.  Urls are found either by a prefix of
+    their key (the url without the scheme and "www.") or by the trigrams of
+    their key and title, so a query only looks at the urls that can match it.
+    A prefix of one or two characters matches too many urls to look at all
+    of them, those urls are kept in buckets sorted by score so the best ones
+    are found first.  Removed urls are left in the trigram lists and skipped
+    until enough of them pile up to be worth rebuilding the lists.
+  */
+class LocationCompletionIndex
+{
+public:
+    LocationCompletionIndex();
+
+    void clear();
+    int count() const;
+
+    void setVisits(const QString &url, const QString &title, int visits, const QDateTime &lastVisit);
+    void addBookmark(const QString &url, const QString &title);
+    void removeBookmark(const QString &url);
+
+    QString title(const QString &url) const;
+    QStringList complete(const QString &text, int maximum, int budget) const;
+
+    static QString key(const QString &url);
+
+private:
+    struct Entry {
+        Entry() : visits(0), bookmarks(0), lastVisit(0) {}
+        QString url;
+        QString key;
+        QString title;
+        QString lowerTitle;
+        int visits;
+        int bookmarks;
+        uint lastVisit;
+    };
+
+    struct Bucket {
+        Bucket() : sorted(false), sortedAt(0) {}
+        QVector<int> ids;
+        bool sorted;
+        uint sortedAt;
+    };
+
+    int entry(const QString &url);
+    void setTitle(int id, const QString &title);
+    void indexText(int id, const QString &text);
+    void touch(int id);
+    QVector<int> bucket(const QString &prefix, uint now) const;
+    void release(int id);
+    void rebuild();
+    int score(const Entry &entry, uint now) const;
+
+    QVector<Entry> m_entries;
+    QHash<QString, int> m_ids;
+    QMultiMap<QString, int> m_prefixes;
+    // Sorted when they are queried
+    mutable QHash<QString, Bucket> m_buckets;
+    QHash<quint64, QVector<int> > m_trigrams;
+    int m_removed;
+};
+
+class HistoryManager;
+class BookmarksManager;
+class BookmarkNode;
+
+/*
+    Model for the location bar completer with the best matches of the last
+    query.  The index is filled from the url table of the history manager
+    and the bookmarks when it is created and then kept up to date.  History
+    that is still loading is added as it arrives and the results refreshed.
+  */
+class LocationCompletionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    LocationCompletionModel(HistoryManager *history, BookmarksManager *bookmarks, QObject *parent = 0);
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+    QString query() const;
+
+public slots:
+    void setQuery(const QString &text);
+
+protected:
+    void timerEvent(QTimerEvent *event);
+
+private slots:
+    void historyUrlsReset();
+    void historyUrlAdded(int row);
+    void historyUrlsAdded(int row, int count);
+    void historyUrlAboutToBeRemoved(int row);
+    void historyUrlUpdated(int row);
+    void bookmarkAdded(BookmarkNode *node);
+    void bookmarkRemoved(BookmarkNode *parent, int row, BookmarkNode *node);
+    void bookmarkChanged(BookmarkNode *node);
+
+private:
+    void load();
+    void updateUrl(int row);
+    void addBookmarks(BookmarkNode *node);
+    void removeBookmarks(BookmarkNode *node);
+
+    HistoryManager *m_history;
+    BookmarksManager *m_bookmarks;
+    LocationCompletionIndex m_index;
+    QHash<BookmarkNode*, QString> m_bookmarkUrls;
+    QBasicTimer m_refreshTimer;
+    QString m_query;
+    QStringList m_results;
+};
+
+#endif // LOCATIONCOMPLETER_H
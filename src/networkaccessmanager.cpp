@@ -63,8 +63,11 @@
 #include "networkaccessmanager.h"
 
 #include "acceptlanguagedialog.h"
+#include "adblockblockednetworkreply.h"
+#include "adblockmanager.h"
 #include "browserapplication.h"
 #include "browsermainwindow.h"
+#include "requestscheduler.h"
 #include "schemeaccesshandler.h"
 #include "ui_passworddialog.h"
 #include "ui_proxy.h"
@@ -82,8 +85,13 @@
 #include <qsslerror.h>
 #include <qdatetime.h>
 
+#include <qwebframe.h>
+#include <qwebpage.h>
+
 #if QT_VERSION >= 0x040500
-#include <qnetworkdiskcache.h>
+#include "networkcache.h"
+#include "networkdiskcache.h"
+
 #include <qdesktopservices.h>
 #endif
 
@@ -117,6 +125,8 @@ QList<QNetworkProxy> NetworkProxyFactory::queryProxy(const QNetworkProxyQuery &q
 
 NetworkAccessManager::NetworkAccessManager(QObject *parent)
     : QNetworkAccessManager(parent)
+    , m_requestScheduler(new RequestScheduler(this))
+    , m_adBlockManager(new AdBlockManager(this))
 {
     connect(this, SIGNAL(authenticationRequired(QNetworkReply*, QAuthenticator*)),
             SLOT(authenticationRequired(QNetworkReply*, QAuthenticator*)));
@@ -139,6 +149,16 @@ void NetworkAccessManager::setSchemeHandler(const QString &scheme, SchemeAccessH
     m_schemeHandlers.insert(scheme, handler);
 }
 
+RequestScheduler *NetworkAccessManager::requestScheduler() const
+{
+    return m_requestScheduler;
+}
+
+AdBlockManager *NetworkAccessManager::adBlockManager() const
+{
+    return m_adBlockManager;
+}
+
 void NetworkAccessManager::loadSettings()
 {
     QSettings settings;
@@ -198,24 +218,29 @@ void NetworkAccessManager::loadSettings()
 
     if (cacheEnabled) {
         int maximumCacheSize = settings.value(QLatin1String("maximumCacheSize"), 50).toInt() * 1024 * 1024;
+        int maximumMemoryCacheSize = settings.value(QLatin1String("maximumMemoryCacheSize"), 8).toInt() * 1024 * 1024;
 
-        QNetworkDiskCache *diskCache;
-        if (cache())
-            diskCache = qobject_cast<QNetworkDiskCache*>(cache());
-        else
-            diskCache = new QNetworkDiskCache(this);
+        NetworkCache *networkCache = qobject_cast<NetworkCache*>(cache());
+        if (!networkCache) {
+            networkCache = new NetworkCache(this);
+            networkCache->setDiskCache(new NetworkDiskCache);
+        }
+        NetworkDiskCache *diskCache = qobject_cast<NetworkDiskCache*>(networkCache->diskCache());
 
         QString location = QDesktopServices::storageLocation(QDesktopServices::CacheLocation)
                                 + QLatin1String("/browser");
         diskCache->setCacheDirectory(location);
         diskCache->setMaximumCacheSize(maximumCacheSize);
-        setCache(diskCache);
+        networkCache->setMaximumMemorySize(maximumMemoryCacheSize);
+        setCache(networkCache);
     } else {
         if (QLatin1String(qVersion()) > QLatin1String("4.5.1"))
             setCache(0);
     }
 #endif
     settings.endGroup();
+
+    m_adBlockManager->loadSettings();
 }
 
 void NetworkAccessManager::privacyChanged(bool isPrivate)
@@ -379,14 +404,59 @@ QNetworkReply *NetworkAccessManager::createRequest(QNetworkAccessManager::Operat
         return reply;
     }
 
-    if (!m_acceptLanguage.isEmpty()) {
-        QNetworkRequest req = request;
-        req.setRawHeader("Accept-Language", m_acceptLanguage);
-        reply = QNetworkAccessManager::createRequest(op, req, outgoingData);
-        emit requestCreated(op, req, reply);
-    } else {
-        reply = QNetworkAccessManager::createRequest(op, request, outgoingData);
+    // Requests started by the scheduler have already been announced
+    if (request.attribute(RequestScheduler::ScheduledAttribute).toBool())
+        return QNetworkAccessManager::createRequest(op, request, outgoingData);
+
+    if (const AdBlockRule *rule = blockedBy(request)) {
+        reply = new AdBlockBlockedNetworkReply(op, request, rule, this);
         emit requestCreated(op, request, reply);
+        return reply;
     }
+
+    QNetworkRequest req = request;
+    if (!m_acceptLanguage.isEmpty())
+        req.setRawHeader("Accept-Language", m_acceptLanguage);
+
+    if (RequestScheduler::canSchedule(op, req))
+        reply = m_requestScheduler->schedule(op, req);
+    else
+        reply = QNetworkAccessManager::createRequest(op, req, outgoingData);
+    emit requestCreated(op, req, reply);
     return reply;
 }
+
+const AdBlockRule *NetworkAccessManager::blockedBy(const QNetworkRequest &request) const
+{
+    if (!m_adBlockManager->isEnabled())
+        return 0;
+
+    // Pages themselves are never blocked, only what they load
+    if (request.attribute(RequestScheduler::MainFrameAttribute).toBool())
+        return 0;
+
+    QUrl url = request.url();
+    QString scheme = url.scheme();
+    if (scheme != QLatin1String("http") && scheme != QLatin1String("https"))
+        return 0;
+
+    // The first party is the document in the frame that loads the request,
+    // while navigating the main frame of the page still shows the old one
+    QUrl firstPartyUrl;
+#if QT_VERSION >= 0x040600
+    if (QWebFrame *frame = qobject_cast<QWebFrame*>(request.originatingObject())) {
+        firstPartyUrl = frame->url();
+        if (firstPartyUrl.isEmpty())
+            firstPartyUrl = frame->requestedUrl();
+    }
+#endif
+    if (firstPartyUrl.isEmpty())
+        firstPartyUrl = QUrl::fromEncoded(request.rawHeader("Referer"));
+    if (firstPartyUrl.isEmpty()) {
+        QObject *object = qVariantValue<QObject*>(request.attribute(RequestScheduler::PageAttribute));
+        if (QWebPage *page = qobject_cast<QWebPage*>(object))
+            firstPartyUrl = page->mainFrame()->url();
+    }
+
+    return m_adBlockManager->block(url, firstPartyUrl, AdBlockRequest::typeForUrl(url));
+}
@@ -67,6 +67,9 @@
 #include <qnetworkproxy.h>
 #include <qsslconfiguration.h>
 
+class AdBlockManager;
+class AdBlockRule;
+class RequestScheduler;
 class SchemeAccessHandler;
 
 #if QT_VERSION >= 0x040500
@@ -96,6 +99,8 @@ signals:
 public:
     NetworkAccessManager(QObject *parent = 0);
     void setSchemeHandler(const QString &scheme, SchemeAccessHandler *handler);
+    RequestScheduler *requestScheduler() const;
+    AdBlockManager *adBlockManager() const;
 
 protected:
     QNetworkReply *createRequest(QNetworkAccessManager::Operation op, const QNetworkRequest &request, QIODevice *outgoingData = 0);
@@ -112,12 +117,16 @@ private slots:
 #endif
 
 private:
+    friend class NetworkAccessManagerProxy;
 #ifndef QT_NO_OPENSSL
     static QString certToFormattedString(QSslCertificate cert);
 #endif
+    const AdBlockRule *blockedBy(const QNetworkRequest &request) const;
 
     QByteArray m_acceptLanguage;
     QHash<QString, SchemeAccessHandler *> m_schemeHandlers;
+    RequestScheduler *m_requestScheduler;
+    AdBlockManager *m_adBlockManager;
 };
 
 #endif // NETWORKACCESSMANAGER_H
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "networkaccessmanagerproxy.h"
+
+#include "networkaccessmanager.h"
+#include "requestscheduler.h"
+#include "webpage.h"
+
+#include <qnetworkcookie.h>
+
+NetworkAccessManagerProxy::NetworkAccessManagerProxy(WebPage *page, NetworkAccessManager *primary)
+    : QNetworkAccessManager(page)
+    , m_page(page)
+    , m_primary(primary)
+{
+    // setCookieJar() reparents the jar, give it back to the primary manager
+    QNetworkCookieJar *cookieJar = primary->cookieJar();
+    setCookieJar(cookieJar);
+    cookieJar->setParent(primary);
+}
+
+QNetworkReply *NetworkAccessManagerProxy::createRequest(QNetworkAccessManager::Operation op, const QNetworkRequest &request, QIODevice *outgoingData)
+{
+    QNetworkRequest pageRequest = request;
+    pageRequest.setAttribute(RequestScheduler::PageAttribute, qVariantFromValue(static_cast<QObject*>(m_page)));
+    if (QObject *frame = m_page->takeNavigation(request)) {
+        if (frame == m_page->mainFrame())
+            pageRequest.setAttribute(RequestScheduler::MainFrameAttribute, true);
+        else
+            pageRequest.setAttribute(RequestScheduler::SubFrameAttribute, true);
+    }
+    return m_primary->createRequest(op, pageRequest, outgoingData);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef NETWORKACCESSMANAGERPROXY_H
+#define NETWORKACCESSMANAGERPROXY_H
+
+#include <qnetworkaccessmanager.h>
+
+class NetworkAccessManager;
+class WebPage;
+
+/*
+    The network access manager of a single WebPage.
+
+    Every request is handed on to the primary NetworkAccessManager after
+    tagging it with the page it was made for, so the RequestScheduler can
+    tell which requests belong to the page that is being looked at.  The
+    documents the frames of the page navigate to are tagged as well.
+    The cookie jar of the primary manager is shared, not taken over.
+  */
+class NetworkAccessManagerProxy : public QNetworkAccessManager
+{
+    Q_OBJECT
+
+public:
+    NetworkAccessManagerProxy(WebPage *page, NetworkAccessManager *primary);
+
+protected:
+    QNetworkReply *createRequest(QNetworkAccessManager::Operation op, const QNetworkRequest &request, QIODevice *outgoingData = 0);
+
+private:
+    WebPage *m_page;
+    NetworkAccessManager *m_primary;
+};
+
+#endif // NETWORKACCESSMANAGERPROXY_H
@@ -0,0 +1,336 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "networkcache.h"
+
+#include <qbuffer.h>
+#include <qurl.h>
+
+/*
+    The device handed out by NetworkCache::prepare(), passes everything on
+    to the disk cache and keeps a copy for the memory cache for as long as
+    the response stays small enough.
+  */
+class NetworkCacheWriter : public QIODevice
+{
+public:
+    NetworkCacheWriter(const QNetworkCacheMetaData &metaData, QIODevice *diskDevice, int maximumSize)
+        : m_metaData(metaData)
+        , m_diskDevice(diskDevice)
+        , m_maximumSize(maximumSize)
+        , m_keepData(maximumSize > 0)
+    {
+        open(QIODevice::WriteOnly);
+    }
+
+    QNetworkCacheMetaData metaData() const { return m_metaData; }
+    QIODevice *diskDevice() const { return m_diskDevice; }
+    void setDiskDevice(QIODevice *device) { m_diskDevice = device; }
+    bool hasData() const { return m_keepData; }
+    QByteArray data() const { return m_data; }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize)
+    {
+        Q_UNUSED(data);
+        Q_UNUSED(maxSize);
+        return -1;
+    }
+
+    qint64 writeData(const char *data, qint64 size)
+    {
+        if (m_diskDevice && m_diskDevice->write(data, size) != size)
+            return -1;
+        if (m_keepData) {
+            if (m_data.size() + size > m_maximumSize) {
+                m_keepData = false;
+                m_data.clear();
+            } else {
+                m_data.append(data, size);
+            }
+        }
+        return size;
+    }
+
+private:
+    QNetworkCacheMetaData m_metaData;
+    QIODevice *m_diskDevice;
+    int m_maximumSize;
+    bool m_keepData;
+    QByteArray m_data;
+};
+
+NetworkCache::NetworkCache(QObject *parent)
+    : QAbstractNetworkCache(parent)
+    , m_diskCache(0)
+    , m_memory(8 * 1024 * 1024)
+    , m_memoryHits(0)
+    , m_diskHits(0)
+    , m_misses(0)
+    , m_memoryBytesServed(0)
+    , m_diskBytesServed(0)
+{
+}
+
+NetworkCache::~NetworkCache()
+{
+    qDeleteAll(m_inserting);
+}
+
+QAbstractNetworkCache *NetworkCache::diskCache() const
+{
+    return m_diskCache;
+}
+
+/*
+    Takes ownership of \a cache, any previous disk cache is deleted.
+  */
+void NetworkCache::setDiskCache(QAbstractNetworkCache *cache)
+{
+    if (m_diskCache == cache)
+        return;
+    qDeleteAll(m_inserting);
+    m_inserting.clear();
+    m_memory.clear();
+    m_lastDiskMetaData = QNetworkCacheMetaData();
+    delete m_diskCache;
+    m_diskCache = cache;
+    if (m_diskCache)
+        m_diskCache->setParent(this);
+}
+
+int NetworkCache::maximumMemorySize() const
+{
+    return m_memory.maxCost();
+}
+
+void NetworkCache::setMaximumMemorySize(int size)
+{
+    m_memory.setMaxCost(qMax(0, size));
+}
+
+int NetworkCache::memorySize() const
+{
+    return m_memory.totalCost();
+}
+
+int NetworkCache::memoryCount() const
+{
+    return m_memory.count();
+}
+
+int NetworkCache::memoryHits() const
+{
+    return m_memoryHits;
+}
+
+int NetworkCache::diskHits() const
+{
+    return m_diskHits;
+}
+
+int NetworkCache::misses() const
+{
+    return m_misses;
+}
+
+qint64 NetworkCache::memoryBytesServed() const
+{
+    return m_memoryBytesServed;
+}
+
+qint64 NetworkCache::diskBytesServed() const
+{
+    return m_diskBytesServed;
+}
+
+void NetworkCache::resetStatistics()
+{
+    m_memoryHits = 0;
+    m_diskHits = 0;
+    m_misses = 0;
+    m_memoryBytesServed = 0;
+    m_diskBytesServed = 0;
+}
+
+// Responses bigger than this would push too much else out of memory
+int NetworkCache::maximumItemSize() const
+{
+    return m_memory.maxCost() / 8;
+}
+
+int NetworkCache::cost(const QNetworkCacheMetaData &metaData, const QByteArray &data)
+{
+    int size = data.size();
+    foreach (const QNetworkCacheMetaData::RawHeader &header, metaData.rawHeaders())
+        size += header.first.size() + header.second.size();
+    return size;
+}
+
+void NetworkCache::insertIntoMemory(const QNetworkCacheMetaData &metaData, const QByteArray &data)
+{
+    int size = cost(metaData, data);
+    if (size > maximumItemSize()) {
+        m_memory.remove(metaData.url().toEncoded());
+        return;
+    }
+    Entry *entry = new Entry;
+    entry->metaData = metaData;
+    entry->data = data;
+    m_memory.insert(metaData.url().toEncoded(), entry, size);
+}
+
+QNetworkCacheMetaData NetworkCache::metaData(const QUrl &url)
+{
+    if (Entry *entry = m_memory.object(url.toEncoded()))
+        return entry->metaData;
+    if (!m_diskCache)
+        return QNetworkCacheMetaData();
+
+    m_lastDiskMetaData = m_diskCache->metaData(url);
+    if (!m_lastDiskMetaData.isValid())
+        ++m_misses;
+    return m_lastDiskMetaData;
+}
+
+void NetworkCache::updateMetaData(const QNetworkCacheMetaData &metaData)
+{
+    if (Entry *entry = m_memory.object(metaData.url().toEncoded()))
+        entry->metaData = metaData;
+    if (m_lastDiskMetaData.url() == metaData.url())
+        m_lastDiskMetaData = QNetworkCacheMetaData();
+    if (m_diskCache)
+        m_diskCache->updateMetaData(metaData);
+}
+
+QIODevice *NetworkCache::data(const QUrl &url)
+{
+    QByteArray key = url.toEncoded();
+    QByteArray data;
+    if (Entry *entry = m_memory.object(key)) {
+        data = entry->data;
+        ++m_memoryHits;
+        m_memoryBytesServed += data.size();
+    } else {
+        if (!m_diskCache)
+            return 0;
+        QIODevice *device = m_diskCache->data(url);
+        if (!device) {
+            ++m_misses;
+            return 0;
+        }
+        ++m_diskHits;
+        m_diskBytesServed += device->size();
+        if (device->size() > maximumItemSize())
+            return device;
+
+        data = device->readAll();
+        delete device;
+        QNetworkCacheMetaData metaData = m_lastDiskMetaData;
+        if (metaData.url() != url)
+            metaData = m_diskCache->metaData(url);
+        if (metaData.isValid())
+            insertIntoMemory(metaData, data);
+    }
+
+    QBuffer *buffer = new QBuffer;
+    buffer->setData(data);
+    buffer->open(QBuffer::ReadOnly);
+    return buffer;
+}
+
+bool NetworkCache::remove(const QUrl &url)
+{
+    // QNetworkAccessManager also calls remove() to throw away a response
+    // that is being inserted, the disk cache does the same for its device
+    QHash<QIODevice*, NetworkCacheWriter*>::iterator it = m_inserting.begin();
+    while (it != m_inserting.end()) {
+        if (it.value()->metaData().url() == url) {
+            delete it.value();
+            it = m_inserting.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (m_lastDiskMetaData.url() == url)
+        m_lastDiskMetaData = QNetworkCacheMetaData();
+    bool removed = m_memory.remove(url.toEncoded());
+    if (m_diskCache && m_diskCache->remove(url))
+        removed = true;
+    return removed;
+}
+
+/*
+    Returns the size of the disk cache.  Responses that are only kept in
+    memory are left out: those the disk cache refused to store and those it
+    has dropped since while memory still serves them.  They are at most
+    maximumMemorySize() bytes.
+  */
+qint64 NetworkCache::cacheSize() const
+{
+    if (m_diskCache)
+        return m_diskCache->cacheSize();
+    return 0;
+}
+
+QIODevice *NetworkCache::prepare(const QNetworkCacheMetaData &metaData)
+{
+    if (!metaData.isValid() || !metaData.url().isValid() || !metaData.saveToDisk())
+        return 0;
+
+    QIODevice *diskDevice = 0;
+    if (m_diskCache)
+        diskDevice = m_diskCache->prepare(metaData);
+    if (!diskDevice && maximumItemSize() <= 0)
+        return 0;
+
+    NetworkCacheWriter *writer = new NetworkCacheWriter(metaData, diskDevice, maximumItemSize());
+    m_inserting.insert(writer, writer);
+    return writer;
+}
+
+void NetworkCache::insert(QIODevice *device)
+{
+    NetworkCacheWriter *writer = m_inserting.take(device);
+    if (!writer)
+        return;
+
+    if (writer->diskDevice()) {
+        m_diskCache->insert(writer->diskDevice());
+        writer->setDiskDevice(0);
+    }
+    if (m_lastDiskMetaData.url() == writer->metaData().url())
+        m_lastDiskMetaData = QNetworkCacheMetaData();
+    if (writer->hasData())
+        insertIntoMemory(writer->metaData(), writer->data());
+    else
+        m_memory.remove(writer->metaData().url().toEncoded());
+    delete writer;
+}
+
+void NetworkCache::clear()
+{
+    // Responses that are being inserted still arrive, they are written
+    // to the emptied cache
+    m_memory.clear();
+    m_lastDiskMetaData = QNetworkCacheMetaData();
+    if (m_diskCache)
+        m_diskCache->clear();
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef NETWORKCACHE_H
+#define NETWORKCACHE_H
+
+#include <qabstractnetworkcache.h>
+
+#include <qcache.h>
+#include <qhash.h>
+
+class NetworkCacheWriter;
+
+/*
+    A two tier network cache: recently used small responses are kept in
+    memory in front of a disk cache that holds everything.
+
+    Responses are written through to the disk cache as they arrive and a
+    copy of the ones that fit is kept in memory.  The memory tier is a least
+    recently used list limited to maximumMemorySize() bytes, when it is full
+    the oldest responses are dropped from memory and only served from disk
+    from then on.  A response read from disk is promoted back into memory.
+    The two tiers are not kept in step otherwise, memory may still serve a
+    response the disk cache has dropped, and cacheSize() only reports the
+    disk.
+
+    Responses served from memory are handed out as a QBuffer sharing the
+    cached QByteArray, so a hit costs neither disk access nor a copy.
+  */
+class NetworkCache : public QAbstractNetworkCache
+{
+    Q_OBJECT
+
+public:
+    NetworkCache(QObject *parent = 0);
+    ~NetworkCache();
+
+    QAbstractNetworkCache *diskCache() const;
+    void setDiskCache(QAbstractNetworkCache *cache);
+
+    int maximumMemorySize() const;
+    void setMaximumMemorySize(int size);
+    int memorySize() const;
+    int memoryCount() const;
+
+    // Statistics since the cache was created or resetStatistics() was called
+    int memoryHits() const;
+    int diskHits() const;
+    int misses() const;
+    qint64 memoryBytesServed() const;
+    qint64 diskBytesServed() const;
+    void resetStatistics();
+
+    QNetworkCacheMetaData metaData(const QUrl &url);
+    void updateMetaData(const QNetworkCacheMetaData &metaData);
+    QIODevice *data(const QUrl &url);
+    bool remove(const QUrl &url);
+    qint64 cacheSize() const;
+
+    QIODevice *prepare(const QNetworkCacheMetaData &metaData);
+    void insert(QIODevice *device);
+
+public slots:
+    void clear();
+
+private:
+    struct Entry {
+        QNetworkCacheMetaData metaData;
+        QByteArray data;
+    };
+
+    int maximumItemSize() const;
+    void insertIntoMemory(const QNetworkCacheMetaData &metaData, const QByteArray &data);
+    static int cost(const QNetworkCacheMetaData &metaData, const QByteArray &data);
+
+    QAbstractNetworkCache *m_diskCache;
+    QCache<QByteArray, Entry> m_memory;
+    QHash<QIODevice*, NetworkCacheWriter*> m_inserting;
+
+    // QNetworkAccessManager asks for the meta data just before the data,
+    // keep it around so that promoting a response doesn't read it twice
+    QNetworkCacheMetaData m_lastDiskMetaData;
+
+    int m_memoryHits;
+    int m_diskHits;
+    int m_misses;
+    qint64 m_memoryBytesServed;
+    qint64 m_diskBytesServed;
+};
+
+#endif // NETWORKCACHE_H
@@ -0,0 +1,10 @@
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+HEADERS += \
+  networkcache.h \
+  networkdiskcache.h
+
+SOURCES += \
+  networkcache.cpp \
+  networkdiskcache.cpp
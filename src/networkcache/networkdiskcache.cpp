@@ -0,0 +1,866 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "networkdiskcache.h"
+
+#include <qbuffer.h>
+#include <qcryptographichash.h>
+#include <qdatastream.h>
+#include <qdir.h>
+#include <qendian.h>
+#include <qfileinfo.h>
+#include <qset.h>
+#include <qurl.h>
+
+#include <qdebug.h>
+
+static const quint32 INDEX_MAGIC = 0x414e4349;  // ANCI
+static const quint32 RECORD_MAGIC = 0x414e4352; // ANCR
+static const quint32 CACHE_VERSION = 1;
+
+// index: magic, version, slot count, shard count, access clock, reserved
+static const int INDEX_HEADER_SIZE = 32;
+// record: magic, url length, meta data length, data length, hash
+static const int RECORD_HEADER_SIZE = 24;
+
+static const int SHARD_COUNT = 4;
+static const quint32 INITIAL_SLOT_COUNT = 4096;
+static const int COPY_BUFFER_SIZE = 64 * 1024;
+
+static QByteArray recordHeader(quint32 urlLength, quint32 metaDataLength, quint32 dataLength, quint64 hash)
+{
+    QByteArray header(RECORD_HEADER_SIZE, 0);
+    quint32 *values = reinterpret_cast<quint32*>(header.data());
+    values[0] = RECORD_MAGIC;
+    values[1] = urlLength;
+    values[2] = metaDataLength;
+    values[3] = dataLength;
+    qMemCopy(values + 4, &hash, sizeof(hash));
+    return header;
+}
+
+static bool lessThanOffset(const NetworkDiskCacheSlot &s1, const NetworkDiskCacheSlot &s2)
+{
+    return s1.offset < s2.offset;
+}
+
+static bool lessThanLastAccess(const NetworkDiskCacheSlot &s1, const NetworkDiskCacheSlot &s2)
+{
+    return s1.lastAccess < s2.lastAccess;
+}
+
+static inline quint64 slotKey(const NetworkDiskCacheSlot &slot)
+{
+    return (quint64(slot.shard) << 32) | slot.offset;
+}
+
+NetworkDiskCacheCompactor::NetworkDiskCacheCompactor(const QVector<NetworkDiskCacheSlot> &slots,
+                                                     const QVector<Shard> &shards,
+                                                     qint64 maximumSize, QObject *parent)
+    : QThread(parent)
+    , m_slots(slots)
+    , m_shards(shards)
+    , m_maximumSize(maximumSize)
+{
+}
+
+QVector<NetworkDiskCacheCompactor::Shard> NetworkDiskCacheCompactor::shards() const
+{
+    return m_shards;
+}
+
+QString NetworkDiskCacheCompactor::newFileName(const QString &fileName)
+{
+    return fileName + QLatin1String(".new");
+}
+
+void NetworkDiskCacheCompactor::run()
+{
+    QList<NetworkDiskCacheSlot> live;
+    qint64 liveSize = 0;
+    foreach (const NetworkDiskCacheSlot &slot, m_slots) {
+        if (!(slot.flags & NetworkDiskCacheSlot::Used)
+            || int(slot.shard) >= m_shards.count()
+            || slot.offset + slot.size > m_shards.at(slot.shard).size)
+            continue;
+        live.append(slot);
+        liveSize += slot.size;
+    }
+
+    // Drop the least recently used entries until everything fits
+    QSet<quint64> evicted;
+    QVector<bool> hasEvicted(m_shards.count(), false);
+    if (liveSize > m_maximumSize) {
+        QList<NetworkDiskCacheSlot> byAccess = live;
+        qSort(byAccess.begin(), byAccess.end(), lessThanLastAccess);
+        for (int i = 0; i < byAccess.count() && liveSize > m_maximumSize; ++i) {
+            evicted.insert(slotKey(byAccess.at(i)));
+            hasEvicted[byAccess.at(i).shard] = true;
+            liveSize -= byAccess.at(i).size;
+        }
+    }
+
+    for (int i = 0; i < m_shards.count(); ++i) {
+        QList<NetworkDiskCacheSlot> records;
+        quint32 recordsSize = 0;
+        foreach (const NetworkDiskCacheSlot &slot, live) {
+            if (int(slot.shard) != i || evicted.contains(slotKey(slot)))
+                continue;
+            records.append(slot);
+            recordsSize += slot.size;
+        }
+        Shard &shard = m_shards[i];
+        quint32 garbage = shard.size - recordsSize;
+        if (hasEvicted.at(i) || garbage > shard.size / 4)
+            compact(shard, records);
+    }
+}
+
+bool NetworkDiskCacheCompactor::compact(Shard &shard, QList<NetworkDiskCacheSlot> records)
+{
+    // Reading the records in the order they are in the file keeps seeking down
+    qSort(records.begin(), records.end(), lessThanOffset);
+
+    QFile in(shard.fileName);
+    QFile out(newFileName(shard.fileName));
+    if (!in.open(QFile::ReadOnly) || !out.open(QFile::WriteOnly | QFile::Truncate))
+        return false;
+
+    quint32 offset = 0;
+    foreach (const NetworkDiskCacheSlot &slot, records) {
+        QByteArray record;
+        if (in.seek(slot.offset))
+            record = in.read(slot.size);
+        if (record.size() != int(slot.size) || out.write(record) != record.size()) {
+            out.close();
+            out.remove();
+            shard.moved.clear();
+            return false;
+        }
+        shard.moved.insert(slot.offset, offset);
+        offset += slot.size;
+    }
+    shard.newSize = offset;
+    shard.compacted = true;
+    return true;
+}
+
+NetworkDiskCache::NetworkDiskCache(QObject *parent)
+    : QAbstractNetworkCache(parent)
+    , m_maximumCacheSize(50 * 1024 * 1024)
+    , m_readOnly(false)
+    , m_indexMap(0)
+    , m_slots(0)
+    , m_slotCount(0)
+    , m_usedSlots(0)
+    , m_removedSlots(0)
+    , m_accessClock(0)
+    , m_shards(SHARD_COUNT, 0)
+    , m_shardSizes(SHARD_COUNT, 0)
+    , m_liveSize(0)
+    , m_compactor(0)
+{
+}
+
+NetworkDiskCache::~NetworkDiskCache()
+{
+    cancelCompaction();
+    qDeleteAll(m_inserting.keys());
+    close();
+}
+
+QString NetworkDiskCache::cacheDirectory() const
+{
+    return m_directory;
+}
+
+void NetworkDiskCache::setCacheDirectory(const QString &directory)
+{
+    if (m_directory == directory)
+        return;
+    cancelCompaction();
+    close();
+    m_directory = directory;
+    if (!m_directory.isEmpty())
+        open();
+}
+
+bool NetworkDiskCache::isReadOnly() const
+{
+    return m_readOnly;
+}
+
+void NetworkDiskCache::setReadOnly(bool readOnly)
+{
+    m_readOnly = readOnly;
+}
+
+qint64 NetworkDiskCache::maximumCacheSize() const
+{
+    return m_maximumCacheSize;
+}
+
+void NetworkDiskCache::setMaximumCacheSize(qint64 size)
+{
+    m_maximumCacheSize = size;
+    if (m_slots && m_liveSize > m_maximumCacheSize)
+        startCompaction();
+}
+
+int NetworkDiskCache::entryCount() const
+{
+    return m_usedSlots;
+}
+
+QList<QUrl> NetworkDiskCache::urls()
+{
+    QList<QUrl> urls;
+    for (quint32 i = 0; i < m_slotCount; ++i) {
+        const NetworkDiskCacheSlot &slot = m_slots[i];
+        if (!(slot.flags & NetworkDiskCacheSlot::Used))
+            continue;
+        QFile *file = shardFile(slot.shard);
+        if (!file || !file->seek(slot.offset))
+            continue;
+        QByteArray header = file->read(RECORD_HEADER_SIZE);
+        if (header.size() != RECORD_HEADER_SIZE)
+            continue;
+        const quint32 *values = reinterpret_cast<const quint32*>(header.constData());
+        if (values[0] != RECORD_MAGIC)
+            continue;
+        urls.append(QUrl::fromEncoded(file->read(values[1])));
+    }
+    return urls;
+}
+
+bool NetworkDiskCache::isCompacting() const
+{
+    return m_compactor;
+}
+
+void NetworkDiskCache::waitForCompaction()
+{
+    if (m_compactor)
+        compactionFinished();
+}
+
+quint64 NetworkDiskCache::hash(const QUrl &url)
+{
+    QByteArray digest = QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Md5);
+    quint64 value = qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(digest.constData()));
+    // Zero marks an empty slot
+    return value ? value : 1;
+}
+
+QString NetworkDiskCache::shardFileName(int shard) const
+{
+    return m_directory + QString(QLatin1String("/shard-%1.data")).arg(shard);
+}
+
+QFile *NetworkDiskCache::shardFile(int shard)
+{
+    if (shard < 0 || shard >= SHARD_COUNT || !m_slots)
+        return 0;
+    if (!m_shards.at(shard)) {
+        QFile *file = new QFile(shardFileName(shard));
+        if (!file->open(m_readOnly ? QFile::ReadOnly : QFile::ReadWrite)) {
+            qWarning() << "NetworkDiskCache: unable to open" << file->fileName();
+            delete file;
+            return 0;
+        }
+        m_shards[shard] = file;
+    }
+    return m_shards.at(shard);
+}
+
+static void removeDirectory(const QString &path)
+{
+    QDir dir(path);
+    foreach (const QFileInfo &info, dir.entryInfoList(QDir::Dirs | QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot)) {
+        if (info.isDir() && !info.isSymLink())
+            removeDirectory(info.filePath());
+        else
+            dir.remove(info.fileName());
+    }
+    QDir().rmdir(path);
+}
+
+// Removes what QNetworkDiskCache left behind in the cache directory
+static void removeLegacyCache(const QString &directory)
+{
+    QDir dir(directory);
+    QStringList filters;
+    filters << QLatin1String("data*") << QLatin1String("prepared");
+    foreach (const QFileInfo &info, dir.entryInfoList(filters, QDir::Dirs | QDir::NoDotAndDotDot))
+        removeDirectory(info.filePath());
+}
+
+bool NetworkDiskCache::open()
+{
+    if (!m_readOnly && !QDir().mkpath(m_directory)) {
+        qWarning() << "NetworkDiskCache: unable to create" << m_directory;
+        return false;
+    }
+
+    m_indexFile.setFileName(m_directory + QLatin1String("/index"));
+    if (!m_indexFile.open(m_readOnly ? QFile::ReadOnly : QFile::ReadWrite)) {
+        qWarning() << "NetworkDiskCache: unable to open" << m_indexFile.fileName();
+        return false;
+    }
+
+    quint32 slotCount = 0;
+    QByteArray header = m_indexFile.read(INDEX_HEADER_SIZE);
+    if (header.size() == INDEX_HEADER_SIZE) {
+        const quint32 *values = reinterpret_cast<const quint32*>(header.constData());
+        if (values[0] == INDEX_MAGIC && values[1] == CACHE_VERSION && values[3] == SHARD_COUNT
+            && m_indexFile.size() == INDEX_HEADER_SIZE + qint64(values[2]) * sizeof(NetworkDiskCacheSlot)) {
+            slotCount = values[2];
+            m_accessClock = values[4];
+        }
+    }
+
+    if (!slotCount && m_readOnly) {
+        // Nothing to look at and nothing may be thrown away
+        close();
+        return false;
+    } else if (!slotCount) {
+        // Without an index the shards can't be used
+        for (int i = 0; i < SHARD_COUNT; ++i)
+            QFile::remove(shardFileName(i));
+        removeLegacyCache(m_directory);
+        if (!resizeIndex(INITIAL_SLOT_COUNT)) {
+            close();
+            return false;
+        }
+    } else if (!mapIndex(slotCount)) {
+        close();
+        return false;
+    }
+
+    for (int i = 0; i < SHARD_COUNT; ++i)
+        m_shardSizes[i] = QFileInfo(shardFileName(i)).size();
+    recount();
+    return true;
+}
+
+void NetworkDiskCache::close()
+{
+    unmapIndex();
+    m_indexFile.close();
+    qDeleteAll(m_shards);
+    m_shards.fill(0);
+    m_shardSizes.fill(0);
+    m_slotCount = 0;
+    m_usedSlots = 0;
+    m_removedSlots = 0;
+    m_accessClock = 0;
+    m_liveSize = 0;
+}
+
+bool NetworkDiskCache::mapIndex(quint32 slotCount)
+{
+    qint64 size = INDEX_HEADER_SIZE + qint64(slotCount) * sizeof(NetworkDiskCacheSlot);
+    // A read only cache works on a copy that is thrown away
+    if (!m_readOnly)
+        m_indexMap = m_indexFile.map(0, size);
+    uchar *index = m_indexMap;
+    if (!index) {
+        // Keep it in memory and write it back when we are done
+        m_indexFile.seek(0);
+        m_indexBuffer = m_indexFile.readAll();
+        if (m_indexBuffer.size() != size) {
+            m_indexBuffer.clear();
+            return false;
+        }
+        index = reinterpret_cast<uchar*>(m_indexBuffer.data());
+    }
+    m_slots = reinterpret_cast<NetworkDiskCacheSlot*>(index + INDEX_HEADER_SIZE);
+    m_slotCount = slotCount;
+    return true;
+}
+
+void NetworkDiskCache::unmapIndex()
+{
+    if (m_slots) {
+        quint32 *header = reinterpret_cast<quint32*>(reinterpret_cast<uchar*>(m_slots) - INDEX_HEADER_SIZE);
+        header[4] = m_accessClock;
+    }
+    if (m_indexMap) {
+        m_indexFile.unmap(m_indexMap);
+        m_indexMap = 0;
+    } else if (!m_indexBuffer.isEmpty()) {
+        if (!m_readOnly
+            && (!m_indexFile.seek(0) || m_indexFile.write(m_indexBuffer) != m_indexBuffer.size()))
+            qWarning() << "NetworkDiskCache: unable to write" << m_indexFile.fileName();
+        m_indexBuffer.clear();
+    }
+    m_slots = 0;
+}
+
+/*
+    Rebuilds the index with \a slotCount slots, dropping the removed slots
+    that have piled up.
+  */
+bool NetworkDiskCache::resizeIndex(quint32 slotCount)
+{
+    QVector<NetworkDiskCacheSlot> used;
+    used.reserve(m_usedSlots);
+    for (quint32 i = 0; i < m_slotCount; ++i) {
+        if (m_slots[i].flags & NetworkDiskCacheSlot::Used)
+            used.append(m_slots[i]);
+    }
+    unmapIndex();
+
+    // Shrinking first makes sure the slots are zeroed, which marks them empty
+    QByteArray header(INDEX_HEADER_SIZE, 0);
+    quint32 *values = reinterpret_cast<quint32*>(header.data());
+    values[0] = INDEX_MAGIC;
+    values[1] = CACHE_VERSION;
+    values[2] = slotCount;
+    values[3] = SHARD_COUNT;
+    values[4] = m_accessClock;
+    if (!m_indexFile.resize(0)
+        || !m_indexFile.seek(0)
+        || m_indexFile.write(header) != INDEX_HEADER_SIZE
+        || !m_indexFile.flush()
+        || !m_indexFile.resize(INDEX_HEADER_SIZE + qint64(slotCount) * sizeof(NetworkDiskCacheSlot))
+        || !mapIndex(slotCount)) {
+        qWarning() << "NetworkDiskCache: unable to write" << m_indexFile.fileName();
+        return false;
+    }
+
+    m_usedSlots = 0;
+    m_removedSlots = 0;
+    foreach (const NetworkDiskCacheSlot &slot, used) {
+        NetworkDiskCacheSlot *newSlot = insertSlot(slot.hash);
+        *newSlot = slot;
+    }
+    return true;
+}
+
+void NetworkDiskCache::recount()
+{
+    m_usedSlots = 0;
+    m_removedSlots = 0;
+    m_liveSize = 0;
+    for (quint32 i = 0; i < m_slotCount; ++i) {
+        NetworkDiskCacheSlot &slot = m_slots[i];
+        if (slot.flags & NetworkDiskCacheSlot::Used) {
+            // Left over from a crash, the record didn't make it to the shard
+            if (slot.shard >= quint32(SHARD_COUNT)
+                || slot.offset + slot.size > m_shardSizes.at(slot.shard)) {
+                slot.flags = NetworkDiskCacheSlot::Removed;
+                ++m_removedSlots;
+                continue;
+            }
+            ++m_usedSlots;
+            m_liveSize += slot.size;
+        } else if (slot.flags & NetworkDiskCacheSlot::Removed) {
+            ++m_removedSlots;
+        }
+    }
+}
+
+NetworkDiskCacheSlot *NetworkDiskCache::findSlot(quint64 hash) const
+{
+    if (!m_slots)
+        return 0;
+    quint32 i = hash % m_slotCount;
+    for (quint32 probes = 0; probes < m_slotCount; ++probes) {
+        NetworkDiskCacheSlot *slot = m_slots + i;
+        if (!slot->flags)
+            return 0;
+        if ((slot->flags & NetworkDiskCacheSlot::Used) && slot->hash == hash)
+            return slot;
+        if (++i == m_slotCount)
+            i = 0;
+    }
+    return 0;
+}
+
+/*
+    Returns the slot for \a hash, a new one if there isn't one yet.
+    The index might be rebuilt, so any slot pointer held before is invalid.
+  */
+NetworkDiskCacheSlot *NetworkDiskCache::insertSlot(quint64 hash)
+{
+    if (NetworkDiskCacheSlot *slot = findSlot(hash))
+        return slot;
+
+    // Keep at least half of the slots empty so probing stays short
+    if ((m_usedSlots + m_removedSlots + 1) * 2 > m_slotCount) {
+        quint32 slotCount = m_slotCount;
+        while ((m_usedSlots + 1) * 4 > slotCount)
+            slotCount *= 2;
+        if (!resizeIndex(slotCount))
+            return 0;
+    }
+
+    quint32 i = hash % m_slotCount;
+    while (m_slots[i].flags & NetworkDiskCacheSlot::Used) {
+        if (++i == m_slotCount)
+            i = 0;
+    }
+    NetworkDiskCacheSlot *slot = m_slots + i;
+    if (slot->flags & NetworkDiskCacheSlot::Removed)
+        --m_removedSlots;
+    qMemSet(slot, 0, sizeof(NetworkDiskCacheSlot));
+    slot->hash = hash;
+    slot->flags = NetworkDiskCacheSlot::Used;
+    ++m_usedSlots;
+    return slot;
+}
+
+void NetworkDiskCache::removeSlot(NetworkDiskCacheSlot *slot)
+{
+    m_liveSize -= slot->size;
+    slot->flags = NetworkDiskCacheSlot::Removed;
+    --m_usedSlots;
+    ++m_removedSlots;
+}
+
+bool NetworkDiskCache::readRecord(const QUrl &url, Record *record)
+{
+    quint64 urlHash = hash(url);
+    NetworkDiskCacheSlot *slot = findSlot(urlHash);
+    if (!slot)
+        return false;
+
+    QFile *file = shardFile(slot->shard);
+    QByteArray header;
+    if (file && slot->offset + slot->size <= m_shardSizes.at(slot->shard) && file->seek(slot->offset))
+        header = file->read(RECORD_HEADER_SIZE);
+    const quint32 *values = reinterpret_cast<const quint32*>(header.constData());
+    quint64 recordHash = 0;
+    if (header.size() == RECORD_HEADER_SIZE)
+        qMemCopy(&recordHash, values + 4, sizeof(recordHash));
+    if (header.size() != RECORD_HEADER_SIZE
+        || values[0] != RECORD_MAGIC
+        || recordHash != urlHash
+        || RECORD_HEADER_SIZE + qint64(values[1]) + values[2] + values[3] != slot->size) {
+        qWarning() << "NetworkDiskCache: dropping broken entry for" << url;
+        removeSlot(slot);
+        return false;
+    }
+
+    record->url = file->read(values[1]);
+    if (record->url != url.toEncoded())
+        return false;
+    QByteArray metaData = file->read(values[2]);
+    QDataStream stream(metaData);
+    stream.setVersion(QDataStream::Qt_4_5);
+    stream >> record->metaData;
+
+    record->slot = slot;
+    record->dataOffset = slot->offset + RECORD_HEADER_SIZE + values[1] + values[2];
+    record->dataSize = values[3];
+    slot->lastAccess = ++m_accessClock;
+    return true;
+}
+
+bool NetworkDiskCache::writeRecord(const QNetworkCacheMetaData &metaData, const QByteArray &data)
+{
+    if (m_readOnly)
+        return false;
+    QByteArray url = metaData.url().toEncoded();
+    quint64 urlHash = hash(metaData.url());
+    QByteArray metaDataBytes;
+    QDataStream stream(&metaDataBytes, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_4_5);
+    stream << metaData;
+
+    int shard = urlHash % SHARD_COUNT;
+    QFile *file = shardFile(shard);
+    qint64 size = RECORD_HEADER_SIZE + url.size() + metaDataBytes.size() + data.size();
+    quint32 offset = m_shardSizes.at(shard);
+    if (!file || offset + size > Q_INT64_C(0xffffffff))
+        return false;
+
+    // The record goes to disk before the index points to it
+    QByteArray header = recordHeader(url.size(), metaDataBytes.size(), data.size(), urlHash);
+    if (!file->seek(offset)
+        || file->write(header) != header.size()
+        || file->write(url) != url.size()
+        || file->write(metaDataBytes) != metaDataBytes.size()
+        || file->write(data) != data.size()) {
+        qWarning() << "NetworkDiskCache: unable to write to" << file->fileName();
+        file->resize(offset);
+        return false;
+    }
+    m_shardSizes[shard] = offset + size;
+
+    NetworkDiskCacheSlot *slot = insertSlot(urlHash);
+    if (!slot)
+        return false;
+    m_liveSize += size - slot->size;
+    slot->shard = shard;
+    slot->offset = offset;
+    slot->size = size;
+    slot->lastAccess = ++m_accessClock;
+
+    if (m_liveSize > m_maximumCacheSize || cacheSize() > m_maximumCacheSize + m_maximumCacheSize / 4)
+        startCompaction();
+    return true;
+}
+
+QNetworkCacheMetaData NetworkDiskCache::metaData(const QUrl &url)
+{
+    Record record;
+    if (!readRecord(url, &record))
+        return QNetworkCacheMetaData();
+    return record.metaData;
+}
+
+void NetworkDiskCache::updateMetaData(const QNetworkCacheMetaData &metaData)
+{
+    QUrl url = metaData.url();
+    QIODevice *device = data(url);
+    if (!device)
+        return;
+    QByteArray bytes = device->readAll();
+    delete device;
+    writeRecord(metaData, bytes);
+}
+
+QIODevice *NetworkDiskCache::data(const QUrl &url)
+{
+    Record record;
+    if (!readRecord(url, &record))
+        return 0;
+
+    QFile *file = shardFile(record.slot->shard);
+    QByteArray data;
+    if (file->seek(record.dataOffset))
+        data = file->read(record.dataSize);
+    if (data.size() != int(record.dataSize))
+        return 0;
+
+    QBuffer *buffer = new QBuffer;
+    buffer->setData(data);
+    buffer->open(QBuffer::ReadOnly);
+    return buffer;
+}
+
+bool NetworkDiskCache::remove(const QUrl &url)
+{
+    // Also called to throw away a response that is being inserted
+    QHash<QIODevice*, QNetworkCacheMetaData>::iterator it = m_inserting.begin();
+    while (it != m_inserting.end()) {
+        if (it.value().url() == url) {
+            delete it.key();
+            it = m_inserting.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    NetworkDiskCacheSlot *slot = findSlot(hash(url));
+    if (!slot || m_readOnly)
+        return false;
+    removeSlot(slot);
+    return true;
+}
+
+qint64 NetworkDiskCache::cacheSize() const
+{
+    qint64 size = 0;
+    foreach (quint32 shardSize, m_shardSizes)
+        size += shardSize;
+    return size;
+}
+
+/*
+    What prepare() hands out for the response to be written to.  It keeps
+    the data until more than the maximum has been written, after that it
+    only counts the bytes so that a response without a Content-Length
+    can't fill up the memory before insert() gets to see its size.
+  */
+class NetworkDiskCacheBuffer : public QIODevice
+{
+public:
+    NetworkDiskCacheBuffer(qint64 maximumSize)
+        : m_maximumSize(maximumSize)
+        , m_size(0)
+    {
+        open(QIODevice::WriteOnly);
+    }
+
+    bool isSequential() const { return true; }
+    qint64 size() const { return m_size; }
+    bool isOversize() const { return m_size > m_maximumSize; }
+    QByteArray data() const { return m_data; }
+
+protected:
+    qint64 readData(char *data, qint64 maximumSize)
+    {
+        Q_UNUSED(data);
+        Q_UNUSED(maximumSize);
+        return -1;
+    }
+
+    qint64 writeData(const char *data, qint64 length)
+    {
+        m_size += length;
+        if (m_size > m_maximumSize)
+            m_data = QByteArray();
+        else
+            m_data.append(data, length);
+        return length;
+    }
+
+private:
+    qint64 m_maximumSize;
+    qint64 m_size;
+    QByteArray m_data;
+};
+
+QIODevice *NetworkDiskCache::prepare(const QNetworkCacheMetaData &metaData)
+{
+    if (!metaData.isValid() || !metaData.url().isValid() || !metaData.saveToDisk()
+        || !m_slots || m_readOnly)
+        return 0;
+
+    // Leave out what would push most of the cache out
+    qint64 maximumSize = m_maximumCacheSize / 8;
+    foreach (const QNetworkCacheMetaData::RawHeader &header, metaData.rawHeaders()) {
+        if (header.first.toLower() == "content-length" && header.second.toLongLong() > maximumSize)
+            return 0;
+    }
+
+    NetworkDiskCacheBuffer *buffer = new NetworkDiskCacheBuffer(maximumSize);
+    m_inserting.insert(buffer, metaData);
+    return buffer;
+}
+
+void NetworkDiskCache::insert(QIODevice *device)
+{
+    QHash<QIODevice*, QNetworkCacheMetaData>::iterator it = m_inserting.find(device);
+    if (it == m_inserting.end())
+        return;
+    QNetworkCacheMetaData metaData = it.value();
+    m_inserting.erase(it);
+
+    // Only devices from prepare() get this far
+    NetworkDiskCacheBuffer *buffer = static_cast<NetworkDiskCacheBuffer*>(device);
+    if (!buffer->isOversize())
+        writeRecord(metaData, buffer->data());
+    delete device;
+}
+
+void NetworkDiskCache::clear()
+{
+    cancelCompaction();
+    if (m_directory.isEmpty() || m_readOnly)
+        return;
+    close();
+    for (int i = 0; i < SHARD_COUNT; ++i)
+        QFile::remove(shardFileName(i));
+    QFile::remove(m_directory + QLatin1String("/index"));
+    open();
+}
+
+void NetworkDiskCache::startCompaction()
+{
+    if (m_compactor || !m_slots || m_readOnly)
+        return;
+
+    QVector<NetworkDiskCacheCompactor::Shard> shards(SHARD_COUNT);
+    for (int i = 0; i < SHARD_COUNT; ++i) {
+        if (m_shards.at(i))
+            m_shards.at(i)->flush();
+        shards[i].fileName = shardFileName(i);
+        shards[i].size = m_shardSizes.at(i);
+    }
+    QVector<NetworkDiskCacheSlot> slots(m_slotCount);
+    qMemCopy(slots.data(), m_slots, m_slotCount * sizeof(NetworkDiskCacheSlot));
+
+    // Make some room so the next few responses don't start another one
+    m_compactor = new NetworkDiskCacheCompactor(slots, shards, m_maximumCacheSize - m_maximumCacheSize / 10, this);
+    connect(m_compactor, SIGNAL(finished()),
+            this, SLOT(compactionFinished()));
+    m_compactor->start(QThread::LowPriority);
+}
+
+void NetworkDiskCache::cancelCompaction()
+{
+    if (!m_compactor)
+        return;
+    m_compactor->wait();
+    foreach (const NetworkDiskCacheCompactor::Shard &shard, m_compactor->shards()) {
+        if (shard.compacted)
+            QFile::remove(NetworkDiskCacheCompactor::newFileName(shard.fileName));
+    }
+    m_compactor->deleteLater();
+    m_compactor = 0;
+}
+
+void NetworkDiskCache::compactionFinished()
+{
+    // Ignore a compactor that was waited for or cancelled already
+    if (!m_compactor || (sender() && sender() != m_compactor))
+        return;
+    m_compactor->wait();
+    QVector<NetworkDiskCacheCompactor::Shard> shards = m_compactor->shards();
+    m_compactor->deleteLater();
+    m_compactor = 0;
+
+    for (int i = 0; i < shards.count(); ++i) {
+        const NetworkDiskCacheCompactor::Shard &shard = shards.at(i);
+        if (!shard.compacted)
+            continue;
+        QString newFileName = NetworkDiskCacheCompactor::newFileName(shard.fileName);
+
+        // Copy over what was added while the compactor was running
+        QFile newFile(newFileName);
+        QFile *file = shardFile(i);
+        bool ok = file && file->flush() && newFile.open(QFile::ReadWrite)
+                  && newFile.seek(shard.newSize) && file->seek(shard.size);
+        while (ok && !file->atEnd()) {
+            QByteArray buffer = file->read(COPY_BUFFER_SIZE);
+            ok = !buffer.isEmpty() && newFile.write(buffer) == buffer.size();
+        }
+        if (!ok) {
+            qWarning() << "NetworkDiskCache: unable to compact" << shard.fileName;
+            newFile.close();
+            QFile::remove(newFileName);
+            continue;
+        }
+        quint32 newSize = newFile.size();
+        newFile.close();
+
+        for (quint32 j = 0; j < m_slotCount; ++j) {
+            NetworkDiskCacheSlot &slot = m_slots[j];
+            if (!(slot.flags & NetworkDiskCacheSlot::Used) || int(slot.shard) != i)
+                continue;
+            if (slot.offset >= shard.size)
+                slot.offset = shard.newSize + (slot.offset - shard.size);
+            else if (shard.moved.contains(slot.offset))
+                slot.offset = shard.moved.value(slot.offset);
+            else
+                removeSlot(&slot);
+        }
+
+        delete m_shards.at(i);
+        m_shards[i] = 0;
+        QFile::remove(shard.fileName);
+        QFile::rename(newFileName, shard.fileName);
+        m_shardSizes[i] = newSize;
+    }
+    recount();
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef NETWORKDISKCACHE_H
+#define NETWORKDISKCACHE_H
+
+#include <qabstractnetworkcache.h>
+
+#include <qfile.h>
+#include <qhash.h>
+#include <qthread.h>
+#include <qvector.h>
+
+/*
+    One slot of the index, written to disk as is.
+  */
+struct NetworkDiskCacheSlot
+{
+    enum Flags {
+        Used = 1,
+        Removed = 2
+    };
+
+    quint64 hash;
+    quint32 shard;
+    quint32 offset;
+    quint32 size;
+    // The access clock of the cache when the entry was last used
+    quint32 lastAccess;
+    quint32 flags;
+    quint32 reserved;
+};
+Q_DECLARE_TYPEINFO(NetworkDiskCacheSlot, Q_PRIMITIVE_TYPE);
+
+/*
+    Moves the live records of the shards into new files on a worker thread,
+    dropping the least recently used ones until the cache fits.  It works on
+    a copy of the index, NetworkDiskCache applies the result once it is done.
+  */
+class NetworkDiskCacheCompactor : public QThread
+{
+public:
+    struct Shard {
+        Shard() : size(0), compacted(false), newSize(0) {}
+        QString fileName;
+        quint32 size;
+        bool compacted;
+        quint32 newSize;
+        // Offset of every record that was kept, old to new
+        QHash<quint32, quint32> moved;
+    };
+
+    NetworkDiskCacheCompactor(const QVector<NetworkDiskCacheSlot> &slots, const QVector<Shard> &shards,
+                              qint64 maximumSize, QObject *parent = 0);
+
+    QVector<Shard> shards() const;
+    static QString newFileName(const QString &fileName);
+
+protected:
+    void run();
+
+private:
+    bool compact(Shard &shard, QList<NetworkDiskCacheSlot> records);
+
+    QVector<NetworkDiskCacheSlot> m_slots;
+    QVector<Shard> m_shards;
+    qint64 m_maximumSize;
+};
+
+/*
+    A disk cache that keeps its entries in a few large shard files instead
+    of a file per entry.
+
+    The index file is a hash table from the hash of a url to the shard,
+    offset, size and last access of its record, where the last access is a
+    counter that goes up every time an entry is used.  It is memory-mapped,
+    so looking up an entry is a probe into the table followed by a single
+    read of the shard, no directories are ever listed.
+
+    Shards are only ever appended to, replacing or removing an entry leaves
+    its old record behind as garbage.  When the cache grows past
+    maximumCacheSize() a NetworkDiskCacheCompactor drops the least recently
+    used entries and rewrites the shards without the garbage on a worker
+    thread.  Records added in the mean time are copied over when the new
+    shard is swapped in.
+
+    Every record repeats the hash and url of its entry so that an index that
+    got out of step with the shards after a crash only results in misses.
+
+    A read only cache keeps a copy of the index in memory and never creates,
+    removes or writes any file, so it can look at the cache of a browser
+    that is running.  It has to be set before the cache directory.
+  */
+class NetworkDiskCache : public QAbstractNetworkCache
+{
+    Q_OBJECT
+
+public:
+    NetworkDiskCache(QObject *parent = 0);
+    ~NetworkDiskCache();
+
+    QString cacheDirectory() const;
+    void setCacheDirectory(const QString &directory);
+
+    bool isReadOnly() const;
+    void setReadOnly(bool readOnly);
+
+    qint64 maximumCacheSize() const;
+    void setMaximumCacheSize(qint64 size);
+
+    int entryCount() const;
+    QList<QUrl> urls();
+    bool isCompacting() const;
+    void waitForCompaction();
+
+    QNetworkCacheMetaData metaData(const QUrl &url);
+    void updateMetaData(const QNetworkCacheMetaData &metaData);
+    QIODevice *data(const QUrl &url);
+    bool remove(const QUrl &url);
+    qint64 cacheSize() const;
+
+    QIODevice *prepare(const QNetworkCacheMetaData &metaData);
+    void insert(QIODevice *device);
+
+    static quint64 hash(const QUrl &url);
+
+public slots:
+    void clear();
+
+private slots:
+    void compactionFinished();
+
+private:
+    struct Record {
+        Record() : slot(0) {}
+        NetworkDiskCacheSlot *slot;
+        QByteArray url;
+        QNetworkCacheMetaData metaData;
+        quint32 dataOffset;
+        quint32 dataSize;
+    };
+
+    bool open();
+    void close();
+    bool mapIndex(quint32 slotCount);
+    void unmapIndex();
+    bool resizeIndex(quint32 slotCount);
+    void recount();
+
+    NetworkDiskCacheSlot *findSlot(quint64 hash) const;
+    NetworkDiskCacheSlot *insertSlot(quint64 hash);
+    void removeSlot(NetworkDiskCacheSlot *slot);
+    bool readRecord(const QUrl &url, Record *record);
+    bool writeRecord(const QNetworkCacheMetaData &metaData, const QByteArray &data);
+    QString shardFileName(int shard) const;
+    QFile *shardFile(int shard);
+    void startCompaction();
+    void cancelCompaction();
+
+    QString m_directory;
+    qint64 m_maximumCacheSize;
+    bool m_readOnly;
+
+    QFile m_indexFile;
+    uchar *m_indexMap;
+    QByteArray m_indexBuffer;
+    NetworkDiskCacheSlot *m_slots;
+    quint32 m_slotCount;
+    quint32 m_usedSlots;
+    quint32 m_removedSlots;
+    quint32 m_accessClock;
+
+    QVector<QFile*> m_shards;
+    QVector<quint32> m_shardSizes;
+    qint64 m_liveSize;
+
+    QHash<QIODevice*, QNetworkCacheMetaData> m_inserting;
+    NetworkDiskCacheCompactor *m_compactor;
+};
+
+#endif // NETWORKDISKCACHE_H
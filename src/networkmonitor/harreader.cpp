@@ -0,0 +1,508 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "harreader.h"
+
+#include "networkmonitor.h"
+
+#include <qfile.h>
+#include <qurl.h>
+
+HarReader::HarReader()
+    : m_device(0)
+    , m_position(0)
+    , m_offset(0)
+    , m_atEnd(false)
+    , m_model(0)
+    , m_entries(0)
+    , m_importTime(0)
+{
+}
+
+bool HarReader::read(const QString &fileName, RequestModel *model)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::ReadOnly)) {
+        m_errorString = file.errorString();
+        return false;
+    }
+    return read(&file, model);
+}
+
+bool HarReader::read(QIODevice *device, RequestModel *model)
+{
+    m_device = device;
+    m_buffer.clear();
+    m_position = 0;
+    m_offset = 0;
+    m_atEnd = false;
+    m_errorString.clear();
+    m_model = model;
+    m_entries = 0;
+    m_firstStarted = QDateTime();
+    m_importTime = RequestModel::currentTime();
+
+    // Skip a byte order mark
+    if (peek() == '\xef') {
+        next();
+        next();
+        next();
+    }
+
+    // Only the entries are kept, everything else is skipped
+    if (!expect('{'))
+        return false;
+    skipWhiteSpace();
+    if (peek() == '}') {
+        next();
+        return true;
+    }
+    forever {
+        QString key = readString();
+        if (!expect(':'))
+            return false;
+        if (key == QLatin1String("log")) {
+            if (!readLog())
+                return false;
+        } else {
+            readValue();
+        }
+        if (!m_errorString.isEmpty())
+            return false;
+        skipWhiteSpace();
+        char c = next();
+        if (c == '}')
+            break;
+        if (c != ',') {
+            setError(QLatin1String("expected , or }"));
+            return false;
+        }
+    }
+    return m_errorString.isEmpty();
+}
+
+int HarReader::entries() const
+{
+    return m_entries;
+}
+
+QString HarReader::errorString() const
+{
+    return m_errorString;
+}
+
+bool HarReader::readLog()
+{
+    if (!expect('{'))
+        return false;
+    skipWhiteSpace();
+    if (peek() == '}') {
+        next();
+        return true;
+    }
+    forever {
+        QString key = readString();
+        if (!expect(':'))
+            return false;
+        if (key == QLatin1String("entries")) {
+            if (!readEntries())
+                return false;
+        } else {
+            readValue();
+        }
+        if (!m_errorString.isEmpty())
+            return false;
+        skipWhiteSpace();
+        char c = next();
+        if (c == '}')
+            return true;
+        if (c != ',') {
+            setError(QLatin1String("expected , or }"));
+            return false;
+        }
+    }
+}
+
+bool HarReader::readEntries()
+{
+    if (!expect('['))
+        return false;
+    skipWhiteSpace();
+    if (peek() == ']') {
+        next();
+        return true;
+    }
+    forever {
+        QVariant entry = readValue();
+        if (!m_errorString.isEmpty())
+            return false;
+        addEntry(entry.toMap());
+        skipWhiteSpace();
+        char c = next();
+        if (c == ']')
+            return true;
+        if (c != ',') {
+            setError(QLatin1String("expected , or ]"));
+            return false;
+        }
+    }
+}
+
+// HAR uses ISO 8601 with milliseconds and a time zone
+static QDateTime parseDateTime(const QString &string)
+{
+    QDateTime dateTime = QDateTime::fromString(string.left(19), QLatin1String("yyyy-MM-ddThh:mm:ss"));
+    if (!dateTime.isValid())
+        return QDateTime();
+    dateTime.setTimeSpec(Qt::UTC);
+
+    int position = 19;
+    if (position < string.length() && string.at(position) == QLatin1Char('.')) {
+        ++position;
+        int milliseconds = 0;
+        int digits = 0;
+        while (position < string.length() && string.at(position).isDigit()) {
+            if (digits < 3) {
+                milliseconds = milliseconds * 10 + string.at(position).digitValue();
+                ++digits;
+            }
+            ++position;
+        }
+        for (; digits < 3 && digits > 0; ++digits)
+            milliseconds *= 10;
+        dateTime = dateTime.addMSecs(milliseconds);
+    }
+
+    if (position < string.length()
+        && (string.at(position) == QLatin1Char('+') || string.at(position) == QLatin1Char('-'))) {
+        int sign = string.at(position) == QLatin1Char('+') ? 1 : -1;
+        int hours = string.mid(position + 1, 2).toInt();
+        int minutes = string.mid(position + 4, 2).toInt();
+        dateTime = dateTime.addSecs(-sign * (hours * 3600 + minutes * 60));
+    }
+    return dateTime;
+}
+
+static qint64 msecsBetween(const QDateTime &from, const QDateTime &to)
+{
+    return qint64(from.daysTo(to)) * 24 * 3600 * 1000 + from.time().msecsTo(to.time());
+}
+
+static qint64 timing(const QVariantMap &timings, const char *name)
+{
+    return qMax(qint64(0), timings.value(QLatin1String(name)).toLongLong());
+}
+
+static void readHeaders(const QVariant &list, RequestHeaders &headers)
+{
+    foreach (const QVariant &header, list.toList()) {
+        QVariantMap map = header.toMap();
+        headers.append(map.value(QLatin1String("name")).toString().toLatin1(),
+                       map.value(QLatin1String("value")).toString().toLatin1());
+    }
+}
+
+void HarReader::addEntry(const QVariantMap &entry)
+{
+    QVariantMap request = entry.value(QLatin1String("request")).toMap();
+    QVariantMap response = entry.value(QLatin1String("response")).toMap();
+    QVariantMap timings = entry.value(QLatin1String("timings")).toMap();
+    QVariantMap content = response.value(QLatin1String("content")).toMap();
+
+    Request result;
+    QString method = request.value(QLatin1String("method")).toString().toUpper();
+    if (method == QLatin1String("HEAD"))
+        result.op = QNetworkAccessManager::HeadOperation;
+    else if (method == QLatin1String("GET"))
+        result.op = QNetworkAccessManager::GetOperation;
+    else if (method == QLatin1String("PUT"))
+        result.op = QNetworkAccessManager::PutOperation;
+    else if (method == QLatin1String("POST"))
+        result.op = QNetworkAccessManager::PostOperation;
+    else
+        result.op = QNetworkAccessManager::UnknownOperation;
+    result.url = QUrl(request.value(QLatin1String("url")).toString()).toEncoded();
+    readHeaders(request.value(QLatin1String("headers")), result.requestHeaders);
+    readHeaders(response.value(QLatin1String("headers")), result.replyHeaders);
+
+    result.status = response.value(QLatin1String("status")).toInt();
+    result.reason = response.value(QLatin1String("statusText")).toString();
+    result.contentType = content.value(QLatin1String("mimeType")).toString();
+    qint64 bodySize = response.value(QLatin1String("bodySize"), -1).toLongLong();
+    result.bytesReceived = bodySize >= 0 ? bodySize : qMax(qint64(0), content.value(QLatin1String("size")).toLongLong());
+    QByteArray contentLength = result.replyHeaders.value("Content-Length");
+    result.length = contentLength.isEmpty() ? result.bytesReceived : contentLength.toLongLong();
+    result.fromCache = entry.value(QLatin1String("_fromCache")).toBool();
+    result.blocked = entry.value(QLatin1String("_blocked")).toBool();
+    result.info = entry.value(QLatin1String("_info")).toString();
+
+    QDateTime started = parseDateTime(entry.value(QLatin1String("startedDateTime")).toString());
+    if (!m_firstStarted.isValid())
+        m_firstStarted = started;
+    qint64 offset = started.isValid() ? msecsBetween(m_firstStarted, started) : 0;
+    result.created = qMax(qint64(0), m_importTime + offset);
+
+    qint64 beforeResponse = timing(timings, "blocked") + timing(timings, "dns")
+                            + timing(timings, "connect") + timing(timings, "send")
+                            + timing(timings, "wait");
+    qint64 time = qMax(qint64(0), entry.value(QLatin1String("time")).toLongLong());
+    result.metaDataChanged = result.created + qMin(beforeResponse, time);
+    result.firstByte = result.metaDataChanged;
+    result.finished = result.created + time;
+
+    m_model->addRequest(result);
+    ++m_entries;
+}
+
+bool HarReader::fill()
+{
+    if (m_atEnd)
+        return false;
+    if (m_position > 0) {
+        m_offset += m_position;
+        m_buffer.remove(0, m_position);
+        m_position = 0;
+    }
+    QByteArray data = m_device->read(64 * 1024);
+    if (data.isEmpty()) {
+        m_atEnd = true;
+        return false;
+    }
+    m_buffer.append(data);
+    return true;
+}
+
+char HarReader::peek()
+{
+    if (m_position >= m_buffer.size() && !fill())
+        return 0;
+    return m_buffer.at(m_position);
+}
+
+char HarReader::next()
+{
+    char c = peek();
+    if (c)
+        ++m_position;
+    return c;
+}
+
+void HarReader::skipWhiteSpace()
+{
+    forever {
+        char c = peek();
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+            return;
+        ++m_position;
+    }
+}
+
+bool HarReader::expect(char c)
+{
+    skipWhiteSpace();
+    if (next() != c) {
+        setError(QString(QLatin1String("expected %1")).arg(QLatin1Char(c)));
+        return false;
+    }
+    return true;
+}
+
+void HarReader::setError(const QString &message)
+{
+    if (m_errorString.isEmpty())
+        m_errorString = QString(QLatin1String("%1 at offset %2")).arg(message).arg(m_offset + m_position);
+}
+
+QVariant HarReader::readValue()
+{
+    skipWhiteSpace();
+    switch (peek()) {
+    case '{':
+        return readObject();
+    case '[':
+        return readArray();
+    case '"':
+        return readString();
+    case 't':
+    case 'f':
+    case 'n':
+        return readLiteral();
+    case 0:
+        setError(QLatin1String("unexpected end of file"));
+        return QVariant();
+    default:
+        return readNumber();
+    }
+}
+
+QVariantMap HarReader::readObject()
+{
+    QVariantMap object;
+    if (!expect('{'))
+        return object;
+    skipWhiteSpace();
+    if (peek() == '}') {
+        next();
+        return object;
+    }
+    while (m_errorString.isEmpty()) {
+        QString key = readString();
+        if (!expect(':'))
+            break;
+        object.insert(key, readValue());
+        skipWhiteSpace();
+        char c = next();
+        if (c == '}')
+            break;
+        if (c != ',')
+            setError(QLatin1String("expected , or }"));
+    }
+    return object;
+}
+
+QVariantList HarReader::readArray()
+{
+    QVariantList array;
+    if (!expect('['))
+        return array;
+    skipWhiteSpace();
+    if (peek() == ']') {
+        next();
+        return array;
+    }
+    while (m_errorString.isEmpty()) {
+        array.append(readValue());
+        skipWhiteSpace();
+        char c = next();
+        if (c == ']')
+            break;
+        if (c != ',')
+            setError(QLatin1String("expected , or ]"));
+    }
+    return array;
+}
+
+QString HarReader::readString()
+{
+    if (!expect('"'))
+        return QString();
+
+    // U+FFFD in UTF-8, stands in for a surrogate that is not paired
+    static const char replacement[] = "\xef\xbf\xbd";
+
+    // The string is collected as UTF-8 and converted at the end, a high
+    // surrogate waits for the low surrogate escape that has to follow it
+    QByteArray utf8;
+    ushort highSurrogate = 0;
+    forever {
+        char c = next();
+        if (c == '\\' && peek() == 'u') {
+            next();
+            QByteArray hex;
+            for (int i = 0; i < 4; ++i)
+                hex += next();
+            bool ok;
+            ushort code = hex.toUShort(&ok, 16);
+            if (!ok) {
+                setError(QLatin1String("invalid escape"));
+                return QString();
+            }
+            if (highSurrogate && QChar(code).isLowSurrogate()) {
+                QChar pair[2] = { QChar(highSurrogate), QChar(code) };
+                utf8 += QString(pair, 2).toUtf8();
+                highSurrogate = 0;
+                continue;
+            }
+            if (highSurrogate)
+                utf8 += replacement;
+            highSurrogate = 0;
+            if (QChar(code).isHighSurrogate())
+                highSurrogate = code;
+            else if (QChar(code).isLowSurrogate())
+                utf8 += replacement;
+            else
+                utf8 += QString(QChar(code)).toUtf8();
+            continue;
+        }
+        if (highSurrogate) {
+            utf8 += replacement;
+            highSurrogate = 0;
+        }
+
+        if (c == '"')
+            break;
+        if (c == 0) {
+            setError(QLatin1String("unterminated string"));
+            return QString();
+        }
+        if (c != '\\') {
+            utf8 += c;
+            continue;
+        }
+        c = next();
+        switch (c) {
+        case 'b': utf8 += '\b'; break;
+        case 'f': utf8 += '\f'; break;
+        case 'n': utf8 += '\n'; break;
+        case 'r': utf8 += '\r'; break;
+        case 't': utf8 += '\t'; break;
+        case 0:
+            setError(QLatin1String("unterminated string"));
+            return QString();
+        default:
+            utf8 += c;
+        }
+    }
+    return QString::fromUtf8(utf8.constData(), utf8.size());
+}
+
+QVariant HarReader::readNumber()
+{
+    QByteArray number;
+    forever {
+        char c = peek();
+        if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'))
+            break;
+        number += next();
+    }
+    bool ok;
+    qlonglong integer = number.toLongLong(&ok);
+    if (ok)
+        return integer;
+    double real = number.toDouble(&ok);
+    if (ok)
+        return real;
+    setError(QLatin1String("invalid value"));
+    return QVariant();
+}
+
+QVariant HarReader::readLiteral()
+{
+    QByteArray word;
+    while (peek() >= 'a' && peek() <= 'z')
+        word += next();
+    if (word == "true")
+        return true;
+    if (word == "false")
+        return false;
+    if (word == "null")
+        return QVariant();
+    setError(QLatin1String("invalid value"));
+    return QVariant();
+}
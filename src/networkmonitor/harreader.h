@@ -0,0 +1,81 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef HARREADER_H
+#define HARREADER_H
+
+#include <qbytearray.h>
+#include <qdatetime.h>
+#include <qstring.h>
+#include <qvariant.h>
+
+class QIODevice;
+class RequestModel;
+
+/*
+    Reads an HTTP Archive into a RequestModel.
+
+    The file is parsed as it is read, each entry is added to the model
+    as soon as it is complete.  The times of the entries are moved to
+    start now, keeping the distances between them.
+  */
+class HarReader
+{
+public:
+    HarReader();
+
+    bool read(const QString &fileName, RequestModel *model);
+    bool read(QIODevice *device, RequestModel *model);
+
+    int entries() const;
+    QString errorString() const;
+
+private:
+    bool readLog();
+    bool readEntries();
+    void addEntry(const QVariantMap &entry);
+
+    // A small JSON parser
+    bool fill();
+    char peek();
+    char next();
+    void skipWhiteSpace();
+    bool expect(char c);
+    QVariant readValue();
+    QVariantMap readObject();
+    QVariantList readArray();
+    QString readString();
+    QVariant readNumber();
+    QVariant readLiteral();
+    void setError(const QString &message);
+
+    QIODevice *m_device;
+    QByteArray m_buffer;
+    int m_position;
+    qint64 m_offset;
+    bool m_atEnd;
+    QString m_errorString;
+
+    RequestModel *m_model;
+    int m_entries;
+    QDateTime m_firstStarted;
+    qint64 m_importTime;
+};
+
+#endif // HARREADER_H
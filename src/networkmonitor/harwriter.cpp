@@ -0,0 +1,177 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "harwriter.h"
+
+#include "networkmonitor.h"
+
+#include <qcoreapplication.h>
+#include <qfile.h>
+#include <qurl.h>
+
+static QByteArray jsonString(const QString &string)
+{
+    QByteArray utf8 = string.toUtf8();
+    QByteArray result;
+    result.reserve(utf8.size() + 2);
+    result += '"';
+    for (int i = 0; i < utf8.size(); ++i) {
+        unsigned char c = utf8.at(i);
+        switch (c) {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\b': result += "\\b"; break;
+        case '\f': result += "\\f"; break;
+        case '\n': result += "\\n"; break;
+        case '\r': result += "\\r"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char escaped[7];
+                qsnprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                result += escaped;
+            } else {
+                result += c;
+            }
+        }
+    }
+    result += '"';
+    return result;
+}
+
+static QByteArray jsonString(const QByteArray &latin1)
+{
+    return jsonString(QString::fromLatin1(latin1));
+}
+
+static QByteArray jsonNumber(qint64 number)
+{
+    return QByteArray::number(number);
+}
+
+static QByteArray jsonHeaders(const RequestHeaders &headers)
+{
+    RequestHeaders::HeaderList list = headers.toList();
+    QByteArray result = "[";
+    for (int i = 0; i < list.count(); ++i) {
+        if (i)
+            result += ',';
+        result += "{\"name\":" + jsonString(list.at(i).first)
+                  + ",\"value\":" + jsonString(list.at(i).second) + '}';
+    }
+    result += ']';
+    return result;
+}
+
+HarWriter::HarWriter()
+    : m_device(0)
+{
+}
+
+bool HarWriter::write(const QString &fileName, const RequestModel *model)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate))
+        return false;
+    return write(&file, model);
+}
+
+bool HarWriter::write(QIODevice *device, const RequestModel *model)
+{
+    m_device = device;
+    QByteArray header = "{\"log\":{\"version\":\"1.2\",\"creator\":{\"name\":"
+                        + jsonString(QCoreApplication::applicationName())
+                        + ",\"version\":" + jsonString(QCoreApplication::applicationVersion())
+                        + "},\"entries\":[\n";
+    if (!writeChunk(header))
+        return false;
+
+    int rows = model->rowCount();
+    for (int i = 0; i < rows; ++i) {
+        QByteArray data = entry(model->requestAt(i));
+        if (i != rows - 1)
+            data += ',';
+        data += '\n';
+        if (!writeChunk(data))
+            return false;
+    }
+    return writeChunk("]}}\n");
+}
+
+bool HarWriter::writeChunk(const QByteArray &data)
+{
+    return m_device->write(data) == data.size();
+}
+
+QByteArray HarWriter::entry(const Request &request) const
+{
+    QUrl url = QUrl::fromEncoded(request.url);
+
+    // Requests that never finished are written as far as they got
+    qint64 finished = request.finished != -1 ? request.finished : request.created;
+    qint64 metaDataChanged = request.metaDataChanged != -1 ? request.metaDataChanged : finished;
+    qint64 wait = qMax(qint64(0), metaDataChanged - request.created);
+    qint64 receive = qMax(qint64(0), finished - metaDataChanged);
+
+    QByteArray queryString = "[";
+    QList<QPair<QString, QString> > items = url.queryItems();
+    for (int i = 0; i < items.count(); ++i) {
+        if (i)
+            queryString += ',';
+        queryString += "{\"name\":" + jsonString(items.at(i).first)
+                       + ",\"value\":" + jsonString(items.at(i).second) + '}';
+    }
+    queryString += ']';
+
+    QString mimeType = request.contentType;
+    if (mimeType.isEmpty())
+        mimeType = QString::fromLatin1(request.replyHeaders.value("Content-Type"));
+    QString redirect = QString::fromLatin1(request.replyHeaders.value("Location"));
+
+    QByteArray data;
+    data += "{\"startedDateTime\":"
+            + jsonString(RequestModel::dateTime(request.created).toString(QLatin1String("yyyy-MM-ddThh:mm:ss.zzzZ")));
+    data += ",\"time\":" + jsonNumber(wait + receive);
+    data += ",\"request\":{\"method\":" + jsonString(RequestModel::operationName(request.op));
+    data += ",\"url\":" + jsonString(request.url);
+    data += ",\"httpVersion\":\"HTTP/1.1\",\"cookies\":[],\"headers\":" + jsonHeaders(request.requestHeaders);
+    data += ",\"queryString\":" + queryString;
+    data += ",\"headersSize\":-1,\"bodySize\":-1}";
+    data += ",\"response\":{\"status\":" + jsonNumber(request.status);
+    data += ",\"statusText\":" + jsonString(request.reason);
+    data += ",\"httpVersion\":\"HTTP/1.1\",\"cookies\":[],\"headers\":" + jsonHeaders(request.replyHeaders);
+    data += ",\"content\":{\"size\":" + jsonNumber(request.bytesReceived);
+    data += ",\"mimeType\":" + jsonString(mimeType) + '}';
+    data += ",\"redirectURL\":" + jsonString(redirect);
+    data += ",\"headersSize\":-1,\"bodySize\":" + jsonNumber(request.bytesReceived) + '}';
+    data += ",\"cache\":{}";
+    data += ",\"timings\":{\"blocked\":-1,\"dns\":-1,\"connect\":-1,\"send\":0";
+    data += ",\"wait\":" + jsonNumber(wait);
+    data += ",\"receive\":" + jsonNumber(receive);
+    data += ",\"ssl\":-1}";
+    // Custom fields start with an underscore
+    data += ",\"_fromCache\":";
+    data += request.fromCache ? "true" : "false";
+    data += ",\"_blocked\":";
+    data += request.blocked ? "true" : "false";
+    if (!request.info.isEmpty())
+        data += ",\"_info\":" + jsonString(request.info);
+    data += '}';
+    return data;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef HARWRITER_H
+#define HARWRITER_H
+
+#include <qbytearray.h>
+#include <qstring.h>
+
+class QIODevice;
+class Request;
+class RequestModel;
+
+/*
+    Writes the requests of a RequestModel as an HTTP Archive, the HAR 1.2
+    format that most browsers and page load tools read.
+
+    Every entry is written as soon as it has been formatted, so exporting
+    a long log never needs more memory than a single request takes.
+  */
+class HarWriter
+{
+public:
+    HarWriter();
+
+    bool write(const QString &fileName, const RequestModel *model);
+    bool write(QIODevice *device, const RequestModel *model);
+
+private:
+    bool writeChunk(const QByteArray &data);
+    QByteArray entry(const Request &request) const;
+
+    QIODevice *m_device;
+};
+
+#endif // HARWRITER_H
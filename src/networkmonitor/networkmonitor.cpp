@@ -19,14 +19,29 @@
 
 #include "networkmonitor.h"
 
+#include "adblockblockednetworkreply.h"
+#include "adblockmanager.h"
 #include "browserapplication.h"
+#include "harreader.h"
+#include "harwriter.h"
 #include "networkaccessmanager.h"
 
+#include <qfiledialog.h>
 #include <qheaderview.h>
+#include <qmap.h>
+#include <qmessagebox.h>
 #include <qnetworkreply.h>
 #include <qnetworkrequest.h>
-#include <qsortfilterproxymodel.h>
+#include <qpainter.h>
+#include <qsettings.h>
 #include <qstandarditemmodel.h>
+#include <qtimer.h>
+
+#if QT_VERSION >= 0x040700
+#include <qelapsedtimer.h>
+#else
+#include <qdatetime.h>
+#endif
 
 NetworkMonitor *NetworkMonitor::m_self = 0;
 
@@ -51,20 +66,47 @@ NetworkMonitor::NetworkMonitor(QWidget *parent, Qt::WindowFlags flags)
     responseDetailsView->setModel(m_replyHeaders);
     requestDetailsView->horizontalHeader()->setStretchLastSection(true);
     responseDetailsView->horizontalHeader()->setStretchLastSection(true);
+    m_hostStatistics = new QStandardItemModel(this);
+    m_hostStatistics->setHorizontalHeaderLabels(QStringList() << tr("Host") << tr("Requests")
+                                                << tr("From Cache") << tr("Received")
+                                                << tr("Average Wait") << tr("Average Time"));
+    hostsView->setModel(m_hostStatistics);
+    hostsView->horizontalHeader()->setStretchLastSection(true);
+    m_hostStatisticsTimer = new QTimer(this);
+    m_hostStatisticsTimer->setSingleShot(true);
+    m_hostStatisticsTimer->setInterval(500);
+    connect(m_hostStatisticsTimer, SIGNAL(timeout()),
+            this, SLOT(updateHostStatistics()));
+
+    // Filtering a long log on every key press would make typing sluggish
+    m_filterTimer = new QTimer(this);
+    m_filterTimer->setSingleShot(true);
+    m_filterTimer->setInterval(150);
+    connect(m_filterTimer, SIGNAL(timeout()),
+            this, SLOT(applyFilter()));
 
     requestList->horizontalHeader()->setStretchLastSection(true);
-    m_proxyModel = new QSortFilterProxyModel(this);
-    m_proxyModel->setFilterKeyColumn(-1);
     requestList->setShowGrid(false);
     requestList->setAlternatingRowColors(true);
     requestList->verticalHeader()->setMinimumSectionSize(-1);
     connect(search, SIGNAL(textChanged(QString)),
-            m_proxyModel, SLOT(setFilterFixedString(QString)));
+            m_filterTimer, SLOT(start()));
     connect(removeButton, SIGNAL(clicked()), requestList, SLOT(removeSelected()));
     connect(removeAllButton, SIGNAL(clicked()), requestList, SLOT(removeAll()));
+    connect(exportButton, SIGNAL(clicked()), this, SLOT(exportHar()));
+    connect(importButton, SIGNAL(clicked()), this, SLOT(importHar()));
     m_model = new RequestModel(this);
-    m_proxyModel->setSourceModel(m_model);
+    m_proxyModel = new RequestFilterModel(m_model, this);
     requestList->setModel(m_proxyModel);
+    requestList->setItemDelegateForColumn(RequestModel::TimelineColumn,
+                                          new RequestTimelineDelegate(m_model, this));
+    connect(m_model, SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &)),
+            this, SLOT(scheduleHostStatistics()));
+    connect(m_model, SIGNAL(rowsRemoved(const QModelIndex &, int, int)),
+            this, SLOT(scheduleHostStatistics()));
+    // The scale of every bar changed
+    connect(m_model, SIGNAL(timelineChanged()),
+            requestList->viewport(), SLOT(update()));
     connect(requestList->selectionModel(),
             SIGNAL(currentChanged(const QModelIndex &, const QModelIndex &)),
             this,
@@ -76,6 +118,12 @@ NetworkMonitor::NetworkMonitor(QWidget *parent, Qt::WindowFlags flags)
     requestList->horizontalHeader()->resizeSection(1, m * 20);
     requestList->horizontalHeader()->resizeSection(3, m * 5);
     requestList->horizontalHeader()->resizeSection(4, m * 15);
+    requestList->horizontalHeader()->resizeSection(6, m * 6);
+
+    NetworkAccessManager *manager = BrowserApplication::networkAccessManager();
+    connect(manager, SIGNAL(requestCreated(QNetworkAccessManager::Operation, const QNetworkRequest &, QNetworkReply *)),
+            this, SLOT(updateStatistics()));
+    updateStatistics();
 }
 
 NetworkMonitor::~NetworkMonitor()
@@ -92,22 +140,23 @@ void NetworkMonitor::currentChanged(const QModelIndex &current, const QModelInde
     if (!current.isValid())
         return;
     int row = m_proxyModel->mapToSource(current).row();
+    const Request &request = m_model->requestAt(row);
 
-    QNetworkRequest req = m_model->m_requests[row].request;
-
-    foreach (const QByteArray &header, req.rawHeaderList()) {
+    RequestHeaders::HeaderList requestHeaders = request.requestHeaders.toList();
+    for (int i = 0; i < requestHeaders.count(); ++i) {
         m_requestHeaders->insertRows(0, 1, QModelIndex());
         m_requestHeaders->setData(m_requestHeaders->index(0, 0),
-                QString::fromLatin1(header));
+                QString::fromLatin1(requestHeaders.at(i).first));
         m_requestHeaders->setData(m_requestHeaders->index(0, 1),
-                QString::fromLatin1(req.rawHeader(header)));
+                QString::fromLatin1(requestHeaders.at(i).second));
         m_requestHeaders->item(0, 0)->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
         m_requestHeaders->item(0, 1)->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
     }
 
-    for (int i = 0; i < m_model->m_requests[row].replyHeaders.count(); ++i) {
-        QByteArray first = m_model->m_requests[row].replyHeaders[i].first;
-        QByteArray second = m_model->m_requests[row].replyHeaders[i].second;
+    RequestHeaders::HeaderList replyHeaders = request.replyHeaders.toList();
+    for (int i = 0; i < replyHeaders.count(); ++i) {
+        QByteArray first = replyHeaders.at(i).first;
+        QByteArray second = replyHeaders.at(i).second;
         m_replyHeaders->insertRows(0, 1, QModelIndex());
         m_replyHeaders->setData(m_replyHeaders->index(0, 0), first);
         m_replyHeaders->setData(m_replyHeaders->index(0, 1), second);
@@ -116,9 +165,209 @@ void NetworkMonitor::currentChanged(const QModelIndex &current, const QModelInde
     }
 }
 
+void NetworkMonitor::applyFilter()
+{
+    m_proxyModel->setFilter(search->text());
+}
+
+void NetworkMonitor::exportHar()
+{
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Export Requests"),
+                                tr("requests.har"),
+                                tr("HTTP Archive").append(QLatin1String(" (*.har)")));
+    if (fileName.isEmpty())
+        return;
+
+    HarWriter writer;
+    if (!writer.write(fileName, m_model))
+        QMessageBox::critical(this, tr("Export error"), tr("Error saving the requests to %1").arg(fileName));
+}
+
+void NetworkMonitor::importHar()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Import Requests"),
+                                QString(),
+                                tr("HTTP Archive").append(QLatin1String(" (*.har)")));
+    if (fileName.isEmpty())
+        return;
+
+    // The imported requests replace the log so that their timeline is not
+    // mixed up with the requests made so far
+    m_model->removeRows(0, m_model->rowCount(), QModelIndex());
+    HarReader reader;
+    if (!reader.read(fileName, m_model))
+        QMessageBox::warning(this, tr("Import error"),
+                             tr("Error when loading %1:\n%2").arg(fileName).arg(reader.errorString()));
+}
+
+void NetworkMonitor::updateStatistics()
+{
+    AdBlockManager *manager = BrowserApplication::networkAccessManager()->adBlockManager();
+    if (!manager->isEnabled() || manager->ruleCount() == 0) {
+        statisticsLabel->clear();
+        return;
+    }
+    statisticsLabel->setText(tr("Blocked %1 of %2 requests with %3 rules")
+                             .arg(manager->blockedRequests())
+                             .arg(manager->checkedRequests())
+                             .arg(manager->ruleCount()));
+}
+
+void NetworkMonitor::scheduleHostStatistics()
+{
+    if (!m_hostStatisticsTimer->isActive())
+        m_hostStatisticsTimer->start();
+}
+
+void NetworkMonitor::updateHostStatistics()
+{
+    QList<HostStatistics> statistics = m_model->hostStatistics();
+    m_hostStatistics->setRowCount(statistics.count());
+    for (int i = 0; i < statistics.count(); ++i) {
+        const HostStatistics &host = statistics.at(i);
+        m_hostStatistics->setData(m_hostStatistics->index(i, 0), host.host);
+        m_hostStatistics->setData(m_hostStatistics->index(i, 1), host.requests);
+        m_hostStatistics->setData(m_hostStatistics->index(i, 2), host.fromCache);
+        m_hostStatistics->setData(m_hostStatistics->index(i, 3), host.bytesReceived);
+        m_hostStatistics->setData(m_hostStatistics->index(i, 4),
+                host.waited ? tr("%1 ms").arg(host.waitTime / host.waited) : QString());
+        m_hostStatistics->setData(m_hostStatistics->index(i, 5),
+                host.finished ? tr("%1 ms").arg(host.totalTime / host.finished) : QString());
+        for (int j = 0; j < 6; ++j)
+            m_hostStatistics->item(i, j)->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+    }
+}
+
+// Header names are numbered in the order they are first seen
+static QList<QByteArray> &headerNames()
+{
+    static QList<QByteArray> names;
+    return names;
+}
+
+static QHash<QByteArray, quint16> &headerNameIds()
+{
+    static QHash<QByteArray, quint16> ids;
+    return ids;
+}
+
+// Used once all numbers are taken, the name is then kept with the value
+static const quint16 InlineName = 0xffff;
+
+static quint16 headerNameId(const QByteArray &name)
+{
+    QHash<QByteArray, quint16> &ids = headerNameIds();
+    QHash<QByteArray, quint16>::const_iterator it = ids.constFind(name);
+    if (it != ids.constEnd())
+        return it.value();
+    if (headerNames().count() >= InlineName)
+        return InlineName;
+    quint16 id = headerNames().count();
+    headerNames().append(name);
+    ids.insert(name, id);
+    return id;
+}
+
+/*
+    Every header is stored as the number of its name and the length of its
+    value, two and four bytes, followed by the value.
+  */
+void RequestHeaders::append(const QByteArray &name, const QByteArray &value)
+{
+    quint16 id = headerNameId(name);
+    QByteArray stored = value;
+    if (id == InlineName)
+        stored = name + '\0' + value;
+
+    int length = stored.size();
+    char record[6];
+    qMemCopy(record, &id, sizeof(id));
+    qMemCopy(record + 2, &length, sizeof(length));
+    m_data.append(record, sizeof(record));
+    m_data.append(stored);
+}
+
+void RequestHeaders::clear()
+{
+    m_data.clear();
+}
+
+bool RequestHeaders::isEmpty() const
+{
+    return m_data.isEmpty();
+}
+
+QByteArray RequestHeaders::value(const QByteArray &name) const
+{
+    HeaderList headers = toList();
+    for (int i = 0; i < headers.count(); ++i) {
+        if (qstricmp(headers.at(i).first.constData(), name.constData()) == 0)
+            return headers.at(i).second;
+    }
+    return QByteArray();
+}
+
+RequestHeaders::HeaderList RequestHeaders::toList() const
+{
+    HeaderList headers;
+    const char *data = m_data.constData();
+    int position = 0;
+    while (position + 6 <= m_data.size()) {
+        quint16 id;
+        int length;
+        qMemCopy(&id, data + position, sizeof(id));
+        qMemCopy(&length, data + position + 2, sizeof(length));
+        position += 6;
+        QByteArray value = m_data.mid(position, length);
+        position += length;
+        if (id == InlineName) {
+            int separator = value.indexOf('\0');
+            headers.append(qMakePair(value.left(separator), value.mid(separator + 1)));
+        } else {
+            headers.append(qMakePair(headerNames().at(id), value));
+        }
+    }
+    return headers;
+}
+
+Request::Request()
+    : op(QNetworkAccessManager::GetOperation)
+    , reply(0)
+    , status(0)
+    , length(0)
+    , created(-1)
+    , metaDataChanged(-1)
+    , firstByte(-1)
+    , finished(-1)
+    , bytesReceived(0)
+    , fromCache(false)
+    , blocked(false)
+{
+}
+
+HostStatistics::HostStatistics()
+    : requests(0)
+    , finished(0)
+    , fromCache(0)
+    , bytesReceived(0)
+    , waitTime(0)
+    , waited(0)
+    , totalTime(0)
+{
+}
+
 RequestModel::RequestModel(QObject *parent)
     : QAbstractTableModel(parent)
+    , m_first(0)
+    , m_count(0)
+    , m_maximumRequests(10000)
+    , m_timelineStart(-1)
+    , m_timelineEnd(-1)
 {
+    QSettings settings;
+    settings.beginGroup(QLatin1String("networkMonitor"));
+    m_maximumRequests = qMax(1, settings.value(QLatin1String("maximumRequests"), m_maximumRequests).toInt());
+
     NetworkAccessManager *manager = BrowserApplication::networkAccessManager();
     connect(manager, SIGNAL(requestCreated(QNetworkAccessManager::Operation, const QNetworkRequest &, QNetworkReply *)),
             this, SLOT(requestCreated(QNetworkAccessManager::Operation, const QNetworkRequest &, QNetworkReply *)));
@@ -128,19 +377,264 @@ void RequestModel::requestCreated(QNetworkAccessManager::Operation op, const QNe
 {
     Request request;
     request.op = op;
-    request.request = req;
+    request.url = req.url().toEncoded();
     request.reply = reply;
-    request.length = 0;
+    foreach (const QByteArray &header, req.rawHeaderList())
+        request.requestHeaders.append(header, req.rawHeader(header));
+    request.created = currentTime();
     addRequest(request);
 }
 
+static QDateTime &clockStarted()
+{
+    static QDateTime started;
+    return started;
+}
+
+/*
+    A clock that only moves forward, changes to the system time would
+    otherwise show up as requests taking hours or finishing before
+    they started.
+  */
+qint64 RequestModel::currentTime()
+{
+#if QT_VERSION >= 0x040700
+    static QElapsedTimer clock;
+#else
+    // Not monotonic, but the best Qt has to offer before 4.7
+    static QTime clock;
+#endif
+    if (!clock.isValid()) {
+        clock.start();
+        clockStarted() = QDateTime::currentDateTime().toUTC();
+    }
+    return clock.elapsed();
+}
+
+// The wall clock time of \a time on currentTime()'s clock
+QDateTime RequestModel::dateTime(qint64 time)
+{
+    currentTime();
+    QDateTime started = clockStarted();
+    return started.addMSecs(time);
+}
+
+qint64 RequestModel::timelineStart() const
+{
+    return m_timelineStart;
+}
+
+qint64 RequestModel::timelineEnd() const
+{
+    return m_timelineEnd;
+}
+
+static QString hostOfUrl(const QByteArray &url)
+{
+    int start = url.indexOf("://");
+    if (start == -1)
+        return QString();
+    start += 3;
+    int end = start;
+    while (end < url.size() && url.at(end) != '/' && url.at(end) != '?' && url.at(end) != '#') {
+        if (url.at(end) == '@')
+            start = end + 1;
+        ++end;
+    }
+    int port = url.lastIndexOf(':', end - 1);
+    if (port >= start && url.at(end - 1) != ']')
+        end = port;
+    return QString::fromLatin1(url.constData() + start, end - start).toLower();
+}
+
+QList<HostStatistics> RequestModel::hostStatistics() const
+{
+    return m_hosts.values();
+}
+
+// Adds the request to the statistics of its host or with a negative sign takes it out
+void RequestModel::countRequest(const Request &request, int sign)
+{
+    QString name = hostOfUrl(request.url);
+    HostStatistics &host = m_hosts[name];
+    host.host = name;
+    host.requests += sign;
+    if (request.fromCache)
+        host.fromCache += sign;
+    host.bytesReceived += sign * request.bytesReceived;
+    if (request.metaDataChanged != -1) {
+        host.waitTime += sign * (request.metaDataChanged - request.created);
+        host.waited += sign;
+    }
+    if (request.finished != -1) {
+        host.totalTime += sign * (request.finished - request.created);
+        host.finished += sign;
+    }
+    if (host.requests == 0)
+        m_hosts.remove(name);
+}
+
+int RequestModel::maximumRequests() const
+{
+    return m_maximumRequests;
+}
+
+void RequestModel::setMaximumRequests(int maximum)
+{
+    maximum = qMax(1, maximum);
+    if (maximum == m_maximumRequests)
+        return;
+
+    // Start over with the newest requests at the front of a new buffer
+    int keep = qMin(m_count, maximum);
+    if (keep < m_count)
+        removeRows(0, m_count - keep, QModelIndex());
+    QVector<Request> requests;
+    requests.reserve(keep);
+    m_replySlots.clear();
+    for (int i = 0; i < keep; ++i) {
+        requests.append(requestAt(i));
+        if (requests.last().reply)
+            m_replySlots.insert(requests.last().reply, i);
+    }
+    m_requests = requests;
+    m_first = 0;
+    m_maximumRequests = maximum;
+}
+
+int RequestModel::slotForRow(int row) const
+{
+    return (m_first + row) % m_requests.size();
+}
+
+const Request &RequestModel::requestAt(int row) const
+{
+    return m_requests.at(slotForRow(row));
+}
+
+int RequestModel::rowForReply(QObject *reply) const
+{
+    QHash<QObject*, int>::const_iterator it = m_replySlots.constFind(reply);
+    if (it == m_replySlots.constEnd())
+        return -1;
+    int row = it.value() - m_first;
+    if (row < 0)
+        row += m_requests.size();
+    return row;
+}
+
+void RequestModel::forgetReply(Request &request)
+{
+    if (!request.reply)
+        return;
+    m_replySlots.remove(request.reply);
+    disconnect(request.reply, 0, this, 0);
+    request.reply = 0;
+}
+
 void RequestModel::addRequest(const Request &request)
 {
-    beginInsertRows(QModelIndex(), rowCount(), rowCount());
-    m_requests.append(request);
-    connect(request.reply, SIGNAL(finished()),
-            this, SLOT(update()));
+    // Make room in batches, every removal costs the proxy a pass over its rows
+    if (m_count >= m_maximumRequests)
+        removeRows(0, qMax(1, m_maximumRequests / 32), QModelIndex());
+
+    int slot;
+    beginInsertRows(QModelIndex(), m_count, m_count);
+    if (m_requests.size() < m_maximumRequests && m_first + m_count == m_requests.size()) {
+        slot = m_requests.size();
+        m_requests.append(request);
+    } else {
+        slot = slotForRow(m_count);
+        m_requests[slot] = request;
+    }
+    ++m_count;
+    if (request.reply) {
+        m_replySlots.insert(request.reply, slot);
+        connect(request.reply, SIGNAL(metaDataChanged()),
+                this, SLOT(replyMetaDataChanged()));
+        connect(request.reply, SIGNAL(readyRead()),
+                this, SLOT(replyReadyRead()));
+        connect(request.reply, SIGNAL(downloadProgress(qint64, qint64)),
+                this, SLOT(replyDownloadProgress(qint64, qint64)));
+        connect(request.reply, SIGNAL(finished()),
+                this, SLOT(update()));
+        connect(request.reply, SIGNAL(destroyed(QObject *)),
+                this, SLOT(replyDestroyed(QObject *)));
+    }
+    countRequest(request, 1);
     endInsertRows();
+    // Imported requests have finished already
+    updateTimeline(m_count - 1, qMax(request.created, request.finished));
+}
+
+void RequestModel::updateTimeline(int row, qint64 time)
+{
+    bool changed = false;
+    if (m_timelineStart == -1 || requestAt(row).created < m_timelineStart) {
+        m_timelineStart = requestAt(row).created;
+        changed = true;
+    }
+    if (time > m_timelineEnd) {
+        m_timelineEnd = time;
+        changed = true;
+    }
+    if (changed)
+        emit timelineChanged();
+    emit dataChanged(index(row, 0), index(row, columnCount() - 1));
+}
+
+void RequestModel::replyMetaDataChanged()
+{
+    QNetworkReply *reply = qobject_cast<QNetworkReply*>(sender());
+    int row = rowForReply(reply);
+    if (row == -1)
+        return;
+    Request &request = m_requests[slotForRow(row)];
+    countRequest(request, -1);
+    // Redirects and multipart responses can change the meta data again
+    if (request.metaDataChanged == -1)
+        request.metaDataChanged = currentTime();
+    request.fromCache = reply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool();
+    countRequest(request, 1);
+    updateTimeline(row, request.metaDataChanged);
+}
+
+void RequestModel::replyReadyRead()
+{
+    QNetworkReply *reply = qobject_cast<QNetworkReply*>(sender());
+    // Only the first one is of interest
+    disconnect(reply, SIGNAL(readyRead()), this, SLOT(replyReadyRead()));
+    int row = rowForReply(reply);
+    if (row == -1)
+        return;
+    Request &request = m_requests[slotForRow(row)];
+    request.firstByte = currentTime();
+    updateTimeline(row, request.firstByte);
+}
+
+void RequestModel::replyDownloadProgress(qint64 bytesReceived, qint64 bytesTotal)
+{
+    Q_UNUSED(bytesTotal);
+    int row = rowForReply(sender());
+    if (row == -1)
+        return;
+    Request &request = m_requests[slotForRow(row)];
+    if (bytesReceived > request.bytesReceived) {
+        countRequest(request, -1);
+        request.bytesReceived = bytesReceived;
+        countRequest(request, 1);
+        emit dataChanged(index(row, ReceivedColumn), index(row, ReceivedColumn));
+    }
+}
+
+// Replies deleted before they finished, the pointer can't be used anymore
+void RequestModel::replyDestroyed(QObject *reply)
+{
+    int row = rowForReply(reply);
+    if (row == -1)
+        return;
+    m_replySlots.remove(reply);
+    m_requests[slotForRow(row)].reply = 0;
 }
 
 void RequestModel::update()
@@ -149,30 +643,65 @@ void RequestModel::update()
     if (!reply)
         return;
 
-    int offset;
-    for (offset = m_requests.count() - 1; offset >= 0; --offset) {
-        if (m_requests[offset].reply == reply)
-            break;
-    }
+    int offset = rowForReply(reply);
     if (offset < 0)
         return;
+    Request &request = m_requests[slotForRow(offset)];
+    forgetReply(request);
+    countRequest(request, -1);
+    request.finished = currentTime();
+    request.fromCache = reply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool();
 
     // Save reply headers
-    foreach (const QByteArray &header, reply->rawHeaderList() ) {
-        QPair<QByteArray, QByteArray> pair(header, reply->rawHeader(header));
-        m_requests[offset].replyHeaders.append(pair);
-    }
+    foreach (const QByteArray &header, reply->rawHeaderList())
+        request.replyHeaders.append(header, reply->rawHeader(header));
 
     // Save reply info to be displayed
     int status = reply->attribute( QNetworkRequest::HttpStatusCodeAttribute ).toInt();
     QString reason = reply->attribute(QNetworkRequest::HttpReasonPhraseAttribute).toString();
-    m_requests[offset].response = QString(QLatin1String("%1 %2")).arg(status).arg(reason);
-    m_requests[offset].length = reply->header(QNetworkRequest::ContentLengthHeader).toInt();
-    m_requests[offset].contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    request.status = status;
+    request.reason = reason;
+    request.length = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+    request.contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+
+    if (AdBlockBlockedNetworkReply *blockedReply = qobject_cast<AdBlockBlockedNetworkReply*>(reply)) {
+        request.blocked = true;
+        request.info = tr("Filter: %1").arg(blockedReply->filter());
+    }
 
     if (status == 302) {
         QUrl target = reply->attribute( QNetworkRequest::RedirectionTargetAttribute ).toUrl();
-        m_requests[offset].info = tr("Redirect: %1").arg(target.toString());
+        request.info = tr("Redirect: %1").arg(target.toString());
+    }
+    countRequest(request, 1);
+    updateTimeline(offset, request.finished);
+}
+
+QString RequestModel::responseText(const Request &request)
+{
+    if (request.blocked)
+        return tr("Blocked");
+    if (request.finished == -1)
+        return QString();
+    QString response = QString(QLatin1String("%1 %2")).arg(request.status).arg(request.reason);
+    if (request.fromCache)
+        response = tr("%1 (from cache)").arg(response);
+    return response;
+}
+
+QString RequestModel::operationName(QNetworkAccessManager::Operation op)
+{
+    switch (op) {
+    case QNetworkAccessManager::HeadOperation:
+        return QLatin1String("HEAD");
+    case QNetworkAccessManager::GetOperation:
+        return QLatin1String("GET");
+    case QNetworkAccessManager::PutOperation:
+        return QLatin1String("PUT");
+    case QNetworkAccessManager::PostOperation:
+        return QLatin1String("POST");
+    default:
+        return tr("Unknown");
     }
 }
 
@@ -186,6 +715,8 @@ QVariant RequestModel::headerData(int section, Qt::Orientation orientation, int
         case 3: return tr("Length");
         case 4: return tr("Content Type");
         case 5: return tr("Info");
+        case 6: return tr("Received");
+        case 7: return tr("Timeline");
         }
     }
     return QAbstractItemModel::headerData(section, orientation, role);
@@ -193,67 +724,201 @@ QVariant RequestModel::headerData(int section, Qt::Orientation orientation, int
 
 QVariant RequestModel::data(const QModelIndex &index, int role) const
 {
-    if (index.row() < 0 || index.row() >= m_requests.size())
+    if (index.row() < 0 || index.row() >= m_count)
         return QVariant();
 
+    const Request &request = requestAt(index.row());
     switch (role) {
     case Qt::DisplayRole:
     case Qt::EditRole: {
         switch (index.column()) {
         case 0:
-            switch (m_requests[index.row()].op) {
-                case QNetworkAccessManager::HeadOperation:
-                    return QLatin1String("HEAD");
-                    break;
-                case QNetworkAccessManager::GetOperation:
-                    return QLatin1String("GET");
-                    break;
-                case QNetworkAccessManager::PutOperation:
-                    return QLatin1String("PUT");
-                    break;
-                case QNetworkAccessManager::PostOperation:
-                    return QLatin1String("POST");
-                    break;
-                default:
-                    return tr("Unknown");
-            }
+            return operationName(request.op);
         case 1:
-            return m_requests[index.row()].request.url().toEncoded();
+            return request.url;
         case 2:
-            return m_requests[index.row()].response;
+            return responseText(request);
         case 3:
-            return m_requests[index.row()].length;
+            return request.length;
         case 4:
-            return m_requests[index.row()].contentType;
+            return request.contentType;
         case 5:
-            return m_requests[index.row()].info;
-
+            return request.info;
+        case 6:
+            return request.bytesReceived;
+        case 7:
+            if (request.finished == -1)
+                return QVariant();
+            return tr("%1 ms").arg(request.finished - request.created);
         }
+        break;
+    }
+    case Qt::ToolTipRole:
+        if (index.column() == TimelineColumn) {
+            QStringList lines;
+            lines << tr("Started: %1 ms").arg(request.created - m_timelineStart);
+            if (request.metaDataChanged != -1)
+                lines << tr("Waiting: %1 ms").arg(request.metaDataChanged - request.created);
+            if (request.firstByte != -1)
+                lines << tr("First byte: %1 ms").arg(request.firstByte - request.created);
+            if (request.finished != -1)
+                lines << tr("Finished: %1 ms").arg(request.finished - request.created);
+            return lines.join(QLatin1String("\n"));
         }
+        break;
+    case CreatedRole:
+        return request.created;
+    case MetaDataChangedRole:
+        return request.metaDataChanged;
+    case FirstByteRole:
+        return request.firstByte;
+    case FinishedRole:
+        return request.finished;
     }
     return QVariant();
 }
 
 int RequestModel::columnCount(const QModelIndex &parent) const
 {
-    return (parent.column() > 0) ? 0 : 6;
+    return (parent.column() > 0) ? 0 : 8;
 }
 
 int RequestModel::rowCount(const QModelIndex &parent) const
 {
-    return (parent.isValid()) ? 0 : m_requests.count();
+    return (parent.isValid()) ? 0 : m_count;
 }
 
 bool RequestModel::removeRows(int row, int count, const QModelIndex &parent)
 {
-    if (parent.isValid())
+    if (parent.isValid() || row < 0 || count <= 0 || row + count > m_count)
         return false;
     int lastRow = row + count - 1;
     beginRemoveRows(parent, row, lastRow);
-    for (int i = lastRow; i >= row; --i)
-        m_requests.removeAt(i);
+    for (int i = row; i <= lastRow; ++i) {
+        forgetReply(m_requests[slotForRow(i)]);
+        countRequest(requestAt(i), -1);
+    }
+
+    if (row == 0) {
+        // The common case, the oldest requests go
+        for (int i = 0; i < count; ++i)
+            m_requests[slotForRow(i)] = Request();
+        m_first = slotForRow(count);
+    } else {
+        // Close the gap by moving the newer requests down
+        for (int i = lastRow + 1; i < m_count; ++i) {
+            int from = slotForRow(i);
+            int to = slotForRow(i - count);
+            m_requests[to] = m_requests[from];
+            if (m_requests[to].reply)
+                m_replySlots.insert(m_requests[to].reply, to);
+        }
+        for (int i = m_count - count; i < m_count; ++i)
+            m_requests[slotForRow(i)] = Request();
+    }
+    m_count -= count;
+
+    if (m_count == 0) {
+        m_requests.clear();
+        m_first = 0;
+        m_timelineStart = -1;
+        m_timelineEnd = -1;
+    }
     endRemoveRows();
     return true;
 }
 
+static bool containsIgnoreCase(const QByteArray &text, const QByteArray &lowerNeedle)
+{
+    int length = lowerNeedle.size();
+    int last = text.size() - length;
+    const char *data = text.constData();
+    const char *needle = lowerNeedle.constData();
+    for (int i = 0; i <= last; ++i) {
+        int j = 0;
+        while (j < length) {
+            char c = data[i + j];
+            if (c >= 'A' && c <= 'Z')
+                c += 'a' - 'A';
+            if (c != needle[j])
+                break;
+            ++j;
+        }
+        if (j == length)
+            return true;
+    }
+    return false;
+}
+
+RequestFilterModel::RequestFilterModel(RequestModel *model, QObject *parent)
+    : QSortFilterProxyModel(parent)
+    , m_model(model)
+{
+    setSourceModel(model);
+}
+
+QString RequestFilterModel::filter() const
+{
+    return m_filter;
+}
+
+void RequestFilterModel::setFilter(const QString &filter)
+{
+    if (filter == m_filter)
+        return;
+    m_filter = filter;
+    m_lowerFilter = filter.toLower().toUtf8();
+    invalidateFilter();
+}
+
+bool RequestFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    Q_UNUSED(sourceParent);
+    if (m_filter.isEmpty())
+        return true;
+
+    const Request &request = m_model->requestAt(sourceRow);
+    return containsIgnoreCase(request.url, m_lowerFilter)
+           || RequestModel::responseText(request).contains(m_filter, Qt::CaseInsensitive)
+           || request.contentType.contains(m_filter, Qt::CaseInsensitive)
+           || request.info.contains(m_filter, Qt::CaseInsensitive)
+           || RequestModel::operationName(request.op).contains(m_filter, Qt::CaseInsensitive);
+}
+
+RequestTimelineDelegate::RequestTimelineDelegate(RequestModel *model, QObject *parent)
+    : QStyledItemDelegate(parent)
+    , m_model(model)
+{
+}
 
+void RequestTimelineDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    QStyleOptionViewItem background = option;
+    background.text = QString();
+    QStyledItemDelegate::paint(painter, background, index);
+
+    qint64 start = m_model->timelineStart();
+    qint64 span = qMax(qint64(1), m_model->timelineEnd() - start);
+    qint64 created = index.data(RequestModel::CreatedRole).toLongLong();
+    qint64 metaDataChanged = index.data(RequestModel::MetaDataChangedRole).toLongLong();
+    qint64 finished = index.data(RequestModel::FinishedRole).toLongLong();
+    if (start == -1 || created == -1)
+        return;
+    // Still running requests reach to the end
+    if (finished == -1)
+        finished = m_model->timelineEnd();
+    if (metaDataChanged == -1)
+        metaDataChanged = finished;
+
+    QRect rect = option.rect.adjusted(2, 3, -2, -3);
+    int left = rect.left() + int((created - start) * rect.width() / span);
+    int middle = rect.left() + int((metaDataChanged - start) * rect.width() / span);
+    int right = rect.left() + int((finished - start) * rect.width() / span);
+    right = qMax(right, left + 1);
+
+    QColor color = option.palette.color(QPalette::Highlight);
+    QColor waitColor = color;
+    waitColor.setAlpha(80);
+    painter->fillRect(QRect(left, rect.top(), middle - left, rect.height()), waitColor);
+    painter->fillRect(QRect(middle, rect.top(), qMax(1, right - middle), rect.height()), color);
+}
@@ -23,11 +23,18 @@
 #include "ui_networkmonitor.h"
 #include <qdialog.h>
 
+#include <qdatetime.h>
+#include <qhash.h>
+#include <qmap.h>
 #include <qnetworkaccessmanager.h>
+#include <qsortfilterproxymodel.h>
+#include <qstyleditemdelegate.h>
+#include <qvector.h>
 
+class RequestFilterModel;
 class RequestModel;
 class QStandardItemModel;
-class QSortFilterProxyModel;
+class QTimer;
 class NetworkMonitor : public QDialog, public Ui_NetworkMonitorDialog
 {
     Q_OBJECT
@@ -39,39 +46,141 @@ protected:
 
 private slots:
     void currentChanged(const QModelIndex &current, const QModelIndex &previous);
+    void updateStatistics();
+    void scheduleHostStatistics();
+    void updateHostStatistics();
+    void applyFilter();
+    void exportHar();
+    void importHar();
 
 public:
     static NetworkMonitor *self();
 
 private:
-    QSortFilterProxyModel *m_proxyModel;
+    RequestFilterModel *m_proxyModel;
     RequestModel *m_model;
     QStandardItemModel *m_requestHeaders;
     QStandardItemModel *m_replyHeaders;
+    QStandardItemModel *m_hostStatistics;
+    QTimer *m_hostStatisticsTimer;
+    QTimer *m_filterTimer;
 };
 
 #include <qnetworkrequest.h>
 
+/*
+    The headers of a request or reply packed into one byte array.
+
+    The names, of which there are only a few different ones, are stored
+    once for all requests and referred to by their number, each followed
+    by its value.
+  */
+class RequestHeaders
+{
+public:
+    typedef QList<QPair<QByteArray, QByteArray> > HeaderList;
+
+    void append(const QByteArray &name, const QByteArray &value);
+    void clear();
+    bool isEmpty() const;
+    QByteArray value(const QByteArray &name) const;
+    HeaderList toList() const;
+
+private:
+    QByteArray m_data;
+};
+
 class Request {
 public:
+    Request();
+
     QNetworkAccessManager::Operation op;
-    QNetworkRequest request;
+    QByteArray url;
+    // Only set while the request is running
     QNetworkReply *reply;
+    RequestHeaders requestHeaders;
+    RequestHeaders replyHeaders;
 
-    QString response;
-    int length;
+    int status;
+    QString reason;
+    qint64 length;
     QString contentType;
     QString info;
-    QList<QPair<QByteArray, QByteArray> > replyHeaders;
+
+    // Milliseconds on RequestModel::currentTime(), -1 until it happened
+    qint64 created;
+    qint64 metaDataChanged;
+    qint64 firstByte;
+    qint64 finished;
+    qint64 bytesReceived;
+    bool fromCache;
+    bool blocked;
 };
 
+class HostStatistics {
+public:
+    HostStatistics();
+
+    QString host;
+    int requests;
+    int finished;
+    int fromCache;
+    qint64 bytesReceived;
+    // Summed over the requests that got that far
+    qint64 waitTime;
+    int waited;
+    qint64 totalTime;
+};
+
+/*
+    The log of requests, kept in a ring buffer of a fixed number of
+    requests.  Once it is full the oldest requests make room for new ones,
+    a few at a time so that views and proxies don't have to update all
+    their rows for every request.  Running requests are found through a
+    hash from their reply to their slot in the buffer.  The statistics of
+    each host are updated along with the requests.
+  */
 class RequestModel : public QAbstractTableModel
 {
     Q_OBJECT
 
+signals:
+    void timelineChanged();
+
 public:
+    enum Roles {
+        CreatedRole = Qt::UserRole + 1,
+        MetaDataChangedRole = Qt::UserRole + 2,
+        FirstByteRole = Qt::UserRole + 3,
+        FinishedRole = Qt::UserRole + 4
+    };
+
+    enum Columns {
+        MethodColumn,
+        AddressColumn,
+        ResponseColumn,
+        LengthColumn,
+        ContentTypeColumn,
+        InfoColumn,
+        ReceivedColumn,
+        TimelineColumn
+    };
+
     RequestModel(QObject *parent = 0);
 
+    static qint64 currentTime();
+    static QDateTime dateTime(qint64 time);
+    qint64 timelineStart() const;
+    qint64 timelineEnd() const;
+    QList<HostStatistics> hostStatistics() const;
+
+    int maximumRequests() const;
+    void setMaximumRequests(int maximum);
+    const Request &requestAt(int row) const;
+    int rowForReply(QObject *reply) const;
+    static QString operationName(QNetworkAccessManager::Operation op);
+    static QString responseText(const Request &request);
+
     void addRequest(const Request &request);
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
@@ -81,12 +190,71 @@ public:
 
 private slots:
     void requestCreated(QNetworkAccessManager::Operation op, const QNetworkRequest &req, QNetworkReply *reply);
+    void replyMetaDataChanged();
+    void replyReadyRead();
+    void replyDownloadProgress(qint64 bytesReceived, qint64 bytesTotal);
+    void replyDestroyed(QObject *reply);
     void update();
 
 private:
-    friend class NetworkMonitor;
-    QList<Request> m_requests;
+    int slotForRow(int row) const;
+    void forgetReply(Request &request);
+    void updateTimeline(int row, qint64 time);
+    void countRequest(const Request &request, int sign);
+
+    QVector<Request> m_requests;
+    int m_first;
+    int m_count;
+    int m_maximumRequests;
+    QHash<QObject*, int> m_replySlots;
+
+    qint64 m_timelineStart;
+    qint64 m_timelineEnd;
+    // Kept up to date as requests come, change and go
+    QMap<QString, HostStatistics> m_hosts;
 };
 
-#endif // NETWORKMONITOR_H
+/*
+    Filters the requests by looking at what the model shows directly,
+    which is a lot faster than going through data() for every column.
+  */
+class RequestFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    RequestFilterModel(RequestModel *model, QObject *parent = 0);
+
+    QString filter() const;
+
+public slots:
+    void setFilter(const QString &filter);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+
+private:
+    RequestModel *m_model;
+    QString m_filter;
+    QByteArray m_lowerFilter;
+};
 
+/*
+    Draws the time between a request being made and it being finished as a
+    bar on a scale that covers all requests, the part spent waiting for the
+    response to start in a lighter color.
+  */
+class RequestTimelineDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    RequestTimelineDelegate(RequestModel *model, QObject *parent = 0);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const;
+
+private:
+    RequestModel *m_model;
+};
+
+#endif // NETWORKMONITOR_H
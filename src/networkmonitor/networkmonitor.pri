@@ -2,11 +2,14 @@ INCLUDEPATH += $$PWD
 DEPENDPATH += $$PWD
 
 HEADERS += \
+  harreader.h \
+  harwriter.h \
   networkmonitor.h
 
 SOURCES += \
+  harreader.cpp \
+  harwriter.cpp \
   networkmonitor.cpp
 
 FORMS += \
     networkmonitor.ui
-
@@ -23,6 +23,7 @@
 #include "browserapplication.h"
 #include "languagemanager.h"
 #include "networkaccessmanager.h"
+#include "requestscheduler.h"
 
 #include <qbuffer.h>
 #include <qnetworkaccessmanager.h>
@@ -175,7 +176,9 @@ void OpenSearchEngine::loadImage() const
     if (!networkAccessManager() || m_imageUrl.isEmpty())
         return;
 
-    QNetworkReply *reply = networkAccessManager()->get(QNetworkRequest(QUrl::fromEncoded(m_imageUrl.toUtf8())));
+    QNetworkRequest request(QUrl::fromEncoded(m_imageUrl.toUtf8()));
+    request.setAttribute(RequestScheduler::PriorityAttribute, RequestScheduler::SpeculativePriority);
+    QNetworkReply *reply = networkAccessManager()->get(request);
     connect(reply, SIGNAL(finished()), this, SLOT(imageObtained()));
 }
 
@@ -257,7 +260,9 @@ void OpenSearchEngine::requestSuggestions(const QString &searchTerm)
         m_suggestionsReply = 0;
     }
 
-    m_suggestionsReply = networkAccessManager()->get(QNetworkRequest(suggestionsUrl(searchTerm)));
+    QNetworkRequest request(suggestionsUrl(searchTerm));
+    request.setAttribute(RequestScheduler::PriorityAttribute, RequestScheduler::SpeculativePriority);
+    m_suggestionsReply = networkAccessManager()->get(request);
     connect(m_suggestionsReply, SIGNAL(finished()), this, SLOT(suggestionsObtained()));
 }
 
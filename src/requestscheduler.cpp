@@ -0,0 +1,426 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include "requestscheduler.h"
+
+#include <qnetworkrequest.h>
+#include <qvariant.h>
+
+#ifndef QT_NO_OPENSSL
+#include <qsslconfiguration.h>
+#endif
+
+const QNetworkRequest::Attribute RequestScheduler::PriorityAttribute = QNetworkRequest::Attribute(QNetworkRequest::User + 100);
+const QNetworkRequest::Attribute RequestScheduler::PageAttribute = QNetworkRequest::Attribute(QNetworkRequest::User + 101);
+const QNetworkRequest::Attribute RequestScheduler::MainFrameAttribute = QNetworkRequest::Attribute(QNetworkRequest::User + 102);
+const QNetworkRequest::Attribute RequestScheduler::ScheduledAttribute = QNetworkRequest::Attribute(QNetworkRequest::User + 103);
+const QNetworkRequest::Attribute RequestScheduler::SubFrameAttribute = QNetworkRequest::Attribute(QNetworkRequest::User + 104);
+
+RequestScheduler::RequestScheduler(QNetworkAccessManager *manager)
+    : QObject(manager)
+    , m_manager(manager)
+    , m_maximumRequestsPerHost(6)
+    , m_maximumRequests(32)
+{
+}
+
+RequestScheduler::~RequestScheduler()
+{
+    // The running requests outlive us when the manager is deleted
+    QHash<QNetworkReply*, QString>::const_iterator it = m_running.constBegin();
+    for (; it != m_running.constEnd(); ++it)
+        disconnect(it.key(), 0, this, 0);
+}
+
+int RequestScheduler::maximumRequestsPerHost() const
+{
+    return m_maximumRequestsPerHost;
+}
+
+void RequestScheduler::setMaximumRequestsPerHost(int maximum)
+{
+    m_maximumRequestsPerHost = qMax(1, maximum);
+    startQueued();
+}
+
+int RequestScheduler::maximumRequests() const
+{
+    return m_maximumRequests;
+}
+
+void RequestScheduler::setMaximumRequests(int maximum)
+{
+    m_maximumRequests = qMax(1, maximum);
+    startQueued();
+}
+
+QObject *RequestScheduler::currentPage() const
+{
+    return m_currentPage;
+}
+
+void RequestScheduler::setCurrentPage(QObject *page)
+{
+    if (m_currentPage == page)
+        return;
+    m_currentPage = page;
+    foreach (ScheduledNetworkReply *reply, m_queue)
+        reply->updatePriority();
+}
+
+RequestScheduler::Priority RequestScheduler::priority(const QNetworkRequest &request) const
+{
+    QVariant priority = request.attribute(PriorityAttribute);
+    if (priority.isValid())
+        return Priority(qBound(int(CurrentMainFramePriority), priority.toInt(), int(SpeculativePriority)));
+
+    if (request.url().path() == QLatin1String("/favicon.ico"))
+        return SpeculativePriority;
+
+    QObject *page = qVariantValue<QObject*>(request.attribute(PageAttribute));
+    if (!page)
+        return CurrentPagePriority;
+    if (page != m_currentPage)
+        return BackgroundPagePriority;
+    if (request.attribute(MainFrameAttribute).toBool()
+        || request.attribute(SubFrameAttribute).toBool())
+        return CurrentMainFramePriority;
+    return CurrentPagePriority;
+}
+
+int RequestScheduler::runningRequests() const
+{
+    return m_running.count();
+}
+
+int RequestScheduler::queuedRequests() const
+{
+    return m_queue.count();
+}
+
+bool RequestScheduler::canSchedule(QNetworkAccessManager::Operation op, const QNetworkRequest &request)
+{
+    if (op != QNetworkAccessManager::GetOperation
+        && op != QNetworkAccessManager::HeadOperation)
+        return false;
+    if (request.attribute(ScheduledAttribute).toBool())
+        return false;
+    QString scheme = request.url().scheme();
+    return (scheme == QLatin1String("http") || scheme == QLatin1String("https"));
+}
+
+QNetworkReply *RequestScheduler::schedule(QNetworkAccessManager::Operation op, const QNetworkRequest &request)
+{
+    QString host = hostKey(request.url());
+    if (m_queue.isEmpty() && hasRoom(host))
+        return start(op, request, host);
+
+    ScheduledNetworkReply *reply = new ScheduledNetworkReply(op, request, host, this, m_manager);
+    m_queue.append(reply);
+    startQueued();
+    return reply;
+}
+
+/*
+    Stops counting \a reply as running, a reply that is still waiting is
+    started right away without taking the room of another request.
+  */
+void RequestScheduler::detach(QNetworkReply *reply)
+{
+    if (ScheduledNetworkReply *scheduled = qobject_cast<ScheduledNetworkReply*>(reply)) {
+        if (!scheduled->reply()) {
+            if (!m_queue.contains(scheduled))
+                return;
+            dequeue(scheduled);
+            scheduled->start(startRequest(scheduled->operation(), scheduled->request()));
+            return;
+        }
+        reply = scheduled->reply();
+    }
+
+    if (!m_running.contains(reply))
+        return;
+    disconnect(reply, 0, this, 0);
+    release(reply);
+}
+
+QString RequestScheduler::hostKey(const QUrl &url)
+{
+    QString scheme = url.scheme();
+    int defaultPort = (scheme == QLatin1String("https")) ? 443 : 80;
+    return scheme + QLatin1String("://") + url.host().toLower()
+           + QLatin1Char(':') + QString::number(url.port(defaultPort));
+}
+
+bool RequestScheduler::hasRoom(const QString &host) const
+{
+    return m_running.count() < m_maximumRequests
+           && m_runningPerHost.value(host) < m_maximumRequestsPerHost;
+}
+
+QNetworkReply *RequestScheduler::startRequest(QNetworkAccessManager::Operation op, const QNetworkRequest &request)
+{
+    QNetworkRequest scheduledRequest = request;
+    scheduledRequest.setAttribute(ScheduledAttribute, true);
+    if (op == QNetworkAccessManager::HeadOperation)
+        return m_manager->head(scheduledRequest);
+    return m_manager->get(scheduledRequest);
+}
+
+QNetworkReply *RequestScheduler::start(QNetworkAccessManager::Operation op, const QNetworkRequest &request, const QString &host)
+{
+    QNetworkReply *reply = startRequest(op, request);
+    m_running.insert(reply, host);
+    ++m_runningPerHost[host];
+    connect(reply, SIGNAL(finished()),
+            this, SLOT(requestFinished()));
+    connect(reply, SIGNAL(destroyed(QObject*)),
+            this, SLOT(requestDestroyed(QObject*)));
+    return reply;
+}
+
+void RequestScheduler::requestFinished()
+{
+    QNetworkReply *reply = qobject_cast<QNetworkReply*>(sender());
+    if (!reply)
+        return;
+    disconnect(reply, 0, this, 0);
+    release(reply);
+}
+
+void RequestScheduler::requestDestroyed(QObject *object)
+{
+    // Only the address is used, the reply is already being destroyed
+    release(static_cast<QNetworkReply*>(object));
+}
+
+void RequestScheduler::release(QNetworkReply *reply)
+{
+    QHash<QNetworkReply*, QString>::iterator it = m_running.find(reply);
+    if (it == m_running.end())
+        return;
+    QString host = it.value();
+    m_running.erase(it);
+    if (--m_runningPerHost[host] <= 0)
+        m_runningPerHost.remove(host);
+    startQueued();
+}
+
+void RequestScheduler::startQueued()
+{
+    while (!m_queue.isEmpty() && m_running.count() < m_maximumRequests) {
+        // The queue is in the order the requests were made, so the first
+        // one found with the best priority is the oldest one
+        int next = -1;
+        for (int i = 0; i < m_queue.count(); ++i) {
+            ScheduledNetworkReply *reply = m_queue.at(i);
+            if ((next == -1 || reply->priority() < m_queue.at(next)->priority())
+                && hasRoom(reply->host())) {
+                next = i;
+                if (reply->priority() == CurrentMainFramePriority)
+                    break;
+            }
+        }
+        if (next == -1)
+            return;
+
+        ScheduledNetworkReply *reply = m_queue.takeAt(next);
+        reply->start(start(reply->operation(), reply->request(), reply->host()));
+    }
+}
+
+void RequestScheduler::dequeue(ScheduledNetworkReply *reply)
+{
+    m_queue.removeAll(reply);
+}
+
+
+ScheduledNetworkReply::ScheduledNetworkReply(QNetworkAccessManager::Operation op, const QNetworkRequest &request,
+                                             const QString &host, RequestScheduler *scheduler, QObject *parent)
+    : QNetworkReply(parent)
+    , m_scheduler(scheduler)
+    , m_host(host)
+    , m_priority(scheduler->priority(request))
+    , m_reply(0)
+    , m_ignoreSslErrors(false)
+{
+    setOperation(op);
+    setRequest(request);
+    setUrl(request.url());
+    open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+}
+
+ScheduledNetworkReply::~ScheduledNetworkReply()
+{
+    if (!m_reply && m_scheduler)
+        m_scheduler->dequeue(this);
+}
+
+QString ScheduledNetworkReply::host() const
+{
+    return m_host;
+}
+
+RequestScheduler::Priority ScheduledNetworkReply::priority() const
+{
+    return m_priority;
+}
+
+void ScheduledNetworkReply::updatePriority()
+{
+    if (m_scheduler)
+        m_priority = m_scheduler->priority(request());
+}
+
+QNetworkReply *ScheduledNetworkReply::reply() const
+{
+    return m_reply;
+}
+
+void ScheduledNetworkReply::start(QNetworkReply *reply)
+{
+    m_reply = reply;
+    m_reply->setParent(this);
+    if (m_ignoreSslErrors)
+        m_reply->ignoreSslErrors();
+    if (readBufferSize())
+        m_reply->setReadBufferSize(readBufferSize());
+
+    connect(m_reply, SIGNAL(metaDataChanged()),
+            this, SLOT(replyMetaDataChanged()));
+    connect(m_reply, SIGNAL(readyRead()),
+            this, SIGNAL(readyRead()));
+    connect(m_reply, SIGNAL(downloadProgress(qint64, qint64)),
+            this, SIGNAL(downloadProgress(qint64, qint64)));
+    connect(m_reply, SIGNAL(uploadProgress(qint64, qint64)),
+            this, SIGNAL(uploadProgress(qint64, qint64)));
+    connect(m_reply, SIGNAL(error(QNetworkReply::NetworkError)),
+            this, SLOT(replyError(QNetworkReply::NetworkError)));
+    connect(m_reply, SIGNAL(finished()),
+            this, SLOT(replyFinished()));
+#ifndef QT_NO_OPENSSL
+    connect(m_reply, SIGNAL(sslErrors(const QList<QSslError> &)),
+            this, SLOT(replySslErrors(const QList<QSslError> &)));
+#endif
+}
+
+qint64 ScheduledNetworkReply::bytesAvailable() const
+{
+    qint64 available = QNetworkReply::bytesAvailable();
+    if (m_reply)
+        available += m_reply->bytesAvailable();
+    return available;
+}
+
+bool ScheduledNetworkReply::isSequential() const
+{
+    return true;
+}
+
+void ScheduledNetworkReply::abort()
+{
+    if (m_reply) {
+        m_reply->abort();
+        return;
+    }
+
+    if (m_scheduler)
+        m_scheduler->dequeue(this);
+    m_scheduler = 0;
+    close();
+    setError(QNetworkReply::OperationCanceledError, tr("Operation canceled"));
+    emit error(QNetworkReply::OperationCanceledError);
+    emit finished();
+}
+
+void ScheduledNetworkReply::close()
+{
+    if (m_reply)
+        m_reply->close();
+    QNetworkReply::close();
+}
+
+void ScheduledNetworkReply::setReadBufferSize(qint64 size)
+{
+    QNetworkReply::setReadBufferSize(size);
+    if (m_reply)
+        m_reply->setReadBufferSize(size);
+}
+
+void ScheduledNetworkReply::ignoreSslErrors()
+{
+    m_ignoreSslErrors = true;
+    if (m_reply)
+        m_reply->ignoreSslErrors();
+}
+
+qint64 ScheduledNetworkReply::readData(char *data, qint64 maxSize)
+{
+    if (!m_reply)
+        return 0;
+    return m_reply->read(data, maxSize);
+}
+
+void ScheduledNetworkReply::copyMetaData()
+{
+    foreach (const QByteArray &header, m_reply->rawHeaderList())
+        setRawHeader(header, m_reply->rawHeader(header));
+    setUrl(m_reply->url());
+
+    static const QNetworkRequest::Attribute attributes[] = {
+        QNetworkRequest::HttpStatusCodeAttribute,
+        QNetworkRequest::HttpReasonPhraseAttribute,
+        QNetworkRequest::RedirectionTargetAttribute,
+        QNetworkRequest::ConnectionEncryptedAttribute,
+        QNetworkRequest::SourceIsFromCacheAttribute
+    };
+    for (uint i = 0; i < sizeof(attributes) / sizeof(attributes[0]); ++i)
+        setAttribute(attributes[i], m_reply->attribute(attributes[i]));
+#ifndef QT_NO_OPENSSL
+    setSslConfiguration(m_reply->sslConfiguration());
+#endif
+}
+
+void ScheduledNetworkReply::replyMetaDataChanged()
+{
+    copyMetaData();
+    emit metaDataChanged();
+}
+
+void ScheduledNetworkReply::replyError(QNetworkReply::NetworkError code)
+{
+    setError(code, m_reply->errorString());
+    emit error(code);
+}
+
+void ScheduledNetworkReply::replyFinished()
+{
+    copyMetaData();
+    emit finished();
+}
+
+#ifndef QT_NO_OPENSSL
+void ScheduledNetworkReply::replySslErrors(const QList<QSslError> &errors)
+{
+    emit sslErrors(errors);
+    // A slot connected to sslErrors() may have called ignoreSslErrors()
+    if (m_ignoreSslErrors)
+        m_reply->ignoreSslErrors();
+}
+#endif
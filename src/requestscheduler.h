@@ -0,0 +1,172 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef REQUESTSCHEDULER_H
+#define REQUESTSCHEDULER_H
+
+#include <qhash.h>
+#include <qlist.h>
+#include <qnetworkaccessmanager.h>
+#include <qnetworkreply.h>
+#include <qnetworkrequest.h>
+#include <qpointer.h>
+
+class ScheduledNetworkReply;
+
+/*
+    Decides when the GET and HEAD requests of a network access manager
+    start.  A request starts right away while there is room for it, no more
+    than maximumRequestsPerHost() requests to a host and maximumRequests()
+    in total are running.  Otherwise a ScheduledNetworkReply is handed out
+    and the request waits until a running one finishes.  The waiting request
+    with the highest priority goes first, in the order they were made when
+    the priority is the same.
+
+    The priority of a request depends on the page it was made for, so
+    switching to another page with setCurrentPage() reorders the requests
+    that are still waiting.
+
+    A reply that is handed over to a download can take any time to finish,
+    detach() stops counting it so it does not hold up the pages.
+
+    The manager is expected to pass requests that canSchedule() to
+    schedule() from its createRequest().  Requests are started with
+    QNetworkAccessManager::get() and head() with ScheduledAttribute set,
+    which canSchedule() refuses.
+  */
+class RequestScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Priority {
+        CurrentMainFramePriority,
+        CurrentPagePriority,
+        BackgroundPagePriority,
+        SpeculativePriority
+    };
+
+    // A Priority for requests that are not made for a page, such as
+    // search suggestions
+    static const QNetworkRequest::Attribute PriorityAttribute;
+    // The QObject * of the page the request is made for
+    static const QNetworkRequest::Attribute PageAttribute;
+    // True for the document the main frame of the page navigates to
+    static const QNetworkRequest::Attribute MainFrameAttribute;
+    // Set on the requests the scheduler starts
+    static const QNetworkRequest::Attribute ScheduledAttribute;
+    // True for the document a sub frame of the page navigates to
+    static const QNetworkRequest::Attribute SubFrameAttribute;
+
+    RequestScheduler(QNetworkAccessManager *manager);
+    ~RequestScheduler();
+
+    int maximumRequestsPerHost() const;
+    void setMaximumRequestsPerHost(int maximum);
+    int maximumRequests() const;
+    void setMaximumRequests(int maximum);
+
+    QObject *currentPage() const;
+    Priority priority(const QNetworkRequest &request) const;
+
+    int runningRequests() const;
+    int queuedRequests() const;
+
+    static bool canSchedule(QNetworkAccessManager::Operation op, const QNetworkRequest &request);
+    QNetworkReply *schedule(QNetworkAccessManager::Operation op, const QNetworkRequest &request);
+    void detach(QNetworkReply *reply);
+
+public slots:
+    void setCurrentPage(QObject *page);
+
+private slots:
+    void requestFinished();
+    void requestDestroyed(QObject *object);
+
+private:
+    friend class ScheduledNetworkReply;
+    static QString hostKey(const QUrl &url);
+    bool hasRoom(const QString &host) const;
+    QNetworkReply *startRequest(QNetworkAccessManager::Operation op, const QNetworkRequest &request);
+    QNetworkReply *start(QNetworkAccessManager::Operation op, const QNetworkRequest &request, const QString &host);
+    void release(QNetworkReply *reply);
+    void startQueued();
+    void dequeue(ScheduledNetworkReply *reply);
+
+    QNetworkAccessManager *m_manager;
+    int m_maximumRequestsPerHost;
+    int m_maximumRequests;
+    QPointer<QObject> m_currentPage;
+
+    // Waiting requests in the order they were made
+    QList<ScheduledNetworkReply*> m_queue;
+
+    // The host of each running request and how many are running per host
+    QHash<QNetworkReply*, QString> m_running;
+    QHash<QString, int> m_runningPerHost;
+};
+
+/*
+    Stands in for a request that is waiting for the RequestScheduler and
+    passes on everything the real reply does once it has started.
+  */
+class ScheduledNetworkReply : public QNetworkReply
+{
+    Q_OBJECT
+
+public:
+    ScheduledNetworkReply(QNetworkAccessManager::Operation op, const QNetworkRequest &request,
+                          const QString &host, RequestScheduler *scheduler, QObject *parent = 0);
+    ~ScheduledNetworkReply();
+
+    QString host() const;
+    RequestScheduler::Priority priority() const;
+    void updatePriority();
+    QNetworkReply *reply() const;
+    void start(QNetworkReply *reply);
+
+    virtual qint64 bytesAvailable() const;
+    virtual bool isSequential() const;
+    virtual void abort();
+    virtual void close();
+    virtual void setReadBufferSize(qint64 size);
+    virtual void ignoreSslErrors();
+
+protected:
+    virtual qint64 readData(char *data, qint64 maxSize);
+
+private slots:
+    void replyMetaDataChanged();
+    void replyError(QNetworkReply::NetworkError code);
+    void replyFinished();
+#ifndef QT_NO_OPENSSL
+    void replySslErrors(const QList<QSslError> &errors);
+#endif
+
+private:
+    void copyMetaData();
+
+    QPointer<RequestScheduler> m_scheduler;
+    QString m_host;
+    RequestScheduler::Priority m_priority;
+    QNetworkReply *m_reply;
+    bool m_ignoreSslErrors;
+};
+
+#endif // REQUESTSCHEDULER_H
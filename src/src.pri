@@ -52,7 +52,9 @@ HEADERS += \
     languagemanager.h \
     modelmenu.h \
     networkaccessmanager.h \
+    networkaccessmanagerproxy.h \
     plaintexteditsearch.h \
+    requestscheduler.h \
     schemeaccesshandler.h \
     searchbar.h \
     searchbutton.h \
@@ -79,7 +81,9 @@ SOURCES += \
     languagemanager.cpp \
     modelmenu.cpp \
     networkaccessmanager.cpp \
+    networkaccessmanagerproxy.cpp \
     plaintexteditsearch.cpp \
+    requestscheduler.cpp \
     schemeaccesshandler.cpp \
     searchbar.cpp \
     searchbutton.cpp \
@@ -95,9 +99,14 @@ SOURCES += \
     webview.cpp \
     webviewsearch.cpp
 
+include(adblock/adblock.pri)
 include(bookmarks/bookmarks.pri)
 include(cookiejar/cookiejar.pri)
 include(history/history.pri)
+# QAbstractNetworkCache is new in Qt 4.5
+!lessThan(QT_MINOR_VERSION, 5) {
+    include(networkcache/networkcache.pri)
+}
 include(locationbar/locationbar.pri)
 include(networkmonitor/networkmonitor.pri)
 include(opensearch/opensearch.pri)
@@ -68,11 +68,13 @@
 #include "bookmarksmodel.h"
 #include "browserapplication.h"
 #include "browsermainwindow.h"
-#include "history.h"
 #include "historymanager.h"
 #include "locationbar.h"
+#include "locationcompleter.h"
+#include "networkaccessmanager.h"
 #include "opensearchengine.h"
 #include "opensearchmanager.h"
+#include "requestscheduler.h"
 #include "tabbar.h"
 #include "toolbarsearch.h"
 #include "webactionmapper.h"
@@ -288,6 +290,9 @@ void TabWidget::currentChanged(int index)
 
     Q_ASSERT(m_lineEdits->count() == count());
 
+    // Let the requests of the page that is shown go first
+    BrowserApplication::networkAccessManager()->requestScheduler()->setCurrentPage(webView->page());
+
     WebView *oldWebView = this->webView(m_lineEdits->currentIndex());
     if (oldWebView) {
         disconnect(oldWebView, SIGNAL(statusBarMessage(const QString&)),
@@ -435,9 +440,12 @@ WebView *TabWidget::makeNewTab(bool makeCurrent)
     // line edit
     LocationBar *locationBar = new LocationBar;
     if (!m_lineEditCompleter) {
-        HistoryCompletionModel *completionModel = new HistoryCompletionModel(this);
-        completionModel->setSourceModel(BrowserApplication::historyManager()->historyFilterModel());
+        LocationCompletionModel *completionModel =
+            new LocationCompletionModel(BrowserApplication::historyManager(),
+                                        BrowserApplication::bookmarksManager(), this);
         m_lineEditCompleter = new QCompleter(completionModel, this);
+        // The model only has the matches of what was typed, ranked best first
+        m_lineEditCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
         connect(m_lineEditCompleter, SIGNAL(activated(const QString &)),
                 this, SLOT(loadString(const QString &)));
         // Should this be in Qt by default?
@@ -450,6 +458,8 @@ WebView *TabWidget::makeNewTab(bool makeCurrent)
         }
     }
     locationBar->setCompleter(m_lineEditCompleter);
+    connect(locationBar, SIGNAL(textEdited(const QString &)),
+            m_lineEditCompleter->model(), SLOT(setQuery(const QString &)));
     connect(locationBar, SIGNAL(returnPressed()), this, SLOT(lineEditReturnPressed()));
     m_lineEdits->addWidget(locationBar);
     m_lineEdits->setSizePolicy(locationBar->sizePolicy());
@@ -579,7 +589,10 @@ void TabWidget::bookmarkTabs()
 void TabWidget::lineEditReturnPressed()
 {
     if (QLineEdit *lineEdit = qobject_cast<QLineEdit*>(sender())) {
-        loadString(lineEdit->text());
+        QString text = lineEdit->text();
+        if (!text.isEmpty())
+            BrowserApplication::historyManager()->setTypedUrl(guessUrlFromString(text));
+        loadString(text);
         if (m_lineEdits->currentWidget() == lineEdit)
             currentWebView()->setFocus();
     }
@@ -24,6 +24,7 @@
 #include "downloadmanager.h"
 #include "historymanager.h"
 #include "networkaccessmanager.h"
+#include "networkaccessmanagerproxy.h"
 #include "opensearchmanager.h"
 #include "tabwidget.h"
 #include "toolbarsearch.h"
@@ -60,7 +61,7 @@ WebPage::WebPage(QObject *parent)
     , m_javaScriptBinding(0)
 {
     setPluginFactory(webPluginFactory());
-    setNetworkAccessManager(BrowserApplication::networkAccessManager());
+    setNetworkAccessManager(new NetworkAccessManagerProxy(this, BrowserApplication::networkAccessManager()));
     connect(this, SIGNAL(unsupportedContent(QNetworkReply *)),
             this, SLOT(handleUnsupportedContent(QNetworkReply *)));
     connect(this, SIGNAL(frameCreated(QWebFrame *)),
@@ -76,6 +77,37 @@ WebPluginFactory *WebPage::webPluginFactory()
     return s_webPluginFactory;
 }
 
+QUrl WebPage::requestedUrl() const
+{
+    return m_requestedUrl;
+}
+
+/*
+    Returns the frame that was allowed to navigate to the url of \a request
+    in acceptNavigationRequest(), or 0 when the request is for anything
+    else.  Redirects and location changes are navigations as well, so the
+    document of a frame is found however it was reached.  The frame is
+    only compared, it may already be deleted.
+  */
+QObject *WebPage::takeNavigation(const QNetworkRequest &request)
+{
+    if (m_navigations.isEmpty())
+        return 0;
+
+    QByteArray url = request.url().toEncoded(QUrl::RemoveFragment);
+#if QT_VERSION >= 0x040600
+    QObject *frame = request.originatingObject();
+    if (!frame || m_navigations.value(frame) != url)
+        return 0;
+#else
+    QObject *frame = m_navigations.key(url);
+    if (!frame)
+        return 0;
+#endif
+    m_navigations.remove(frame);
+    return frame;
+}
+
 QList<WebPageLinkedResource> WebPage::linkedResources(const QString &relation)
 {
     QList<WebPageLinkedResource> resources;
@@ -199,6 +231,8 @@ bool WebPage::acceptNavigationRequest(QWebFrame *frame, const QNetworkRequest &r
     }
 
     bool accepted = QWebPage::acceptNavigationRequest(frame, request, type);
+    if (accepted && frame)
+        m_navigations.insert(frame, request.url().toEncoded(QUrl::RemoveFragment));
     if (accepted && frame == mainFrame()) {
         m_requestedUrl = request.url();
         emit aboutToLoadUrl(request.url());
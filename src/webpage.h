@@ -22,6 +22,7 @@
 
 #include "tabwidget.h"
 
+#include <qhash.h>
 #include <qlist.h>
 #include <qwebpage.h>
 
@@ -61,6 +62,8 @@ public:
 
     static WebPluginFactory *webPluginFactory();
     QList<WebPageLinkedResource> linkedResources(const QString &relation = QString());
+    QUrl requestedUrl() const;
+    QObject *takeNavigation(const QNetworkRequest &request);
 
 protected:
     bool acceptNavigationRequest(QWebFrame *frame, const QNetworkRequest &request,
@@ -76,6 +79,8 @@ protected:
     static WebPluginFactory *s_webPluginFactory;
     TabWidget::OpenUrlIn m_openTargetBlankLinksIn;
     QUrl m_requestedUrl;
+    // The url each frame was last allowed to navigate to
+    QHash<QObject*, QByteArray> m_navigations;
     JavaScriptExternalObject *m_javaScriptBinding;
 };
 
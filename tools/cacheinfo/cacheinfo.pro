@@ -11,6 +11,12 @@ QT += network
 # Input
 SOURCES += main.cpp
 
+# The cache format is read using the cache itself
+INCLUDEPATH += ../../src/networkcache
+DEPENDPATH += ../../src/networkcache
+HEADERS += ../../src/networkcache/networkdiskcache.h
+SOURCES += ../../src/networkcache/networkdiskcache.cpp
+
 RCC_DIR     = $$PWD/.rcc
 UI_DIR      = $$PWD/.ui
 MOC_DIR     = $$PWD/.moc
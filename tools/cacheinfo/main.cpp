@@ -20,13 +20,7 @@
 #include <QtNetwork/QtNetwork>
 #include <QtGui/QtGui>
 
-class NetworkDiskCache : public QNetworkDiskCache
-{
-public:
-    QNetworkCacheMetaData _fileMetaData(const QString &fileName)
-        { return fileMetaData(fileName); }
-
-};
+#include <networkdiskcache.h>
 
 int main(int argc, char **argv)
 {
@@ -39,23 +33,39 @@ int main(int argc, char **argv)
     if (args.isEmpty()) {
         QTextStream stream(stdout);
         stream << "arora-cacheinfo is a tool for viewing and extracting information out of Arora cache files." << endl;
-        stream << "arora-cacheinfo [-o cachefile] [file | url]" << endl;
+        stream << "arora-cacheinfo [-d cachedirectory] [-o cachefile] url" << endl;
+        stream << "arora-cacheinfo [-d cachedirectory] -l" << endl;
         return 0;
     }
 
-    NetworkDiskCache diskCache;
     QString location = QDesktopServices::storageLocation(QDesktopServices::CacheLocation)
-            + QLatin1String("/browser/");
+            + QLatin1String("/browser");
+    if (args.count() >= 2 && args.first() == QLatin1String("-d")) {
+        args.takeFirst();
+        location = args.takeFirst();
+    }
+    // The browser might be using the cache, leave it as it is
+    NetworkDiskCache diskCache;
+    diskCache.setReadOnly(true);
     diskCache.setCacheDirectory(location);
 
-    QNetworkCacheMetaData metaData;
-    QString last = args.takeLast();
-    if (QFile::exists(last)) {
-        qDebug() << "Reading in from a file and not a URL.";
-        metaData = diskCache._fileMetaData(last);
-    } else {
-        qDebug() << "Reading in from a URL and not a file.";
-        metaData = diskCache.metaData(last);
+    if (args.count() == 1 && args.first() == QLatin1String("-l")) {
+        QTextStream stream(stdout);
+        stream << "Entries: " << diskCache.entryCount() << endl;
+        stream << "Size: " << diskCache.cacheSize() << endl;
+        foreach (const QUrl &url, diskCache.urls())
+            stream << url.toString() << endl;
+        return 0;
+    }
+
+    if (args.isEmpty()) {
+        qDebug() << "No URL given.";
+        return 1;
+    }
+    QNetworkCacheMetaData metaData = diskCache.metaData(QUrl(args.takeLast()));
+    if (!metaData.isValid()) {
+        qDebug() << "The URL is not in the cache.";
+        return 1;
     }
 
     if (!args.isEmpty()
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2009 Arora Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#include <QtCore/QtCore>
+#include <QtNetwork/QtNetwork>
+
+/*
+    Turns the Public Suffix List (https://publicsuffix.org/list/public_suffix_list.dat)
+    into the sorted table in src/cookiejar/networkcookiejar/publicsuffixlist_p.h
+
+    Wildcard and exception rules are stored as the domain they apply to with
+    a flag, internationalized rules are stored in their ascii compatible form.
+  */
+
+enum RuleFlags {
+    PublicSuffixRule = 1,
+    WildcardRule = 2,
+    ExceptionRule = 4
+};
+
+int main(int argc, char **argv)
+{
+    QCoreApplication application(argc, argv);
+    QStringList args = application.arguments();
+    args.takeFirst();
+    if (args.count() != 2) {
+        QTextStream stream(stdout);
+        stream << "arora-publicsuffix generates the public suffix table used by the cookie jar." << endl;
+        stream << "arora-publicsuffix public_suffix_list.dat publicsuffixlist_p.h" << endl;
+        return 0;
+    }
+
+    QFile listFile(args.at(0));
+    if (!listFile.open(QFile::ReadOnly)) {
+        qWarning() << "Unable to open" << listFile.fileName();
+        return 1;
+    }
+
+    QMap<QByteArray, int> rules;
+    QTextStream in(&listFile);
+    in.setCodec("UTF-8");
+    while (!in.atEnd()) {
+        QString line = in.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1String("//")))
+            continue;
+        QString rule = line.section(QLatin1Char(' '), 0, 0).section(QLatin1Char('\t'), 0, 0).toLower();
+        int flags = PublicSuffixRule;
+        if (rule.startsWith(QLatin1Char('!'))) {
+            flags = ExceptionRule;
+            rule = rule.mid(1);
+        } else if (rule.startsWith(QLatin1String("*."))) {
+            flags = WildcardRule;
+            rule = rule.mid(2);
+        }
+        QByteArray ace = QUrl::toAce(rule);
+        if (ace.isEmpty()) {
+            qWarning() << "Skipping rule" << line;
+            continue;
+        }
+        rules[ace] |= flags;
+    }
+
+    QFile outFile(args.at(1));
+    if (!outFile.open(QFile::WriteOnly | QFile::Truncate)) {
+        qWarning() << "Unable to write" << outFile.fileName();
+        return 1;
+    }
+    QTextStream out(&outFile);
+    out << "// Generated by tools/publicsuffix from the Public Suffix List, do not edit.\n"
+        << "// The list is subject to the terms of the Mozilla Public License, v. 2.0,\n"
+        << "// see https://publicsuffix.org/list/public_suffix_list.dat\n"
+        << "\n"
+        << "// Sorted by domain, flags are 1 for a public suffix, 2 when every\n"
+        << "// subdomain is one and 4 when the domain is an exception to that.\n"
+        << "static const PublicSuffixRule publicSuffixRules[] = {\n";
+    QMap<QByteArray, int>::const_iterator it = rules.constBegin();
+    for (; it != rules.constEnd(); ++it)
+        out << "    { \"" << it.key() << "\", " << it.value() << " },\n";
+    out << "};\n";
+    return 0;
+}
@@ -0,0 +1,18 @@
+TEMPLATE = app
+TARGET = arora-publicsuffix
+DEPENDPATH += .
+INCLUDEPATH += .
+
+win32: CONFIG += console
+mac:CONFIG -= app_bundle
+
+QT -= gui
+QT += network
+
+# Input
+SOURCES += main.cpp
+
+RCC_DIR     = $$PWD/.rcc
+UI_DIR      = $$PWD/.ui
+MOC_DIR     = $$PWD/.moc
+OBJECTS_DIR = $$PWD/.obj
@@ -1,5 +1,5 @@
 TEMPLATE = subdirs
-SUBDIRS  = htmlToXBel placesimport
+SUBDIRS  = htmlToXBel placesimport publicsuffix
 
 # Only compile cacheinfo if we're using Qt >= 4.5
 !lessThan(QT_MINOR_VERSION, 5) {